@@ -0,0 +1,70 @@
+/**
+ * @file alloc_counter.cpp
+ * @brief Counting replacements for the global allocation functions.
+ *
+ * Only the single-object forms are replaced: the array and nothrow forms are
+ * specified to forward to them, and the sized deletes to the unsized ones.
+ */
+
+#include "alloc_counter.hpp"
+
+#include <cstdlib>
+#include <new>
+
+namespace rescue::bench {
+
+namespace {
+
+// constinit keeps the thread_local free of dynamic initialization, which
+// would otherwise run inside operator new on first use.
+constinit thread_local AllocCounts t_counts{};
+
+void* counted_alloc(std::size_t size, std::size_t alignment) {
+    ++t_counts.allocations;
+    t_counts.bytes += size;
+    if (size == 0) {
+        size = 1;
+    }
+    void* p = nullptr;
+    if (alignment <= alignof(std::max_align_t)) {
+        p = std::malloc(size);
+    } else {
+        // aligned_alloc requires size to be a multiple of the alignment
+        p = std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    }
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+void counted_free(void* p) noexcept {
+    if (p != nullptr) {
+        ++t_counts.deallocations;
+        std::free(p);
+    }
+}
+
+}  // anonymous namespace
+
+AllocCounts current_alloc_counts() noexcept {
+    return t_counts;
+}
+
+}  // namespace rescue::bench
+
+void* operator new(std::size_t size) {
+    return rescue::bench::counted_alloc(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return rescue::bench::counted_alloc(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* p) noexcept {
+    rescue::bench::counted_free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    rescue::bench::counted_free(p);
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+/**
+ * @file alloc_counter.hpp
+ * @brief Heap allocation counters for the benchmark suite.
+ *
+ * alloc_counter.cpp replaces the global operator new/delete for bench_rescue
+ * and counts calls per thread, so each benchmark can report allocations and
+ * bytes allocated per iteration next to its timing.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+namespace rescue::bench {
+
+/**
+ * @brief Heap activity on the calling thread.
+ */
+struct AllocCounts {
+    uint64_t allocations = 0;
+    uint64_t deallocations = 0;
+    uint64_t bytes = 0;  ///< Bytes requested from operator new
+
+    [[nodiscard]] AllocCounts operator-(const AllocCounts& o) const noexcept {
+        return {allocations - o.allocations, deallocations - o.deallocations, bytes - o.bytes};
+    }
+};
+
+/**
+ * @brief Totals since thread start for the calling thread.
+ */
+[[nodiscard]] AllocCounts current_alloc_counts() noexcept;
+
+/**
+ * @brief RAII scope counting allocations around a benchmark loop.
+ *
+ * Construct immediately before `for (auto _ : state)`; on destruction
+ * allocs_per_op and bytes_per_op are added to state.counters.
+ */
+class AllocScope {
+public:
+    explicit AllocScope(benchmark::State& state) noexcept
+        : state_(state), start_(current_alloc_counts()) {}
+
+    ~AllocScope() {
+        AllocCounts delta = current_alloc_counts() - start_;
+        state_.counters["allocs_per_op"] = benchmark::Counter(
+            static_cast<double>(delta.allocations), benchmark::Counter::kAvgIterations);
+        state_.counters["bytes_per_op"] = benchmark::Counter(
+            static_cast<double>(delta.bytes), benchmark::Counter::kAvgIterations);
+    }
+
+    AllocScope(const AllocScope&) = delete;
+    AllocScope& operator=(const AllocScope&) = delete;
+
+private:
+    benchmark::State& state_;
+    AllocCounts start_;
+};
+
+}  // namespace rescue::bench
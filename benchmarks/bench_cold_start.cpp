@@ -0,0 +1,336 @@
+/**
+ * @file bench_cold_start.cpp
+ * @brief bench_cold_start: time-to-first-operation in fresh processes.
+ *
+ * Usage:
+ *   bench_cold_start [--runs=<n>] [--scenario=<name>] [--output=<file>]
+ *
+ * Google Benchmark only sees warm steady state. This benchmark forks and
+ * re-executes itself for every sample, so each measurement pays the full
+ * startup bill: exec, dynamic linking, static initialization (including
+ * OpenSSL's library constructors), lazy OpenSSL setup on the first SHAKE256
+ * call, and the first RescueDesc construction.
+ *
+ * Scenarios:
+ *   encrypt  RescueCipher construction, first encrypt_raw, then a warm one
+ *   hash     RescuePrimeHash construction, first digest, then a warm one
+ *   shake    First and second SHAKE256 call (isolates OpenSSL setup)
+ *
+ * The parent records the time just before fork(); the child reports phase
+ * boundaries relative to it, plus the library phases collected through
+ * rescue::metrics (key derivation, round parameters, MDS setup, constant
+ * sampling, key schedule). Library phases nest: key derivation contains the
+ * KDF hasher's own round-parameter, MDS and sampling phases.
+ *
+ * Exit status: 0 on success, 1 if a child failed, 2 on usage error.
+ */
+
+#include <rescue/rescue.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Ordered so phases print in the order they ran
+using json = nlohmann::ordered_json;
+using namespace rescue;
+
+namespace {
+
+constexpr std::array<std::string_view, 3> SCENARIOS = {"encrypt", "hash", "shake"};
+
+uint64_t now_ns() {
+    timespec ts{};
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000ull + static_cast<uint64_t>(ts.tv_nsec);
+}
+
+// ============================================================================
+// Child
+// ============================================================================
+
+/**
+ * @brief Phase boundaries of one child, in ns since the parent's fork().
+ */
+class PhaseClock {
+public:
+    explicit PhaseClock(uint64_t t0) : t0_(t0), last_(t0) {}
+
+    /// Record the phase that ends now.
+    void mark(const std::string& name) {
+        uint64_t t = now_ns();
+        phases_.emplace_back(name, t - last_);
+        last_ = t;
+    }
+
+    /// Record a cumulative milestone (time since fork) without ending a phase.
+    void milestone(const std::string& name) { milestones_.emplace_back(name, now_ns() - t0_); }
+
+    [[nodiscard]] json to_json() const {
+        json out = {{"phases_ns", json::object()}, {"milestones_ns", json::object()}};
+        for (const auto& [name, ns] : phases_) {
+            out["phases_ns"][name] = ns;
+        }
+        for (const auto& [name, ns] : milestones_) {
+            out["milestones_ns"][name] = ns;
+        }
+        return out;
+    }
+
+private:
+    uint64_t t0_;
+    uint64_t last_;
+    std::vector<std::pair<std::string, uint64_t>> phases_;
+    std::vector<std::pair<std::string, uint64_t>> milestones_;
+};
+
+int run_child(std::string_view scenario, uint64_t t0, int fd) {
+    PhaseClock clock(t0);
+    clock.mark("exec_to_main");  // fork, exec, dynamic linking, static init
+    metrics::set_enabled(true);
+
+    std::array<uint8_t, 32> secret{};
+    secret[0] = 1;
+    std::array<uint8_t, 16> nonce{};
+    std::vector<Fp> message(RESCUE_CIPHER_BLOCK_SIZE, Fp(uint64_t{7}));
+
+    if (scenario == "encrypt") {
+        RescueCipher cipher(secret);
+        clock.mark("cipher_construction");
+        auto first = cipher.encrypt_raw(message, nonce);
+        clock.mark("first_encrypt");
+        clock.milestone("time_to_first_encrypt");
+        auto warm = cipher.encrypt_raw(message, nonce);
+        clock.mark("warm_encrypt");
+        if (first != warm) {
+            return 1;
+        }
+    } else if (scenario == "hash") {
+        RescuePrimeHash hasher;
+        clock.mark("hasher_construction");
+        auto first = hasher.digest(message);
+        clock.mark("first_digest");
+        clock.milestone("time_to_first_hash");
+        auto warm = hasher.digest(message);
+        clock.mark("warm_digest");
+        if (first != warm) {
+            return 1;
+        }
+    } else {
+        std::array<uint8_t, 1> data = {0};
+        Shake256 first;
+        first.update(data);
+        auto a = first.xof(32);
+        clock.mark("first_shake");
+        Shake256 second;
+        second.update(data);
+        auto b = second.xof(32);
+        clock.mark("warm_shake");
+        if (a != b) {
+            return 1;
+        }
+    }
+
+    json result = clock.to_json();
+    auto snap = metrics::snapshot();
+    for (size_t p = 0; p < metrics::PHASE_COUNT; ++p) {
+        auto phase = static_cast<metrics::Phase>(p);
+        if (snap.phase(phase).count > 0) {
+            result["library_phases_ns"][metrics::name(phase)] = snap.phase(phase).total_ns;
+        }
+    }
+
+    std::string line = result.dump() + "\n";
+    return write(fd, line.data(), line.size()) == static_cast<ssize_t>(line.size()) ? 0 : 1;
+}
+
+// ============================================================================
+// Parent
+// ============================================================================
+
+/**
+ * @brief Fork and re-exec this binary for one sample.
+ * @return The child's JSON report plus the parent's fork-to-exit time.
+ */
+json sample(const std::string& self, std::string_view scenario) {
+    int fds[2];
+    if (pipe(fds) != 0) {
+        throw std::runtime_error("pipe failed");
+    }
+
+    uint64_t t0 = now_ns();
+    pid_t pid = fork();
+    if (pid < 0) {
+        throw std::runtime_error("fork failed");
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        std::string a_child = "--child=" + std::string(scenario);
+        std::string a_t0 = "--t0=" + std::to_string(t0);
+        std::string a_fd = "--fd=" + std::to_string(fds[1]);
+        char* argv[] = {const_cast<char*>(self.c_str()), a_child.data(), a_t0.data(), a_fd.data(), nullptr};
+        execv(self.c_str(), argv);
+        _exit(127);
+    }
+
+    close(fds[1]);
+    std::string out;
+    char buf[4096];
+    for (ssize_t n; (n = read(fds[0], buf, sizeof(buf))) > 0;) {
+        out.append(buf, static_cast<size_t>(n));
+    }
+    close(fds[0]);
+
+    int status = 0;
+    waitpid(pid, &status, 0);
+    uint64_t t_exit = now_ns() - t0;
+    if (!WIFEXITED(status) || WEXITSTATUS(status) != 0 || out.empty()) {
+        throw std::runtime_error("child for scenario " + std::string(scenario) + " failed");
+    }
+
+    json result = json::parse(out);
+    result["milestones_ns"]["fork_to_exit"] = t_exit;
+    return result;
+}
+
+/**
+ * @brief Order statistics of one phase across runs.
+ */
+json summarize(std::vector<uint64_t> xs) {
+    std::sort(xs.begin(), xs.end());
+    auto at = [&](double q) { return xs[static_cast<size_t>(q * static_cast<double>(xs.size() - 1))]; };
+    return {{"min", xs.front()}, {"median", at(0.5)}, {"p90", at(0.9)}, {"max", xs.back()}};
+}
+
+void print_group(const std::string& title, const json& group) {
+    for (const auto& [name, stats] : group.items()) {
+        std::printf("  %-10s %-24s %10.1f %10.1f %10.1f\n", title.c_str(), name.c_str(),
+                    stats["min"].get<double>() / 1000.0, stats["median"].get<double>() / 1000.0,
+                    stats["p90"].get<double>() / 1000.0);
+    }
+}
+
+struct Options {
+    size_t runs = 20;
+    std::vector<std::string_view> scenarios = {SCENARIOS.begin(), SCENARIOS.end()};
+    std::string output = "cold_start_results.json";
+};
+
+void print_usage() {
+    std::cerr << "usage: bench_cold_start [--runs=<n>] [--scenario=encrypt|hash|shake] [--output=<file>]\n";
+}
+
+Options parse_args(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg(argv[i]);
+        auto value = [&](std::string_view flag) -> std::optional<std::string_view> {
+            if (arg.starts_with(flag)) {
+                return arg.substr(flag.size());
+            }
+            return std::nullopt;
+        };
+        if (auto v = value("--runs=")) {
+            opts.runs = std::stoul(std::string(*v));
+        } else if (auto v = value("--scenario=")) {
+            auto it = std::find(SCENARIOS.begin(), SCENARIOS.end(), *v);
+            if (it == SCENARIOS.end()) {
+                throw std::invalid_argument("unknown scenario " + std::string(*v));
+            }
+            opts.scenarios = {*it};
+        } else if (auto v = value("--output=")) {
+            opts.output = std::string(*v);
+        } else {
+            throw std::invalid_argument("unknown option " + std::string(arg));
+        }
+    }
+    if (opts.runs == 0) {
+        throw std::invalid_argument("runs must be positive");
+    }
+    return opts;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char** argv) {
+    // Child mode: --child=<scenario> --t0=<ns> --fd=<pipe>
+    if (argc == 4 && std::string_view(argv[1]).starts_with("--child=")) {
+        std::string_view scenario = std::string_view(argv[1]).substr(8);
+        uint64_t t0 = std::stoull(std::string(argv[2]).substr(5));
+        int fd = std::stoi(std::string(argv[3]).substr(5));
+        return run_child(scenario, t0, fd);
+    }
+
+    Options opts;
+    try {
+        opts = parse_args(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << "bench_cold_start: " << e.what() << "\n";
+        print_usage();
+        return 2;
+    }
+
+    std::string self = "/proc/self/exe";
+    std::array<char, 4096> path{};
+    ssize_t len = readlink(self.c_str(), path.data(), path.size() - 1);
+    if (len > 0) {
+        self.assign(path.data(), static_cast<size_t>(len));
+    }
+
+    json results = {{"runs", opts.runs}};
+    std::printf("Cold start, %zu fresh processes per scenario (times in us)\n\n", opts.runs);
+    std::printf("  %-10s %-24s %10s %10s %10s\n", "kind", "phase", "min", "median", "p90");
+
+    for (std::string_view scenario : opts.scenarios) {
+        // group -> phase -> one value per run, in first-seen order
+        json samples = json::object();
+        try {
+            for (size_t r = 0; r < opts.runs; ++r) {
+                json s = sample(self, scenario);
+                for (const char* group : {"phases_ns", "library_phases_ns", "milestones_ns"}) {
+                    if (s.contains(group)) {
+                        for (const auto& [name, value] : s[group].items()) {
+                            samples[group][name].push_back(value);
+                        }
+                    }
+                }
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "bench_cold_start: " << e.what() << "\n";
+            return 1;
+        }
+
+        json& out = results["scenarios"][std::string(scenario)];
+        for (const auto& [group, phases] : samples.items()) {
+            for (const auto& [name, xs] : phases.items()) {
+                out[group][name] = summarize(xs.get<std::vector<uint64_t>>());
+            }
+        }
+
+        std::printf("\n%s\n", std::string(scenario).c_str());
+        print_group("phase", out["phases_ns"]);
+        if (out.contains("library_phases_ns")) {
+            print_group("library", out["library_phases_ns"]);
+        }
+        print_group("milestone", out["milestones_ns"]);
+    }
+
+    std::ofstream file(opts.output);
+    file << results.dump(2);
+    std::printf("\nResults saved to %s\n", opts.output.c_str());
+    return 0;
+}
@@ -0,0 +1,326 @@
+/**
+ * @file bench_compare.cpp
+ * @brief rescue-bench-compare: statistical regression check between two
+ *        benchmark_results_cpp.json files.
+ *
+ * Usage:
+ *   rescue-bench-compare [options] <baseline.json> <contender.json>
+ *
+ * Both files should be produced with --benchmark_repetitions=N (N >= 5 is
+ * recommended) so that each benchmark carries a samples_ns array. For every
+ * benchmark present in both files the tool reports the relative change of the
+ * median, a percentile-bootstrap confidence interval for that change, and a
+ * two-sided Mann-Whitney U p-value. A benchmark is a regression when it is
+ * significantly slower (p < alpha) and the median slowdown exceeds the
+ * threshold.
+ *
+ * Options:
+ *   --threshold=<percent>  Regression threshold in percent (default 5)
+ *   --alpha=<p>            Significance level and CI width (default 0.05)
+ *   --resamples=<n>        Bootstrap resamples (default 10000)
+ *   --filter=<substring>   Only compare benchmarks whose name contains it
+ *
+ * Exit status: 0 if no regression, 1 if any regression, 2 on usage/input error.
+ */
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using json = nlohmann::json;
+
+namespace {
+
+// ============================================================================
+// Statistics
+// ============================================================================
+
+double median(std::vector<double> xs) {
+    std::sort(xs.begin(), xs.end());
+    size_t n = xs.size();
+    return n % 2 == 1 ? xs[n / 2] : 0.5 * (xs[n / 2 - 1] + xs[n / 2]);
+}
+
+/**
+ * @brief Two-sided Mann-Whitney U test (normal approximation with tie and
+ *        continuity correction).
+ * @return p-value, or nullopt if either sample has fewer than two values.
+ */
+std::optional<double> mann_whitney_p(const std::vector<double>& a, const std::vector<double>& b) {
+    size_t n1 = a.size();
+    size_t n2 = b.size();
+    if (n1 < 2 || n2 < 2) {
+        return std::nullopt;
+    }
+
+    std::vector<std::pair<double, int>> pooled;
+    pooled.reserve(n1 + n2);
+    for (double x : a) pooled.emplace_back(x, 0);
+    for (double x : b) pooled.emplace_back(x, 1);
+    std::sort(pooled.begin(), pooled.end());
+
+    // Assign average ranks to ties; accumulate the tie correction term.
+    double rank_sum_a = 0.0;
+    double tie_term = 0.0;
+    for (size_t i = 0; i < pooled.size();) {
+        size_t j = i;
+        while (j < pooled.size() && pooled[j].first == pooled[i].first) {
+            ++j;
+        }
+        double avg_rank = 0.5 * static_cast<double>(i + 1 + j);
+        for (size_t k = i; k < j; ++k) {
+            if (pooled[k].second == 0) {
+                rank_sum_a += avg_rank;
+            }
+        }
+        double t = static_cast<double>(j - i);
+        tie_term += t * t * t - t;
+        i = j;
+    }
+
+    double dn1 = static_cast<double>(n1);
+    double dn2 = static_cast<double>(n2);
+    double n = dn1 + dn2;
+    double u = rank_sum_a - dn1 * (dn1 + 1.0) / 2.0;
+    double mu = dn1 * dn2 / 2.0;
+    double sigma = std::sqrt(dn1 * dn2 / 12.0 * ((n + 1.0) - tie_term / (n * (n - 1.0))));
+    if (sigma == 0.0) {
+        return 1.0;
+    }
+    double z = (std::abs(u - mu) - 0.5) / sigma;
+    return std::erfc(std::max(z, 0.0) / std::sqrt(2.0));
+}
+
+/**
+ * @brief Percentile bootstrap CI for median(contender) / median(baseline) - 1.
+ *
+ * Uses a fixed seed so repeated comparisons of the same files agree.
+ */
+std::pair<double, double> bootstrap_ci(const std::vector<double>& baseline,
+                                       const std::vector<double>& contender,
+                                       size_t resamples, double alpha) {
+    std::mt19937_64 rng(0x5e5c0eULL);
+    std::vector<double> deltas;
+    deltas.reserve(resamples);
+    std::vector<double> ra(baseline.size());
+    std::vector<double> rb(contender.size());
+    std::uniform_int_distribution<size_t> pick_a(0, baseline.size() - 1);
+    std::uniform_int_distribution<size_t> pick_b(0, contender.size() - 1);
+
+    for (size_t r = 0; r < resamples; ++r) {
+        for (auto& x : ra) x = baseline[pick_a(rng)];
+        for (auto& x : rb) x = contender[pick_b(rng)];
+        deltas.push_back(median(rb) / median(ra) - 1.0);
+    }
+    std::sort(deltas.begin(), deltas.end());
+
+    auto quantile = [&](double q) {
+        size_t idx = static_cast<size_t>(q * static_cast<double>(deltas.size() - 1) + 0.5);
+        return deltas[std::min(idx, deltas.size() - 1)];
+    };
+    return {quantile(alpha / 2.0), quantile(1.0 - alpha / 2.0)};
+}
+
+// ============================================================================
+// Input
+// ============================================================================
+
+std::map<std::string, std::vector<double>> load_samples(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("cannot open " + path);
+    }
+    json doc = json::parse(file);
+    if (!doc.contains("benchmarks") || !doc["benchmarks"].is_object()) {
+        throw std::runtime_error(path + " has no \"benchmarks\" object");
+    }
+
+    std::map<std::string, std::vector<double>> out;
+    for (const auto& [name, bench] : doc["benchmarks"].items()) {
+        std::vector<double> samples;
+        if (bench.contains("samples_ns")) {
+            samples = bench["samples_ns"].get<std::vector<double>>();
+        } else if (bench.contains("mean_ns")) {
+            // Results written before samples were recorded: single value
+            samples.push_back(bench["mean_ns"].get<double>());
+        }
+        if (!samples.empty()) {
+            out.emplace(name, std::move(samples));
+        }
+    }
+    return out;
+}
+
+// ============================================================================
+// Output
+// ============================================================================
+
+std::string format_time(double ns) {
+    char buf[32];
+    if (ns >= 1e9) {
+        std::snprintf(buf, sizeof(buf), "%.3f s", ns / 1e9);
+    } else if (ns >= 1e6) {
+        std::snprintf(buf, sizeof(buf), "%.3f ms", ns / 1e6);
+    } else if (ns >= 1e3) {
+        std::snprintf(buf, sizeof(buf), "%.3f us", ns / 1e3);
+    } else {
+        std::snprintf(buf, sizeof(buf), "%.0f ns", ns);
+    }
+    return buf;
+}
+
+std::string format_percent(double x) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%+.2f%%", 100.0 * x);
+    return buf;
+}
+
+struct Options {
+    double threshold = 0.05;
+    double alpha = 0.05;
+    size_t resamples = 10000;
+    std::string filter;
+    std::string baseline;
+    std::string contender;
+};
+
+void print_usage() {
+    std::cerr << "usage: rescue-bench-compare [--threshold=<percent>] [--alpha=<p>]\n"
+                 "                            [--resamples=<n>] [--filter=<substring>]\n"
+                 "                            <baseline.json> <contender.json>\n";
+}
+
+Options parse_args(int argc, char** argv) {
+    Options opts;
+    std::vector<std::string> positional;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg(argv[i]);
+        auto value = [&](std::string_view flag) -> std::optional<std::string> {
+            if (arg.starts_with(flag)) {
+                return std::string(arg.substr(flag.size()));
+            }
+            return std::nullopt;
+        };
+        if (auto v = value("--threshold=")) {
+            opts.threshold = std::stod(*v) / 100.0;
+        } else if (auto v = value("--alpha=")) {
+            opts.alpha = std::stod(*v);
+        } else if (auto v = value("--resamples=")) {
+            opts.resamples = std::stoul(*v);
+        } else if (auto v = value("--filter=")) {
+            opts.filter = *v;
+        } else if (arg.starts_with("--")) {
+            throw std::invalid_argument("unknown option " + std::string(arg));
+        } else {
+            positional.emplace_back(arg);
+        }
+    }
+    if (positional.size() != 2) {
+        throw std::invalid_argument("expected exactly two result files");
+    }
+    if (opts.alpha <= 0.0 || opts.alpha >= 1.0 || opts.resamples == 0) {
+        throw std::invalid_argument("alpha must be in (0, 1) and resamples positive");
+    }
+    opts.baseline = positional[0];
+    opts.contender = positional[1];
+    return opts;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    std::map<std::string, std::vector<double>> baseline;
+    std::map<std::string, std::vector<double>> contender;
+    try {
+        opts = parse_args(argc, argv);
+        baseline = load_samples(opts.baseline);
+        contender = load_samples(opts.contender);
+    } catch (const std::exception& e) {
+        std::cerr << "rescue-bench-compare: " << e.what() << "\n";
+        print_usage();
+        return 2;
+    }
+
+    size_t name_width = 9;
+    for (const auto& [name, _] : baseline) {
+        name_width = std::max(name_width, name.size());
+    }
+
+    std::printf("%-*s %12s %12s %9s %21s %8s  %s\n", static_cast<int>(name_width), "Benchmark",
+                "Baseline", "Contender", "Delta", "CI", "p", "Status");
+    std::printf("%s\n", std::string(name_width + 86, '-').c_str());
+
+    size_t regressions = 0;
+    size_t underpowered = 0;
+    for (const auto& [name, base] : baseline) {
+        if (!opts.filter.empty() && name.find(opts.filter) == std::string::npos) {
+            continue;
+        }
+        auto it = contender.find(name);
+        if (it == contender.end()) {
+            std::printf("%-*s %12s %12s %9s %21s %8s  %s\n", static_cast<int>(name_width),
+                        name.c_str(), format_time(median(base)).c_str(), "-", "-", "-", "-",
+                        "missing in contender");
+            continue;
+        }
+        const auto& cont = it->second;
+
+        double base_median = median(base);
+        double cont_median = median(cont);
+        double delta = cont_median / base_median - 1.0;
+        auto p = mann_whitney_p(base, cont);
+
+        std::string ci = "-";
+        std::string p_text = "-";
+        std::string status;
+        if (!p) {
+            ++underpowered;
+            status = "n/a (need repetitions)";
+        } else {
+            auto [lo, hi] = bootstrap_ci(base, cont, opts.resamples, opts.alpha);
+            ci = "[" + format_percent(lo) + ", " + format_percent(hi) + "]";
+            char buf[16];
+            std::snprintf(buf, sizeof(buf), "%.4f", *p);
+            p_text = buf;
+
+            bool significant = *p < opts.alpha;
+            if (significant && delta > opts.threshold) {
+                ++regressions;
+                status = "REGRESSION";
+            } else if (significant && delta < -opts.threshold) {
+                status = "improved";
+            } else if (significant) {
+                status = "within threshold";
+            } else {
+                status = "~";
+            }
+        }
+
+        std::printf("%-*s %12s %12s %9s %21s %8s  %s\n", static_cast<int>(name_width),
+                    name.c_str(), format_time(base_median).c_str(),
+                    format_time(cont_median).c_str(), format_percent(delta).c_str(), ci.c_str(),
+                    p_text.c_str(), status.c_str());
+    }
+
+    std::printf("\n%zu regression(s) above %.1f%% at alpha = %.3g\n", regressions,
+                100.0 * opts.threshold, opts.alpha);
+    if (underpowered > 0) {
+        std::printf("%zu benchmark(s) had fewer than two samples; rerun bench_rescue with "
+                    "--benchmark_repetitions=N\n",
+                    underpowered);
+    }
+    return regressions > 0 ? 1 : 0;
+}
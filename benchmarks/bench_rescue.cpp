@@ -5,21 +5,65 @@
 
 #include <rescue/rescue.hpp>
 
+#include "alloc_counter.hpp"
+#include "perf_counters.hpp"
+
+#include <algorithm>
 #include <benchmark/benchmark.h>
+#include <bit>
 #include <chrono>
 #include <ctime>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <nlohmann/json.hpp>
+#include <random>
 #include <sstream>
+#include <string_view>
+#include <utility>
+
+#if defined(__linux__)
+#include <unistd.h>
+#endif
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
 
 using namespace rescue;
+using rescue::bench::AllocScope;
+using rescue::bench::PerfCounters;
+using rescue::bench::PerfScope;
 using json = nlohmann::json;
 
 // Global JSON object to store results
 json benchmark_results;
 
+// ============================================================================
+// Work Units for Hardware Counter Normalization
+// ============================================================================
+
+// Field multiplications plus additions in an n x n by n x n matrix product.
+static double mat_mul_field_ops(size_t n) {
+    return 2.0 * static_cast<double>(n * n * n);
+}
+
+// Field multiplications in an element-wise x^5 over n elements: two squarings
+// and one multiplication each.
+static double pow5_field_ops(size_t n) {
+    return 3.0 * static_cast<double>(n);
+}
+
+// Sponge permutations for a Rescue-Prime digest: the message is padded with a
+// 1 and zeros to a multiple of the rate; the digest fits in one squeeze.
+static double hash_permutations(size_t n_elements, size_t rate = RESCUE_HASH_RATE) {
+    return static_cast<double>((n_elements + rate) / rate);
+}
+
+// Keystream permutations for CTR mode over n_elements with an m-wide state.
+static double ctr_permutations(size_t n_elements, size_t m) {
+    return static_cast<double>((n_elements + m - 1) / m);
+}
+
 // ============================================================================
 // Field Arithmetic Benchmarks
 // ============================================================================
@@ -28,6 +72,8 @@ static void BM_FieldAddition(benchmark::State& state) {
     Fp a = Fp::random();
     Fp b = Fp::random();
 
+    PerfScope perf(state, {.field_ops = 1});
+    AllocScope allocs(state);
     for (auto _ : state) {
         Fp result = a + b;
         benchmark::DoNotOptimize(result);
@@ -39,6 +85,8 @@ static void BM_FieldMultiplication(benchmark::State& state) {
     Fp a = Fp::random();
     Fp b = Fp::random();
 
+    PerfScope perf(state, {.field_ops = 1});
+    AllocScope allocs(state);
     for (auto _ : state) {
         Fp result = a * b;
         benchmark::DoNotOptimize(result);
@@ -52,6 +100,8 @@ static void BM_FieldInversion(benchmark::State& state) {
         a = Fp::random();
     }
 
+    PerfScope perf(state, {.field_ops = 1});
+    AllocScope allocs(state);
     for (auto _ : state) {
         Fp result = a.inv();
         benchmark::DoNotOptimize(result);
@@ -63,6 +113,8 @@ static void BM_FieldExponentiation(benchmark::State& state) {
     Fp base = Fp::random();
     uint256 exp("12345678901234567890");
 
+    PerfScope perf(state, {.field_ops = 1});
+    AllocScope allocs(state);
     for (auto _ : state) {
         Fp result = base.pow(exp);
         benchmark::DoNotOptimize(result);
@@ -78,6 +130,8 @@ static void BM_MatrixMultiplication_5x5(benchmark::State& state) {
     Matrix a = Matrix::random(5, 5);
     Matrix b = Matrix::random(5, 5);
 
+    PerfScope perf(state, {.field_ops = mat_mul_field_ops(5)});
+    AllocScope allocs(state);
     for (auto _ : state) {
         Matrix result = a.mat_mul(b);
         benchmark::DoNotOptimize(result);
@@ -89,6 +143,8 @@ static void BM_MatrixMultiplication_12x12(benchmark::State& state) {
     Matrix a = Matrix::random(12, 12);
     Matrix b = Matrix::random(12, 12);
 
+    PerfScope perf(state, {.field_ops = mat_mul_field_ops(12)});
+    AllocScope allocs(state);
     for (auto _ : state) {
         Matrix result = a.mat_mul(b);
         benchmark::DoNotOptimize(result);
@@ -100,6 +156,8 @@ static void BM_MatrixPow(benchmark::State& state) {
     Matrix a = Matrix::random(5, 5);
     uint64_t exp = 5;  // Alpha = 5
 
+    PerfScope perf(state, {.field_ops = pow5_field_ops(25)});
+    AllocScope allocs(state);
     for (auto _ : state) {
         Matrix result = a.pow(exp);
         benchmark::DoNotOptimize(result);
@@ -121,6 +179,8 @@ static void BM_RescuePermutation_Cipher(benchmark::State& state) {
     }
     Matrix input(input_data);
 
+    PerfScope perf(state, {.permutations = 1});
+    AllocScope allocs(state);
     for (auto _ : state) {
         Matrix result = desc.permute(input);
         benchmark::DoNotOptimize(result);
@@ -137,6 +197,8 @@ static void BM_RescuePermutation_Hash(benchmark::State& state) {
     }
     Matrix input(input_data);
 
+    PerfScope perf(state, {.permutations = 1});
+    AllocScope allocs(state);
     for (auto _ : state) {
         Matrix result = desc.permute(input);
         benchmark::DoNotOptimize(result);
@@ -144,6 +206,34 @@ static void BM_RescuePermutation_Hash(benchmark::State& state) {
 }
 BENCHMARK(BM_RescuePermutation_Hash);
 
+// ============================================================================
+// Kernel Variant Benchmarks
+// ============================================================================
+
+// One permutation with every kernel pinned to a variant. Registered from main
+// for each variant this host can run, so one binary yields the A/B numbers.
+static void BM_KernelVariant(benchmark::State& state, KernelVariant variant, size_t m, bool inverse) {
+    RescueDesc desc = m == RESCUE_HASH_STATE_SIZE ? RescueDesc(m, RESCUE_HASH_CAPACITY)
+                                                  : RescueDesc(std::vector<Fp>(m, Fp(uint64_t{7})));
+    std::vector<Fp> data(m);
+    for (auto& x : data) {
+        x = Fp::random();
+    }
+
+    set_kernel_variant(variant);
+    PerfScope perf(state, {.permutations = 1});
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        if (inverse) {
+            desc.permute_inverse_in_place(data);
+        } else {
+            desc.permute_in_place(data);
+        }
+        benchmark::DoNotOptimize(data.data());
+    }
+    reset_kernel_variants();
+}
+
 // ============================================================================
 // Hash Benchmarks
 // ============================================================================
@@ -152,6 +242,9 @@ static void BM_RescueHash_ShortMessage(benchmark::State& state) {
     RescuePrimeHash hasher;
     std::vector<Fp> msg = {Fp(1), Fp(2), Fp(3)};
 
+    PerfScope perf(state, {.permutations = hash_permutations(msg.size()),
+                          .elements = static_cast<double>(msg.size())});
+    AllocScope allocs(state);
     for (auto _ : state) {
         auto digest = hasher.digest(msg);
         benchmark::DoNotOptimize(digest);
@@ -166,6 +259,9 @@ static void BM_RescueHash_MediumMessage(benchmark::State& state) {
         msg.push_back(Fp(static_cast<uint64_t>(i)));
     }
 
+    PerfScope perf(state, {.permutations = hash_permutations(msg.size()),
+                          .elements = static_cast<double>(msg.size())});
+    AllocScope allocs(state);
     for (auto _ : state) {
         auto digest = hasher.digest(msg);
         benchmark::DoNotOptimize(digest);
@@ -180,6 +276,9 @@ static void BM_RescueHash_LongMessage(benchmark::State& state) {
         msg.push_back(Fp(static_cast<uint64_t>(i)));
     }
 
+    PerfScope perf(state, {.permutations = hash_permutations(msg.size()),
+                          .elements = static_cast<double>(msg.size())});
+    AllocScope allocs(state);
     for (auto _ : state) {
         auto digest = hasher.digest(msg);
         benchmark::DoNotOptimize(digest);
@@ -187,6 +286,198 @@ static void BM_RescueHash_LongMessage(benchmark::State& state) {
 }
 BENCHMARK(BM_RescueHash_LongMessage);
 
+static void BM_CachingHasher_Hit(benchmark::State& state) {
+    CachingHasher hasher(1024);
+    std::vector<Fp> msg;
+    for (int i = 0; i < 20; ++i) {
+        msg.push_back(Fp(static_cast<uint64_t>(i)));
+    }
+    (void)hasher.digest(msg);
+
+    // A hit is a probe: no permutations to normalize by
+    PerfScope perf(state, {});
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        auto digest = hasher.digest(msg);
+        benchmark::DoNotOptimize(digest);
+    }
+}
+BENCHMARK(BM_CachingHasher_Hit);
+
+// ============================================================================
+// Merkle Mountain Range Benchmarks
+// ============================================================================
+
+static void BM_MmrAppend(benchmark::State& state) {
+    MerkleMountainRange mmr;
+    MmrDigest leaf{};
+
+    // One compression per append, amortized
+    PerfScope perf(state, {.permutations = 1});
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        leaf[0] = Fp(mmr.leaf_count());
+        benchmark::DoNotOptimize(mmr.append(leaf));
+    }
+}
+BENCHMARK(BM_MmrAppend);
+
+static void BM_MmrRoot(benchmark::State& state) {
+    MerkleMountainRange mmr;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        mmr.append(MmrDigest{Fp(static_cast<uint64_t>(i))});
+    }
+
+    // One bagging compression per peak
+    PerfScope perf(state, {.permutations = static_cast<double>(std::popcount(mmr.leaf_count()))});
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        auto root = mmr.root();
+        benchmark::DoNotOptimize(root);
+    }
+}
+BENCHMARK(BM_MmrRoot)->Arg(1023)->Arg(1024);
+
+// ============================================================================
+// Merkle Path Verification Benchmarks
+// ============================================================================
+
+// Paths to every other leaf of a 64-leaf tree: they share all upper levels
+static std::vector<MerklePath> make_overlapping_paths(const MerkleVerifier& verifier, MerkleDigest& root) {
+    constexpr size_t DEPTH = 6;
+    std::vector<std::vector<MerkleDigest>> levels(1);
+    for (uint64_t i = 0; i < (uint64_t{1} << DEPTH); ++i) {
+        levels[0].push_back(MerkleDigest{Fp(i)});
+    }
+    for (size_t l = 0; l < DEPTH; ++l) {
+        std::vector<MerkleDigest> up;
+        for (size_t i = 0; i < levels[l].size(); i += 2) {
+            up.push_back(verifier.hash_pair(levels[l][i], levels[l][i + 1]));
+        }
+        levels.push_back(std::move(up));
+    }
+    root = levels.back()[0];
+
+    std::vector<MerklePath> paths;
+    for (uint64_t index = 0; index < levels[0].size(); index += 2) {
+        MerklePath path{levels[0][index], index, {}};
+        for (size_t l = 0; l < DEPTH; ++l) {
+            path.siblings.push_back(levels[l][(index >> l) ^ 1]);
+        }
+        paths.push_back(std::move(path));
+    }
+    return paths;
+}
+
+// Two permutations per hashed pair. The sequential path hashes every pair of
+// every path; the batched one hashes each distinct pair of a level once.
+static double merkle_permutations(std::span<const MerklePath> paths, bool batched) {
+    size_t pairs = 0;
+    std::vector<uint64_t> parents;
+    for (size_t level = 0;; ++level) {
+        parents.clear();
+        for (const auto& path : paths) {
+            if (level < path.siblings.size()) {
+                parents.push_back(path.index >> (level + 1));
+            }
+        }
+        if (parents.empty()) {
+            break;
+        }
+        if (batched) {
+            std::sort(parents.begin(), parents.end());
+            parents.erase(std::unique(parents.begin(), parents.end()), parents.end());
+        }
+        pairs += parents.size();
+    }
+    return 2.0 * static_cast<double>(pairs);
+}
+
+static void BM_MerkleVerify_Sequential(benchmark::State& state) {
+    MerkleVerifier verifier;
+    MerkleDigest root;
+    auto paths = make_overlapping_paths(verifier, root);
+
+    PerfScope perf(state, {.permutations = merkle_permutations(paths, false)});
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        size_t ok = 0;
+        for (const auto& path : paths) {
+            ok += verifier.verify_path(path, root) ? 1 : 0;
+        }
+        benchmark::DoNotOptimize(ok);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * paths.size()));
+}
+BENCHMARK(BM_MerkleVerify_Sequential)->Unit(benchmark::kMillisecond);
+
+static void BM_MerkleVerify_Batched(benchmark::State& state) {
+    MerkleVerifier verifier;
+    MerkleDigest root;
+    auto paths = make_overlapping_paths(verifier, root);
+
+    PerfScope perf(state, {.permutations = merkle_permutations(paths, true)});
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        auto flags = verifier.verify_paths(paths, root);
+        benchmark::DoNotOptimize(flags);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * paths.size()));
+}
+BENCHMARK(BM_MerkleVerify_Batched)->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Goldilocks Benchmarks
+// ============================================================================
+
+static void BM_GoldilocksMultiplication(benchmark::State& state) {
+    std::mt19937_64 rng(1);
+    Goldilocks a(rng());
+    Goldilocks b(rng());
+
+    PerfScope perf(state, {.field_ops = 1});
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(a = a * b);
+    }
+}
+BENCHMARK(BM_GoldilocksMultiplication);
+
+static void BM_GoldilocksPermutation(benchmark::State& state) {
+    BasicRescuePrime<Goldilocks> perm(12, 4, 128);
+    std::mt19937_64 rng(2);
+    std::vector<Goldilocks> data;
+    for (size_t i = 0; i < perm.m(); ++i) {
+        data.emplace_back(rng());
+    }
+
+    PerfScope perf(state, {.permutations = 1});
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        perm.permute_in_place(data);
+        benchmark::DoNotOptimize(data.data());
+    }
+}
+BENCHMARK(BM_GoldilocksPermutation);
+
+static void BM_GoldilocksHash(benchmark::State& state) {
+    GoldilocksRescuePrimeHash hasher;
+    const size_t n = static_cast<size_t>(state.range(0));
+    std::vector<Goldilocks> msg;
+    for (size_t i = 0; i < n; ++i) {
+        msg.emplace_back(uint64_t{i});
+    }
+
+    PerfScope perf(state, {.permutations = hash_permutations(n, hasher.rate()),
+                          .elements = static_cast<double>(n)});
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        auto digest = hasher.digest(msg);
+        benchmark::DoNotOptimize(digest);
+    }
+}
+BENCHMARK(BM_GoldilocksHash)->Arg(3)->Arg(100);
+
 // ============================================================================
 // Cipher Benchmarks
 // ============================================================================
@@ -194,6 +485,8 @@ BENCHMARK(BM_RescueHash_LongMessage);
 static void BM_RescueCipher_Construction(benchmark::State& state) {
     auto secret = random_bytes<32>();
 
+    PerfScope perf(state, {});
+    AllocScope allocs(state);
     for (auto _ : state) {
         RescueCipher cipher(secret);
         benchmark::DoNotOptimize(cipher);
@@ -211,6 +504,9 @@ static void BM_RescueCipher_Encrypt_1Block(benchmark::State& state) {
         plaintext.push_back(Fp::random());
     }
 
+    PerfScope perf(state, {.permutations = ctr_permutations(plaintext.size(), RESCUE_CIPHER_BLOCK_SIZE),
+                          .elements = static_cast<double>(plaintext.size())});
+    AllocScope allocs(state);
     for (auto _ : state) {
         auto ciphertext = cipher.encrypt_raw(plaintext, nonce);
         benchmark::DoNotOptimize(ciphertext);
@@ -228,6 +524,9 @@ static void BM_RescueCipher_Encrypt_10Blocks(benchmark::State& state) {
         plaintext.push_back(Fp::random());
     }
 
+    PerfScope perf(state, {.permutations = ctr_permutations(plaintext.size(), RESCUE_CIPHER_BLOCK_SIZE),
+                          .elements = static_cast<double>(plaintext.size())});
+    AllocScope allocs(state);
     for (auto _ : state) {
         auto ciphertext = cipher.encrypt_raw(plaintext, nonce);
         benchmark::DoNotOptimize(ciphertext);
@@ -246,6 +545,9 @@ static void BM_RescueCipher_Decrypt_1Block(benchmark::State& state) {
     }
     auto ciphertext = cipher.encrypt_raw(plaintext, nonce);
 
+    PerfScope perf(state, {.permutations = ctr_permutations(ciphertext.size(), RESCUE_CIPHER_BLOCK_SIZE),
+                          .elements = static_cast<double>(ciphertext.size())});
+    AllocScope allocs(state);
     for (auto _ : state) {
         auto decrypted = cipher.decrypt_raw(ciphertext, nonce);
         benchmark::DoNotOptimize(decrypted);
@@ -253,6 +555,68 @@ static void BM_RescueCipher_Decrypt_1Block(benchmark::State& state) {
 }
 BENCHMARK(BM_RescueCipher_Decrypt_1Block);
 
+static void BM_RescueCipher_EncryptBlock(benchmark::State& state) {
+    auto secret = random_bytes<32>();
+    RescueCipher cipher(secret);
+
+    RescueCipher::Block block;
+    for (auto& x : block) {
+        x = Fp::random();
+    }
+
+    PerfScope perf(state, {.permutations = 1, .elements = static_cast<double>(RESCUE_CIPHER_BLOCK_SIZE)});
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        auto encrypted = cipher.encrypt_block(block);
+        benchmark::DoNotOptimize(encrypted);
+    }
+}
+BENCHMARK(BM_RescueCipher_EncryptBlock);
+
+static void BM_RescueCipher_DecryptBlock(benchmark::State& state) {
+    auto secret = random_bytes<32>();
+    RescueCipher cipher(secret);
+
+    RescueCipher::Block block;
+    for (auto& x : block) {
+        x = Fp::random();
+    }
+
+    PerfScope perf(state, {.permutations = 1, .elements = static_cast<double>(RESCUE_CIPHER_BLOCK_SIZE)});
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        auto decrypted = cipher.decrypt_block(block);
+        benchmark::DoNotOptimize(decrypted);
+    }
+}
+BENCHMARK(BM_RescueCipher_DecryptBlock);
+
+static void BM_RescueCipher_DecryptBlocks(benchmark::State& state) {
+    auto secret = random_bytes<32>();
+    RescueCipher cipher(secret);
+
+    size_t n_blocks = static_cast<size_t>(state.range(0));
+    std::vector<RescueCipher::Block> blocks(n_blocks);
+    for (auto& block : blocks) {
+        for (auto& x : block) {
+            x = Fp::random();
+        }
+    }
+    std::vector<RescueCipher::Block> out(n_blocks);
+
+    PerfScope perf(state, {.permutations = static_cast<double>(n_blocks),
+                          .elements = static_cast<double>(n_blocks * RESCUE_CIPHER_BLOCK_SIZE)});
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        cipher.decrypt_blocks(blocks, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                           static_cast<int64_t>(n_blocks * RESCUE_CIPHER_BLOCK_SIZE));
+}
+BENCHMARK(BM_RescueCipher_DecryptBlocks)->Arg(64);
+
 // ============================================================================
 // Throughput Benchmarks
 // ============================================================================
@@ -269,6 +633,9 @@ static void BM_RescueCipher_Throughput(benchmark::State& state) {
         plaintext.push_back(Fp::random());
     }
 
+    PerfScope perf(state, {.permutations = ctr_permutations(n_elements, RESCUE_CIPHER_BLOCK_SIZE),
+                          .elements = static_cast<double>(n_elements)});
+    AllocScope allocs(state);
     for (auto _ : state) {
         auto ciphertext = cipher.encrypt_raw(plaintext, nonce);
         benchmark::DoNotOptimize(ciphertext);
@@ -284,6 +651,327 @@ static void BM_RescueCipher_Throughput(benchmark::State& state) {
 }
 BENCHMARK(BM_RescueCipher_Throughput)->Range(1, 1024);
 
+// Throughput per state width: a wider state yields more keystream elements per
+// permutation, so compare elements/sec across BasicRescueCipher<M>.
+template <size_t M>
+static void BM_RescueCipherWidth_Throughput(benchmark::State& state) {
+    auto secret = random_bytes<32>();
+    BasicRescueCipher<M> cipher(secret);
+    auto nonce = generate_nonce();
+
+    size_t n_elements = static_cast<size_t>(state.range(0));
+    std::vector<Fp> plaintext;
+    for (size_t i = 0; i < n_elements; ++i) {
+        plaintext.push_back(Fp::random());
+    }
+
+    PerfScope perf(state, {.permutations = ctr_permutations(n_elements, M),
+                          .elements = static_cast<double>(n_elements)});
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        auto ciphertext = cipher.encrypt_raw(plaintext, nonce);
+        benchmark::DoNotOptimize(ciphertext);
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) *
+                           static_cast<int64_t>(n_elements));
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                           static_cast<int64_t>(n_elements) * 32);
+}
+BENCHMARK_TEMPLATE(BM_RescueCipherWidth_Throughput, 5)->Arg(240);
+BENCHMARK_TEMPLATE(BM_RescueCipherWidth_Throughput, 8)->Arg(240);
+BENCHMARK_TEMPLATE(BM_RescueCipherWidth_Throughput, 12)->Arg(240);
+BENCHMARK_TEMPLATE(BM_RescueCipherWidth_Throughput, 16)->Arg(240);
+
+// ============================================================================
+// Per-Variant Registration
+// ============================================================================
+
+// Runs another benchmark with every kernel pinned to one variant
+static void BM_PinnedVariant(benchmark::State& state, void (*bench)(benchmark::State&), KernelVariant variant) {
+    set_kernel_variant(variant);
+    bench(state);
+    reset_kernel_variants();
+}
+
+// Registers BM_KernelVariant_* and a copy of the permutation, hash, cipher and
+// throughput benchmarks for each variant this host can run, named
+// "<benchmark>/<variant>". The unsuffixed originals use the detected binding.
+static void register_kernel_variant_benchmarks() {
+    using Bench = void (*)(benchmark::State&);
+    static constexpr std::pair<const char*, Bench> PINNED[] = {
+        {"BM_RescuePermutation_Cipher", BM_RescuePermutation_Cipher},
+        {"BM_RescuePermutation_Hash", BM_RescuePermutation_Hash},
+        {"BM_RescueHash_ShortMessage", BM_RescueHash_ShortMessage},
+        {"BM_RescueHash_MediumMessage", BM_RescueHash_MediumMessage},
+        {"BM_RescueHash_LongMessage", BM_RescueHash_LongMessage},
+        {"BM_RescueCipher_Encrypt_1Block", BM_RescueCipher_Encrypt_1Block},
+        {"BM_RescueCipher_Encrypt_10Blocks", BM_RescueCipher_Encrypt_10Blocks},
+        {"BM_RescueCipher_Decrypt_1Block", BM_RescueCipher_Decrypt_1Block},
+    };
+    static constexpr std::pair<const char*, Bench> PINNED_WIDTHS[] = {
+        {"BM_RescueCipherWidth_Throughput<5>", BM_RescueCipherWidth_Throughput<5>},
+        {"BM_RescueCipherWidth_Throughput<8>", BM_RescueCipherWidth_Throughput<8>},
+        {"BM_RescueCipherWidth_Throughput<12>", BM_RescueCipherWidth_Throughput<12>},
+        {"BM_RescueCipherWidth_Throughput<16>", BM_RescueCipherWidth_Throughput<16>},
+    };
+
+    for (size_t v = 0; v < KERNEL_VARIANT_COUNT; ++v) {
+        const auto variant = static_cast<KernelVariant>(v);
+        if (!kernel_variant_available(variant)) {
+            continue;
+        }
+        const std::string suffix = std::string("/") + name(variant);
+        benchmark::RegisterBenchmark(("BM_KernelVariant_Cipher" + suffix).c_str(), BM_KernelVariant, variant,
+                                     RESCUE_CIPHER_BLOCK_SIZE, false);
+        benchmark::RegisterBenchmark(("BM_KernelVariant_CipherInverse" + suffix).c_str(), BM_KernelVariant, variant,
+                                     RESCUE_CIPHER_BLOCK_SIZE, true);
+        benchmark::RegisterBenchmark(("BM_KernelVariant_Hash" + suffix).c_str(), BM_KernelVariant, variant,
+                                     RESCUE_HASH_STATE_SIZE, false);
+
+        for (const auto& [bench_name, bench] : PINNED) {
+            benchmark::RegisterBenchmark((bench_name + suffix).c_str(), BM_PinnedVariant, bench, variant);
+        }
+        benchmark::RegisterBenchmark(("BM_RescueCipher_Throughput" + suffix).c_str(), BM_PinnedVariant,
+                                     BM_RescueCipher_Throughput, variant)
+            ->Range(1, 1024);
+        for (const auto& [bench_name, bench] : PINNED_WIDTHS) {
+            benchmark::RegisterBenchmark((bench_name + suffix).c_str(), BM_PinnedVariant, bench, variant)->Arg(240);
+        }
+    }
+}
+
+// ============================================================================
+// Executor Scalability Benchmarks
+// ============================================================================
+
+// state.range(0) is the worker count. Wall time is what scales, so these use
+// real time; CPU time would only cover the calling thread.
+constexpr size_t EXECUTOR_TASKS = 64;
+
+// One permutation per task: the finest grain the parallel APIs produce.
+static void BM_Executor_Permutations(benchmark::State& state) {
+    WorkStealingExecutor pool(WorkStealingExecutor::Options{.threads = static_cast<size_t>(state.range(0))});
+    RescueDesc desc({Fp(1), Fp(2), Fp(3), Fp(4), Fp(5)});
+    std::vector<Fp> states(EXECUTOR_TASKS * RESCUE_CIPHER_BLOCK_SIZE);
+    for (auto& x : states) {
+        x = Fp::random();
+    }
+
+    PerfScope perf(state, {.permutations = static_cast<double>(EXECUTOR_TASKS)});
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        pool.parallel_for(EXECUTOR_TASKS, [&](size_t i) {
+            desc.permute_in_place(std::span<Fp>(states).subspan(i * RESCUE_CIPHER_BLOCK_SIZE, RESCUE_CIPHER_BLOCK_SIZE));
+        });
+        benchmark::DoNotOptimize(states.data());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * EXECUTOR_TASKS));
+}
+BENCHMARK(BM_Executor_Permutations)->RangeMultiplier(2)->Range(1, 8)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+static void BM_RescueCipher_ParallelEncrypt(benchmark::State& state) {
+    WorkStealingExecutor pool(WorkStealingExecutor::Options{.threads = static_cast<size_t>(state.range(0))});
+    RescueCipher cipher(random_bytes<32>());
+    auto nonce = generate_nonce();
+    const size_t n_elements = EXECUTOR_TASKS * RESCUE_CIPHER_BLOCK_SIZE;
+    std::vector<Fp> plaintext(n_elements);
+    for (auto& x : plaintext) {
+        x = Fp::random();
+    }
+
+    PerfScope perf(state, {.permutations = ctr_permutations(n_elements, RESCUE_CIPHER_BLOCK_SIZE),
+                          .elements = static_cast<double>(n_elements)});
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        auto ciphertext = cipher.encrypt_raw(plaintext, nonce, pool);
+        benchmark::DoNotOptimize(ciphertext);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n_elements));
+}
+BENCHMARK(BM_RescueCipher_ParallelEncrypt)->RangeMultiplier(2)->Range(1, 8)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// Memory Footprint Benchmarks
+// ============================================================================
+
+// Resident set size of the process in bytes, or 0 where /proc is unavailable.
+static size_t resident_bytes() {
+#if defined(__linux__)
+    std::ifstream statm("/proc/self/statm");
+    size_t total_pages = 0;
+    size_t resident_pages = 0;
+    if (statm >> total_pages >> resident_pages) {
+        return resident_pages * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    }
+#endif
+    return 0;
+}
+
+// Hand freed heap back to the OS so that RSS growth reflects the objects
+// being measured rather than memory left over from earlier benchmarks.
+static void release_free_heap() {
+#if defined(__GLIBC__)
+    malloc_trim(0);
+#endif
+}
+
+// Copy constructors are defaulted deep copies of RescueDesc, so this is the
+// cost of handing an existing cipher or hasher to another session.
+static void BM_RescueCipher_Copy(benchmark::State& state) {
+    RescueCipher cipher(random_bytes<32>());
+
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        RescueCipher copy(cipher);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_RescueCipher_Copy);
+
+static void BM_RescuePrimeHash_Copy(benchmark::State& state) {
+    RescuePrimeHash hasher;
+
+    AllocScope allocs(state);
+    for (auto _ : state) {
+        RescuePrimeHash copy(hasher);
+        benchmark::DoNotOptimize(copy);
+    }
+}
+BENCHMARK(BM_RescuePrimeHash_Copy);
+
+// Keep state.range(0) live copies of prototype, as a server keeping one cipher
+// per session does, and report per object:
+//   bytes_per_object   heap bytes requested, including the inline sizeof(T)
+//                      held in the population's own array
+//   allocs_per_object  heap allocations
+//   rss_per_object     resident set growth, i.e. including allocator overhead
+// The time is the cost of building the population, one deep copy per object.
+// Copies stand in for fresh constructions, which cost ~10 ms each (key
+// derivation and constant sampling) and retain the same layout.
+template <typename T>
+static void footprint_benchmark(benchmark::State& state, const T& prototype) {
+    const auto n = static_cast<size_t>(state.range(0));
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        release_free_heap();
+        const size_t rss_before = resident_bytes();
+        const auto allocs_before = rescue::bench::current_alloc_counts();
+        state.ResumeTiming();
+
+        std::vector<T> population;
+        population.reserve(n);
+        for (size_t i = 0; i < n; ++i) {
+            population.push_back(prototype);
+        }
+
+        state.PauseTiming();
+        const auto delta = rescue::bench::current_alloc_counts() - allocs_before;
+        const size_t rss_after = resident_bytes();
+        const double objects = static_cast<double>(n);
+        state.counters["bytes_per_object"] = static_cast<double>(delta.bytes) / objects;
+        state.counters["allocs_per_object"] = static_cast<double>(delta.allocations) / objects;
+        state.counters["rss_per_object"] =
+            rss_after > rss_before ? static_cast<double>(rss_after - rss_before) / objects : 0.0;
+        state.counters["inline_bytes"] = static_cast<double>(sizeof(T));
+        population = {};
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(n));
+}
+
+static void BM_RescueCipher_Footprint(benchmark::State& state) {
+    footprint_benchmark(state, RescueCipher(random_bytes<32>()));
+}
+
+static void BM_RescuePrimeHash_Footprint(benchmark::State& state) {
+    footprint_benchmark(state, RescuePrimeHash());
+}
+
+// Registered from main: populations of 1k, 10k, ... up to --footprint_max
+// objects (default 100k). A million hashers need several GB of memory.
+static void register_footprint_benchmarks(size_t max_objects) {
+    for (auto* bench : {benchmark::RegisterBenchmark("BM_RescueCipher_Footprint", BM_RescueCipher_Footprint),
+                        benchmark::RegisterBenchmark("BM_RescuePrimeHash_Footprint", BM_RescuePrimeHash_Footprint)}) {
+        for (size_t n = 1000; n <= max_objects; n *= 10) {
+            bench->Arg(static_cast<int64_t>(n));
+        }
+        bench->Iterations(1)->Unit(benchmark::kMillisecond);
+    }
+}
+
+// ============================================================================
+// Operation-Count Mode
+// ============================================================================
+
+// Ops per unit of work, measured with OpCountScope (RESCUE_OP_COUNTERS builds).
+static void print_op_counts_row(const std::string& label, const OpCounts& ops, double units) {
+    std::cout << std::left << std::setw(32) << label << std::right << std::fixed
+              << std::setprecision(1);
+    for (uint64_t count : {ops.add, ops.sub, ops.mul, ops.sqr, ops.pow5, ops.inv, ops.pow,
+                           ops.multiplications()}) {
+        std::cout << std::setw(10) << static_cast<double>(count) / units;
+    }
+    std::cout << "\n";
+}
+
+template <size_t M>
+static void print_cipher_element_op_counts(size_t n_elements) {
+    BasicRescueCipher<M> cipher(random_bytes<32>());
+    auto nonce = generate_nonce();
+    std::vector<Fp> plaintext(n_elements, Fp(uint64_t{1}));
+
+    OpCountScope scope;
+    auto ciphertext = cipher.encrypt_raw(plaintext, nonce);
+    benchmark::DoNotOptimize(ciphertext);
+    print_op_counts_row("encrypted element (m=" + std::to_string(M) + ")", scope.counts(),
+                        static_cast<double>(n_elements));
+}
+
+static int report_op_counts() {
+    if (!op_counters_enabled()) {
+        std::cerr << "Operation counts require a build with -DRESCUE_OP_COUNTERS=ON\n";
+        return 1;
+    }
+
+    std::cout << std::left << std::setw(32) << "Ops per" << std::right;
+    for (const char* col : {"add", "sub", "mul", "sqr", "pow5", "inv", "pow", "mul+sqr"}) {
+        std::cout << std::setw(10) << col;
+    }
+    std::cout << "\n" << std::string(112, '-') << "\n";
+
+    {
+        RescueDesc desc({Fp(1), Fp(2), Fp(3), Fp(4), Fp(5)});
+        std::vector<Fp> state(desc.m(), Fp(uint64_t{7}));
+        OpCountScope scope;
+        desc.permute_in_place(state);
+        print_op_counts_row("permutation (cipher, m=5)", scope.counts(), 1.0);
+    }
+    {
+        RescueDesc desc(RESCUE_HASH_STATE_SIZE, RESCUE_HASH_CAPACITY);
+        std::vector<Fp> state(desc.m(), Fp(uint64_t{7}));
+        OpCountScope scope;
+        desc.permute_in_place(state);
+        print_op_counts_row("permutation (hash, m=12)", scope.counts(), 1.0);
+    }
+    {
+        // 10 rate-sized blocks once padded
+        RescuePrimeHash hasher;
+        std::vector<Fp> msg(10 * RESCUE_HASH_RATE - 1, Fp(uint64_t{3}));
+        OpCountScope scope;
+        auto digest = hasher.digest(msg);
+        benchmark::DoNotOptimize(digest);
+        print_op_counts_row("hash block (rate 7)", scope.counts(), hash_permutations(msg.size()));
+    }
+    print_cipher_element_op_counts<5>(240);
+    print_cipher_element_op_counts<8>(240);
+    print_cipher_element_op_counts<12>(240);
+    print_cipher_element_op_counts<16>(240);
+    return 0;
+}
+
 // Custom reporter to capture results
 class JsonReporter : public benchmark::BenchmarkReporter {
 public:
@@ -291,6 +979,8 @@ public:
     
     bool ReportContext(const Context& context) override {
         results["platform"] = "C++";
+        results["perf_counters"] = PerfCounters::status();
+        results["kernels"] = active_kernels();
         results["timestamp"] = []() {
             auto now = std::chrono::system_clock::now();
             auto time = std::chrono::system_clock::to_time_t(now);
@@ -303,17 +993,34 @@ public:
     
     void ReportRuns(const std::vector<Run>& reports) override {
         for (const auto& run : reports) {
+            // Aggregates are recomputed from samples_ns by consumers
+            // (e.g. rescue-bench-compare), so only raw repetitions are kept.
+            if (run.run_type == Run::RT_Aggregate) {
+                continue;
+            }
+
             std::string name = run.benchmark_name();
             // Remove "BM_" prefix for consistency with JS benchmarks
             if (name.substr(0, 3) == "BM_") {
                 name = name.substr(3);
             }
             
-            json bench;
+            // With --benchmark_repetitions each repetition appends a sample;
+            // the mean_* fields summarize all samples seen so far.
+            json& bench = results["benchmarks"][name];
+            // GetAdjustedRealTime() is in the benchmark's display unit
+            bench["samples_ns"].push_back(run.GetAdjustedRealTime() * 1e9 /
+                                          benchmark::GetTimeUnitMultiplier(run.time_unit));
+            double mean_ns = 0.0;
+            for (const auto& sample : bench["samples_ns"]) {
+                mean_ns += sample.get<double>();
+            }
+            mean_ns /= static_cast<double>(bench["samples_ns"].size());
+
             bench["iterations"] = run.iterations;
-            bench["mean_ns"] = run.GetAdjustedRealTime();
-            bench["mean_us"] = run.GetAdjustedRealTime() / 1000.0;
-            bench["mean_ms"] = run.GetAdjustedRealTime() / 1000000.0;
+            bench["mean_ns"] = mean_ns;
+            bench["mean_us"] = mean_ns / 1000.0;
+            bench["mean_ms"] = mean_ns / 1000000.0;
             
             if (run.counters.count("items_per_second")) {
                 bench["elements_per_second"] = run.counters.at("items_per_second").value;
@@ -321,11 +1028,43 @@ public:
             if (run.counters.count("bytes_per_second")) {
                 bench["megabytes_per_second"] = run.counters.at("bytes_per_second").value / (1024.0 * 1024.0);
             }
-            
-            results["benchmarks"][name] = bench;
+
+            // Hardware counters (per iteration, IPC and normalized per unit of work)
+            json perf;
+            for (const auto& [counter_name, counter] : run.counters) {
+                if (is_perf_counter(counter_name)) {
+                    perf[counter_name] = counter.value;
+                }
+            }
+            if (!perf.empty()) {
+                bench["perf"] = perf;
+            }
+
+            // Heap allocations per iteration (see alloc_counter.hpp)
+            if (run.counters.count("allocs_per_op")) {
+                bench["allocs_per_op"] = run.counters.at("allocs_per_op").value;
+                bench["bytes_per_op"] = run.counters.at("bytes_per_op").value;
+            }
+
+            // Per-object memory of the *_Footprint populations
+            if (run.counters.count("bytes_per_object")) {
+                for (const char* key : {"bytes_per_object", "allocs_per_object", "rss_per_object", "inline_bytes"}) {
+                    bench["footprint"][key] = run.counters.at(key).value;
+                }
+            }
         }
     }
     
+    static bool is_perf_counter(std::string_view name) {
+        for (const char* event : PerfCounters::EVENT_NAMES) {
+            if (name == event) {
+                return true;
+            }
+        }
+        return name == "ipc" || name.starts_with("cycles_per_") ||
+               name.starts_with("instructions_per_");
+    }
+
     void Finalize() override {
         std::ofstream file("benchmark_results_cpp.json");
         file << results.dump(2);
@@ -335,6 +1074,39 @@ public:
 };
 
 int main(int argc, char** argv) {
+    // --hw_counters enables perf_event_open counters, --op_counts prints
+    // field operations per unit of work and --footprint_max=<n> sets the
+    // largest footprint population; strip them before Google Benchmark
+    // parses the remaining flags.
+    bool hw_counters = false;
+    bool op_counts = false;
+    size_t footprint_max = 100000;
+    int kept = 1;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg(argv[i]);
+        if (arg == "--hw_counters") {
+            hw_counters = true;
+        } else if (arg == "--op_counts") {
+            op_counts = true;
+        } else if (arg.starts_with("--footprint_max=")) {
+            footprint_max = std::stoul(std::string(arg.substr(16)));
+        } else {
+            argv[kept++] = argv[i];
+        }
+    }
+    argc = kept;
+
+    if (op_counts) {
+        return report_op_counts();
+    }
+
+    if (hw_counters && !PerfCounters::enable()) {
+        std::cerr << "Hardware counters " << PerfCounters::status()
+                  << "; reporting wall time only\n";
+    }
+
+    register_footprint_benchmarks(footprint_max);
+    register_kernel_variant_benchmarks();
     benchmark::Initialize(&argc, argv);
     if (benchmark::ReportUnrecognizedArguments(argc, argv)) return 1;
     
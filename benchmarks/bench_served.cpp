@@ -0,0 +1,283 @@
+/**
+ * @file bench_served.cpp
+ * @brief bench_served: in-process ciphers vs rescue-served over loopback.
+ *
+ * Usage:
+ *   bench_served [options]
+ *
+ * N client threads each stand in for one worker process and issue
+ * back-to-back requests, each under a key drawn from a shared pool, for the
+ * same duration in two modes:
+ *
+ *   per-process  every client keeps its own cache of RescueCipher objects,
+ *                as separate processes would, so each key is expanded once
+ *                per client
+ *   daemon       every client talks to one in-process rescue-served over a
+ *                Unix socket; keys are expanded once and requests coalesce
+ *
+ * The daemon pays a socket round trip per request and wins when key setup
+ * dominates: many keys, many processes, short-lived processes.
+ *
+ * Options:
+ *   --threads=<n>    Client threads (default 8)
+ *   --keys=<n>       Distinct shared secrets (default 64)
+ *   --elements=<n>   Field elements per request (default 5)
+ *   --duration=<s>   Seconds per mode (default 3)
+ *   --op=<op>        encrypt or hash (default encrypt)
+ *   --workers=<n>    Daemon worker threads (default 2)
+ *   --batch=<n>      Daemon max jobs per batch (default 64)
+ *   --output=<file>  JSON results (default bench_served_results.json)
+ *
+ * Exit status: 0 on success, 1 on failure, 2 on usage error.
+ */
+
+#include <rescue/served/client.hpp>
+#include <rescue/served/server.hpp>
+
+#include <rescue/rescue.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <optional>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+using json = nlohmann::ordered_json;
+using namespace rescue;
+using namespace rescue::served;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+struct Options {
+    size_t threads = 8;
+    size_t keys = 64;
+    size_t elements = 5;
+    double duration_s = 3.0;
+    bool hash = false;
+    size_t workers = 2;
+    size_t batch = 64;
+    std::string output = "bench_served_results.json";
+};
+
+struct ModeResult {
+    uint64_t ops = 0;
+    uint64_t key_expansions = 0;
+    double elapsed_s = 0;
+};
+
+std::vector<Secret> make_secrets(size_t n) {
+    std::mt19937_64 rng(42);
+    std::vector<Secret> secrets(n);
+    for (auto& s : secrets) {
+        for (auto& b : s) {
+            b = static_cast<uint8_t>(rng());
+        }
+    }
+    return secrets;
+}
+
+/**
+ * @brief Run `threads` closed-loop clients for the configured duration.
+ * @param make_client Called once per client thread; returns a callable that
+ *        issues one request under the given key index.
+ */
+template <typename MakeClient>
+ModeResult run_mode(const Options& opts, MakeClient make_client) {
+    std::atomic<bool> go{false};
+    std::atomic<bool> stop{false};
+    std::vector<uint64_t> ops(opts.threads);
+    std::vector<std::thread> threads;
+
+    for (size_t t = 0; t < opts.threads; ++t) {
+        threads.emplace_back([&, t] {
+            auto request = make_client(t);
+            std::mt19937_64 rng(t + 1);
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            uint64_t n = 0;
+            while (!stop.load(std::memory_order_relaxed)) {
+                request(rng() % opts.keys);
+                ++n;
+            }
+            ops[t] = n;
+        });
+    }
+
+    auto start = Clock::now();
+    go.store(true);
+    std::this_thread::sleep_for(std::chrono::duration<double>(opts.duration_s));
+    stop.store(true);
+    for (auto& th : threads) {
+        th.join();
+    }
+
+    ModeResult r;
+    r.elapsed_s = std::chrono::duration<double>(Clock::now() - start).count();
+    for (uint64_t n : ops) {
+        r.ops += n;
+    }
+    return r;
+}
+
+json to_json(const ModeResult& r, const Options& opts) {
+    double ops_per_s = static_cast<double>(r.ops) / r.elapsed_s;
+    return {{"ops", r.ops},
+            {"ops_per_second", ops_per_s},
+            {"elements_per_second", ops_per_s * static_cast<double>(opts.elements)},
+            {"mean_latency_us", 1e6 * r.elapsed_s * static_cast<double>(opts.threads) / static_cast<double>(r.ops)},
+            {"key_expansions", r.key_expansions}};
+}
+
+void print_usage() {
+    std::cerr << "usage: bench_served [--threads=<n>] [--keys=<n>] [--elements=<n>] [--duration=<s>] "
+                 "[--op=encrypt|hash] [--workers=<n>] [--batch=<n>] [--output=<file>]\n";
+}
+
+Options parse_args(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg(argv[i]);
+        auto value = [&](std::string_view flag) -> std::optional<std::string> {
+            if (arg.starts_with(flag)) {
+                return std::string(arg.substr(flag.size()));
+            }
+            return std::nullopt;
+        };
+        if (auto v = value("--threads=")) {
+            opts.threads = std::stoul(*v);
+        } else if (auto v = value("--keys=")) {
+            opts.keys = std::stoul(*v);
+        } else if (auto v = value("--elements=")) {
+            opts.elements = std::stoul(*v);
+        } else if (auto v = value("--duration=")) {
+            opts.duration_s = std::stod(*v);
+        } else if (auto v = value("--op=")) {
+            if (*v != "encrypt" && *v != "hash") {
+                throw std::invalid_argument("unknown op " + *v);
+            }
+            opts.hash = *v == "hash";
+        } else if (auto v = value("--workers=")) {
+            opts.workers = std::stoul(*v);
+        } else if (auto v = value("--batch=")) {
+            opts.batch = std::stoul(*v);
+        } else if (auto v = value("--output=")) {
+            opts.output = *v;
+        } else {
+            throw std::invalid_argument("unknown option " + std::string(arg));
+        }
+    }
+    if (opts.threads == 0 || opts.keys == 0 || opts.elements == 0 || opts.duration_s <= 0) {
+        throw std::invalid_argument("threads, keys, elements and duration must be positive");
+    }
+    return opts;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    try {
+        opts = parse_args(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << "bench_served: " << e.what() << "\n";
+        print_usage();
+        return 2;
+    }
+
+    const auto secrets = make_secrets(opts.keys);
+    const Nonce nonce{};
+    std::vector<Fp> message;
+    for (size_t i = 0; i < opts.elements; ++i) {
+        message.push_back(Fp(uint64_t{i + 1}));
+    }
+
+    std::printf("%zu clients, %zu keys, %zu-element %s requests, %.1f s per mode\n\n", opts.threads, opts.keys,
+                opts.elements, opts.hash ? "hash" : "encrypt", opts.duration_s);
+
+    try {
+        // Per-process: private cipher caches, no IPC
+        std::atomic<uint64_t> expansions{0};
+        ModeResult local = run_mode(opts, [&](size_t) {
+            return [&, ciphers = std::map<size_t, RescueCipher>(), hasher = RescuePrimeHash(),
+                    sink = Fp()](size_t key) mutable {
+                if (opts.hash) {
+                    sink += hasher.digest(message).front();
+                    return;
+                }
+                auto it = ciphers.find(key);
+                if (it == ciphers.end()) {
+                    it = ciphers.emplace(key, RescueCipher(secrets[key])).first;
+                    ++expansions;
+                }
+                sink += it->second.encrypt_raw(message, nonce).front();
+            };
+        });
+        local.key_expansions = expansions.load();
+
+        // Daemon: one shared server, one connection per client
+        ServerOptions server_opts;
+        server_opts.socket_path = "/tmp/bench_served_" + std::to_string(::getpid()) + ".sock";
+        server_opts.workers = opts.workers;
+        server_opts.max_batch = opts.batch;
+        server_opts.cache_capacity = std::max<size_t>(opts.keys, 1);
+        Server server(server_opts);
+        ModeResult daemon = run_mode(opts, [&](size_t) {
+            return [&, client = Client(server_opts.socket_path)](size_t key) mutable {
+                if (opts.hash) {
+                    (void)client.hash(message);
+                } else {
+                    (void)client.encrypt(secrets[key], nonce, message);
+                }
+            };
+        });
+        server.stop();
+        ServerStats stats = server.stats();
+        daemon.key_expansions = stats.cache_misses;
+
+        json results = {{"config",
+                         {{"threads", opts.threads},
+                          {"keys", opts.keys},
+                          {"elements", opts.elements},
+                          {"op", opts.hash ? "hash" : "encrypt"},
+                          {"duration_s", opts.duration_s},
+                          {"workers", opts.workers},
+                          {"max_batch", opts.batch}}},
+                        {"per_process", to_json(local, opts)},
+                        {"daemon", to_json(daemon, opts)}};
+        double jobs_per_batch =
+            stats.batches > 0 ? static_cast<double>(stats.jobs) / static_cast<double>(stats.batches) : 0.0;
+        results["daemon"]["jobs_per_batch"] = jobs_per_batch;
+        results["daemon"]["overloaded"] = stats.overloaded;
+
+        for (const char* mode : {"per_process", "daemon"}) {
+            const json& r = results[mode];
+            std::printf("  %-12s %12.0f ops/s %10.1f us mean %8llu key expansions\n", mode,
+                        r["ops_per_second"].get<double>(), r["mean_latency_us"].get<double>(),
+                        static_cast<unsigned long long>(r["key_expansions"].get<uint64_t>()));
+        }
+        std::printf("\n  daemon: %.1f jobs per batch, %llu overloaded\n", jobs_per_batch,
+                    static_cast<unsigned long long>(stats.overloaded));
+
+        std::ofstream file(opts.output);
+        file << results.dump(2);
+        std::printf("Results saved to %s\n", opts.output.c_str());
+    } catch (const std::exception& e) {
+        std::cerr << "bench_served: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
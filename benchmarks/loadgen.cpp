@@ -0,0 +1,556 @@
+/**
+ * @file loadgen.cpp
+ * @brief rescue-loadgen: open-loop tail-latency load generator.
+ *
+ * Usage:
+ *   rescue-loadgen [options]
+ *
+ * N client threads issue a weighted mix of cipher construction, encrypt,
+ * decrypt and hash operations. In open-loop mode each client follows its own
+ * arrival schedule (rate / threads ops/s) and latency is measured from the
+ * scheduled start, so time spent queued behind a slow operation counts
+ * against the request instead of silently lowering the offered load. Service
+ * time (from actual start) is recorded separately. A rate of 0 runs closed
+ * loop: every client issues back-to-back, which measures saturation
+ * throughput.
+ *
+ * Options:
+ *   --threads=<n>        Client threads (default 4)
+ *   --rate=<r>[,<r>...]  Target total ops/s per step, 0 = closed loop
+ *                        (default 0); several rates run as a sweep
+ *   --duration=<s>       Measured seconds per step (default 10)
+ *   --warmup=<s>         Unmeasured seconds before each step (default 1)
+ *   --mix=<op>:<w>,...   Operation weights over construct, encrypt, decrypt,
+ *                        hash (default construct:2,encrypt:44,decrypt:44,hash:10)
+ *   --sizes=<n>:<w>,...  Message length in field elements with weights
+ *                        (default 1:30,4:30,16:20,64:15,256:4,1024:1)
+ *   --arrival=<kind>     poisson or uniform inter-arrival times (default poisson)
+ *   --seed=<n>           RNG seed (default 1)
+ *   --output=<file>      JSON results (default loadgen_results.json)
+ *
+ * Exit status: 0 on success, 2 on usage error.
+ */
+
+#include <rescue/rescue.hpp>
+
+#include <nlohmann/json.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+using json = nlohmann::json;
+using namespace rescue;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// ============================================================================
+// Latency histogram
+// ============================================================================
+
+/**
+ * @brief Log-linear latency histogram in the style of HdrHistogram.
+ *
+ * Values below 2^SUB_BUCKET_BITS ns are exact; above that every power of two
+ * is split into 2^SUB_BUCKET_BITS linear sub-buckets, so the relative error
+ * of any recorded value is below 1%. Histograms merge by adding counts.
+ */
+class LatencyHistogram {
+public:
+    static constexpr unsigned SUB_BUCKET_BITS = 7;
+    static constexpr uint64_t SUB_BUCKETS = uint64_t{1} << SUB_BUCKET_BITS;
+    static constexpr unsigned MAX_SHIFT = 40;  // Covers ~2^47 ns, about 39 hours
+
+    LatencyHistogram() : counts_((MAX_SHIFT + 1) * SUB_BUCKETS, 0) {}
+
+    void record(uint64_t ns) {
+        ++counts_[index(ns)];
+        ++total_;
+        sum_ += ns;
+        min_ = std::min(min_, ns);
+        max_ = std::max(max_, ns);
+    }
+
+    void merge(const LatencyHistogram& o) {
+        for (size_t i = 0; i < counts_.size(); ++i) {
+            counts_[i] += o.counts_[i];
+        }
+        total_ += o.total_;
+        sum_ += o.sum_;
+        min_ = std::min(min_, o.min_);
+        max_ = std::max(max_, o.max_);
+    }
+
+    [[nodiscard]] uint64_t count() const { return total_; }
+    [[nodiscard]] uint64_t max() const { return total_ == 0 ? 0 : max_; }
+    [[nodiscard]] uint64_t min() const { return total_ == 0 ? 0 : min_; }
+    [[nodiscard]] double mean() const {
+        return total_ == 0 ? 0.0 : static_cast<double>(sum_) / static_cast<double>(total_);
+    }
+
+    /**
+     * @brief Value at quantile q in [0, 1], reported as the upper bound of
+     *        its bucket (clamped to the recorded maximum).
+     */
+    [[nodiscard]] uint64_t percentile(double q) const {
+        if (total_ == 0) {
+            return 0;
+        }
+        auto rank = static_cast<uint64_t>(std::ceil(q * static_cast<double>(total_)));
+        rank = std::clamp<uint64_t>(rank, 1, total_);
+        uint64_t seen = 0;
+        for (size_t i = 0; i < counts_.size(); ++i) {
+            seen += counts_[i];
+            if (seen >= rank) {
+                return std::min(upper_bound(i), max_);
+            }
+        }
+        return max_;
+    }
+
+    [[nodiscard]] json to_json() const {
+        return {{"count", count()},          {"min", min()},
+                {"mean", mean()},            {"p50", percentile(0.50)},
+                {"p90", percentile(0.90)},   {"p99", percentile(0.99)},
+                {"p999", percentile(0.999)}, {"max", max()}};
+    }
+
+private:
+    std::vector<uint64_t> counts_;
+    uint64_t total_ = 0;
+    uint64_t sum_ = 0;
+    uint64_t min_ = UINT64_MAX;
+    uint64_t max_ = 0;
+
+    static size_t index(uint64_t ns) {
+        if (ns < SUB_BUCKETS) {
+            return static_cast<size_t>(ns);
+        }
+        unsigned shift = static_cast<unsigned>(std::bit_width(ns)) - 1 - SUB_BUCKET_BITS;
+        if (shift >= MAX_SHIFT) {
+            return static_cast<size_t>((MAX_SHIFT + 1) * SUB_BUCKETS - 1);
+        }
+        uint64_t sub = (ns >> shift) - SUB_BUCKETS;
+        return static_cast<size_t>((shift + 1) * SUB_BUCKETS + sub);
+    }
+
+    static uint64_t upper_bound(size_t i) {
+        if (i < SUB_BUCKETS) {
+            return i;
+        }
+        uint64_t shift = i / SUB_BUCKETS - 1;
+        uint64_t mantissa = i % SUB_BUCKETS + SUB_BUCKETS;
+        return ((mantissa + 1) << shift) - 1;
+    }
+};
+
+// ============================================================================
+// Workload
+// ============================================================================
+
+enum Op : size_t { CONSTRUCT, ENCRYPT, DECRYPT, HASH, NUM_OPS };
+constexpr std::array<const char*, NUM_OPS> OP_NAMES = {"construct", "encrypt", "decrypt", "hash"};
+
+struct Options {
+    size_t threads = 4;
+    std::vector<double> rates = {0.0};
+    double duration_s = 10.0;
+    double warmup_s = 1.0;
+    std::array<double, NUM_OPS> mix = {2, 44, 44, 10};
+    std::vector<std::pair<size_t, double>> sizes = {{1, 30}, {4, 30}, {16, 20},
+                                                    {64, 15}, {256, 4}, {1024, 1}};
+    bool poisson = true;
+    uint64_t seed = 1;
+    std::string output = "loadgen_results.json";
+};
+
+/**
+ * @brief Everything one client touches, prepared before the clock starts so
+ *        that input generation is not part of the measured latency.
+ */
+struct ClientState {
+    std::vector<RescueCipher> ciphers;  // Session pool for encrypt/decrypt
+    std::vector<std::array<uint8_t, 32>> secrets;
+    std::vector<std::vector<Fp>> messages;  // One per entry in Options::sizes
+    std::array<uint8_t, 16> nonce{};
+    RescuePrimeHash hasher;
+    std::mt19937_64 rng;
+
+    std::array<LatencyHistogram, NUM_OPS> latency;
+    std::array<LatencyHistogram, NUM_OPS> service;
+    uint64_t elements = 0;
+    uint64_t late_starts = 0;  // Operations started more than 1 ms behind schedule
+    uint64_t dropped = 0;      // Scheduled operations abandoned at the backlog limit
+    Clock::time_point last_done;
+    Fp sink;                   // Keeps results observable
+};
+
+constexpr size_t SESSIONS_PER_CLIENT = 8;
+
+void prepare_client(ClientState& c, const Options& opts, uint64_t seed) {
+    c.rng.seed(seed);
+    for (size_t i = 0; i < SESSIONS_PER_CLIENT; ++i) {
+        std::array<uint8_t, 32> secret{};
+        for (auto& b : secret) {
+            b = static_cast<uint8_t>(c.rng());
+        }
+        c.secrets.push_back(secret);
+        c.ciphers.emplace_back(secret);
+    }
+    for (auto& b : c.nonce) {
+        b = static_cast<uint8_t>(c.rng());
+    }
+    for (const auto& [length, weight] : opts.sizes) {
+        std::vector<Fp> msg;
+        msg.reserve(length);
+        for (size_t i = 0; i < length; ++i) {
+            msg.push_back(Fp(uint64_t{c.rng()}));
+        }
+        c.messages.push_back(std::move(msg));
+    }
+}
+
+/**
+ * @brief Run one operation; returns the number of field elements processed.
+ */
+size_t run_op(ClientState& c, Op op, size_t size_index) {
+    const std::vector<Fp>& msg = c.messages[size_index];
+    switch (op) {
+        case CONSTRUCT: {
+            // Key derivation allocates and hashes, so this cannot be elided
+            RescueCipher fresh(c.secrets[c.rng() % c.secrets.size()]);
+            return 0;
+        }
+        case ENCRYPT: {
+            const RescueCipher& cipher = c.ciphers[c.rng() % c.ciphers.size()];
+            c.sink += cipher.encrypt_raw(msg, c.nonce).back();
+            return msg.size();
+        }
+        case DECRYPT: {
+            const RescueCipher& cipher = c.ciphers[c.rng() % c.ciphers.size()];
+            c.sink += cipher.decrypt_raw(msg, c.nonce).back();
+            return msg.size();
+        }
+        case HASH:
+            c.sink += c.hasher.digest(msg)[0];
+            return msg.size();
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Client loop for one step.
+ *
+ * With rate > 0 operations are issued on a fixed schedule; the next intended
+ * start is advanced regardless of how long the previous operation took. An
+ * overloaded client stops issuing once it is a full step duration behind and
+ * counts the rest of its schedule as dropped.
+ */
+void run_client(ClientState& c, const Options& opts, double client_rate, Clock::time_point start,
+                Clock::time_point measure_from, Clock::time_point end) {
+    Clock::time_point give_up = end + (end - measure_from);
+    std::discrete_distribution<size_t> op_dist(opts.mix.begin(), opts.mix.end());
+    std::vector<double> size_weights;
+    for (const auto& [length, weight] : opts.sizes) {
+        size_weights.push_back(weight);
+    }
+    std::discrete_distribution<size_t> size_dist(size_weights.begin(), size_weights.end());
+    std::exponential_distribution<double> poisson_gap(client_rate > 0 ? client_rate : 1.0);
+
+    auto next_gap = [&] {
+        double seconds = opts.poisson ? poisson_gap(c.rng) : 1.0 / client_rate;
+        return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(seconds));
+    };
+
+    bool open_loop = client_rate > 0;
+    Clock::time_point intended = open_loop ? start + next_gap() : start;
+    while (intended < end) {
+        if (open_loop && Clock::now() >= give_up) {
+            for (; intended < end; intended += next_gap()) {
+                c.dropped += intended >= measure_from ? 1 : 0;
+            }
+            break;
+        }
+        if (open_loop) {
+            std::this_thread::sleep_until(intended);
+        }
+        auto op = static_cast<Op>(op_dist(c.rng));
+        size_t size_index = size_dist(c.rng);
+
+        Clock::time_point actual = Clock::now();
+        if (!open_loop) {
+            intended = actual;
+        }
+        size_t elements = run_op(c, op, size_index);
+        Clock::time_point done = Clock::now();
+
+        if (intended >= measure_from) {
+            auto latency = std::chrono::duration_cast<std::chrono::nanoseconds>(done - intended);
+            auto service = std::chrono::duration_cast<std::chrono::nanoseconds>(done - actual);
+            c.latency[op].record(static_cast<uint64_t>(latency.count()));
+            c.service[op].record(static_cast<uint64_t>(service.count()));
+            c.elements += elements;
+            if (actual - intended > std::chrono::milliseconds(1)) {
+                ++c.late_starts;
+            }
+            c.last_done = done;
+        }
+
+        intended = open_loop ? intended + next_gap() : done;
+    }
+}
+
+// ============================================================================
+// Steps and reporting
+// ============================================================================
+
+json run_step(const Options& opts, double rate) {
+    std::vector<ClientState> clients(opts.threads);
+    for (size_t t = 0; t < opts.threads; ++t) {
+        prepare_client(clients[t], opts, opts.seed * 1000003 + t);
+    }
+
+    auto warmup = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(opts.warmup_s));
+    auto duration = std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double>(opts.duration_s));
+    // Short delay so every client starts on the same schedule
+    Clock::time_point start = Clock::now() + std::chrono::milliseconds(20);
+    Clock::time_point measure_from = start + warmup;
+    Clock::time_point end = measure_from + duration;
+
+    double client_rate = rate / static_cast<double>(opts.threads);
+    std::vector<std::thread> workers;
+    workers.reserve(opts.threads);
+    for (auto& c : clients) {
+        workers.emplace_back(run_client, std::ref(c), std::cref(opts), client_rate, start, measure_from, end);
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    std::array<LatencyHistogram, NUM_OPS> latency;
+    std::array<LatencyHistogram, NUM_OPS> service;
+    LatencyHistogram all_latency;
+    LatencyHistogram all_service;
+    uint64_t elements = 0;
+    uint64_t late_starts = 0;
+    uint64_t dropped = 0;
+    Clock::time_point last_done = end;
+    for (const auto& c : clients) {
+        for (size_t op = 0; op < NUM_OPS; ++op) {
+            latency[op].merge(c.latency[op]);
+            service[op].merge(c.service[op]);
+            all_latency.merge(c.latency[op]);
+            all_service.merge(c.service[op]);
+        }
+        elements += c.elements;
+        late_starts += c.late_starts;
+        dropped += c.dropped;
+        last_done = std::max(last_done, c.last_done);
+    }
+
+    // An overloaded open-loop step finishes its backlog after `end`; dividing
+    // by the time actually taken gives the throughput the library sustained.
+    double elapsed_s = std::chrono::duration<double>(last_done - measure_from).count();
+
+    double ops = static_cast<double>(all_latency.count());
+    json step = {
+        {"target_rate", rate},
+        {"mode", rate > 0 ? "open_loop" : "closed_loop"},
+        {"duration_s", opts.duration_s},
+        {"elapsed_s", elapsed_s},
+        {"operations", all_latency.count()},
+        {"dropped", dropped},
+        {"achieved_rate", ops / elapsed_s},
+        {"elements_per_second", static_cast<double>(elements) / elapsed_s},
+        {"late_start_fraction", ops > 0 ? static_cast<double>(late_starts) / ops : 0.0},
+    };
+    step["latency_ns"]["all"] = all_latency.to_json();
+    step["service_ns"]["all"] = all_service.to_json();
+    for (size_t op = 0; op < NUM_OPS; ++op) {
+        if (latency[op].count() > 0) {
+            step["latency_ns"][OP_NAMES[op]] = latency[op].to_json();
+            step["service_ns"][OP_NAMES[op]] = service[op].to_json();
+        }
+    }
+    return step;
+}
+
+std::string format_us(uint64_t ns) {
+    char buf[32];
+    std::snprintf(buf, sizeof(buf), "%.1f", static_cast<double>(ns) / 1000.0);
+    return buf;
+}
+
+void print_step(const json& step) {
+    double target = step["target_rate"];
+    std::printf("\n%s, target %s, achieved %.0f ops/s (%.0f elements/s), late starts %.2f%%, dropped %llu\n",
+                step["mode"].get<std::string>().c_str(),
+                target > 0 ? (std::to_string(static_cast<uint64_t>(target)) + " ops/s").c_str() : "unbounded",
+                step["achieved_rate"].get<double>(), step["elements_per_second"].get<double>(),
+                100.0 * step["late_start_fraction"].get<double>(),
+                static_cast<unsigned long long>(step["dropped"].get<uint64_t>()));
+    std::printf("%-10s %10s %10s %10s %10s %10s %10s\n", "op", "count", "p50 us", "p99 us",
+                "p99.9 us", "max us", "svc p99.9");
+    for (const auto& [name, h] : step["latency_ns"].items()) {
+        const json& s = step["service_ns"][name];
+        std::printf("%-10s %10llu %10s %10s %10s %10s %10s\n", name.c_str(),
+                    static_cast<unsigned long long>(h["count"].get<uint64_t>()),
+                    format_us(h["p50"]).c_str(), format_us(h["p99"]).c_str(),
+                    format_us(h["p999"]).c_str(), format_us(h["max"]).c_str(),
+                    format_us(s["p999"]).c_str());
+    }
+}
+
+// ============================================================================
+// Command line
+// ============================================================================
+
+std::vector<std::string> split(std::string_view s, char sep) {
+    std::vector<std::string> parts;
+    size_t pos = 0;
+    while (pos <= s.size()) {
+        size_t next = s.find(sep, pos);
+        if (next == std::string_view::npos) {
+            next = s.size();
+        }
+        parts.emplace_back(s.substr(pos, next - pos));
+        pos = next + 1;
+    }
+    return parts;
+}
+
+void print_usage() {
+    std::cerr << "usage: rescue-loadgen [--threads=<n>] [--rate=<r>[,<r>...]] [--duration=<s>]\n"
+                 "                      [--warmup=<s>] [--mix=<op>:<w>,...] [--sizes=<n>:<w>,...]\n"
+                 "                      [--arrival=poisson|uniform] [--seed=<n>] [--output=<file>]\n";
+}
+
+Options parse_args(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg(argv[i]);
+        auto value = [&](std::string_view flag) -> std::optional<std::string> {
+            if (arg.starts_with(flag)) {
+                return std::string(arg.substr(flag.size()));
+            }
+            return std::nullopt;
+        };
+        if (auto v = value("--threads=")) {
+            opts.threads = std::stoul(*v);
+        } else if (auto v = value("--rate=")) {
+            opts.rates.clear();
+            for (const auto& r : split(*v, ',')) {
+                opts.rates.push_back(std::stod(r));
+            }
+        } else if (auto v = value("--duration=")) {
+            opts.duration_s = std::stod(*v);
+        } else if (auto v = value("--warmup=")) {
+            opts.warmup_s = std::stod(*v);
+        } else if (auto v = value("--mix=")) {
+            opts.mix = {};
+            for (const auto& entry : split(*v, ',')) {
+                auto kv = split(entry, ':');
+                auto it = std::find(OP_NAMES.begin(), OP_NAMES.end(), kv[0]);
+                if (kv.size() != 2 || it == OP_NAMES.end()) {
+                    throw std::invalid_argument("bad --mix entry " + entry);
+                }
+                opts.mix[static_cast<size_t>(it - OP_NAMES.begin())] = std::stod(kv[1]);
+            }
+        } else if (auto v = value("--sizes=")) {
+            opts.sizes.clear();
+            for (const auto& entry : split(*v, ',')) {
+                auto kv = split(entry, ':');
+                if (kv.size() != 2) {
+                    throw std::invalid_argument("bad --sizes entry " + entry);
+                }
+                opts.sizes.emplace_back(std::stoul(kv[0]), std::stod(kv[1]));
+            }
+        } else if (auto v = value("--arrival=")) {
+            if (*v != "poisson" && *v != "uniform") {
+                throw std::invalid_argument("--arrival must be poisson or uniform");
+            }
+            opts.poisson = *v == "poisson";
+        } else if (auto v = value("--seed=")) {
+            opts.seed = std::stoull(*v);
+        } else if (auto v = value("--output=")) {
+            opts.output = *v;
+        } else {
+            throw std::invalid_argument("unknown option " + std::string(arg));
+        }
+    }
+
+    double mix_total = 0;
+    for (double w : opts.mix) {
+        mix_total += w < 0 ? -1e300 : w;
+    }
+    double size_total = 0;
+    for (const auto& [length, weight] : opts.sizes) {
+        size_total += (length == 0 || weight < 0) ? -1e300 : weight;
+    }
+    if (opts.threads == 0 || opts.duration_s <= 0 || opts.warmup_s < 0 || mix_total <= 0 ||
+        size_total <= 0) {
+        throw std::invalid_argument("threads, duration, mix and sizes must be positive");
+    }
+    for (double r : opts.rates) {
+        if (r < 0) {
+            throw std::invalid_argument("rates must be non-negative");
+        }
+    }
+    return opts;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    try {
+        opts = parse_args(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << "rescue-loadgen: " << e.what() << "\n";
+        print_usage();
+        return 2;
+    }
+
+    json config = {{"threads", opts.threads},
+                   {"duration_s", opts.duration_s},
+                   {"warmup_s", opts.warmup_s},
+                   {"arrival", opts.poisson ? "poisson" : "uniform"},
+                   {"seed", opts.seed}};
+    for (size_t op = 0; op < NUM_OPS; ++op) {
+        config["mix"][OP_NAMES[op]] = opts.mix[op];
+    }
+    for (const auto& [length, weight] : opts.sizes) {
+        config["sizes"].push_back({{"elements", length}, {"weight", weight}});
+    }
+
+    std::printf("rescue-loadgen: %zu client threads, %.1fs per step (+%.1fs warmup)\n", opts.threads,
+                opts.duration_s, opts.warmup_s);
+
+    json results = {{"tool", "rescue-loadgen"}, {"config", config}, {"steps", json::array()}};
+    for (double rate : opts.rates) {
+        json step = run_step(opts, rate);
+        print_step(step);
+        results["steps"].push_back(step);
+    }
+
+    std::ofstream file(opts.output);
+    file << results.dump(2);
+    std::printf("\nResults saved to %s\n", opts.output.c_str());
+    return 0;
+}
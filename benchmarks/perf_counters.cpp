@@ -0,0 +1,173 @@
+/**
+ * @file perf_counters.cpp
+ * @brief perf_event_open backed hardware counters for bench_rescue.
+ */
+
+#include "perf_counters.hpp"
+
+#include <cerrno>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace rescue::bench {
+
+namespace {
+
+bool g_enabled = false;
+std::string g_status = "disabled";
+
+#if defined(__linux__)
+
+struct EventConfig {
+    uint32_t type;
+    uint64_t config;
+};
+
+constexpr uint64_t cache_miss_config(uint64_t cache) {
+    return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+constexpr std::array<EventConfig, PerfCounters::NUM_EVENTS> EVENT_CONFIGS = {{
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {PERF_TYPE_HW_CACHE, cache_miss_config(PERF_COUNT_HW_CACHE_L1D)},
+    {PERF_TYPE_HW_CACHE, cache_miss_config(PERF_COUNT_HW_CACHE_LL)},
+}};
+
+// Events are opened individually rather than as a group: five hardware events
+// can exceed the PMU's programmable counters, and the kernel then multiplexes
+// them. Values are scaled by time_enabled / time_running to compensate.
+int open_event(const EventConfig& event) {
+    perf_event_attr attr{};
+    attr.size = sizeof(attr);
+    attr.type = event.type;
+    attr.config = event.config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    attr.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+    return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+}
+
+double read_scaled(int fd) {
+    uint64_t buf[3] = {0, 0, 0};  // value, time_enabled, time_running
+    if (read(fd, buf, sizeof(buf)) != static_cast<ssize_t>(sizeof(buf)) || buf[2] == 0) {
+        return -1.0;
+    }
+    return static_cast<double>(buf[0]) * static_cast<double>(buf[1]) / static_cast<double>(buf[2]);
+}
+
+#endif
+
+}  // anonymous namespace
+
+// ============================================================================
+// PerfCounters
+// ============================================================================
+
+bool PerfCounters::enable() {
+#if defined(__linux__)
+    int fd = open_event(EVENT_CONFIGS[CYCLES]);
+    if (fd < 0) {
+        g_status = std::string("unavailable: ") + std::strerror(errno);
+        return false;
+    }
+    close(fd);
+    g_enabled = true;
+    g_status = "enabled";
+    return true;
+#else
+    g_status = "unavailable: perf_event_open requires Linux";
+    return false;
+#endif
+}
+
+bool PerfCounters::enabled() noexcept {
+    return g_enabled;
+}
+
+const std::string& PerfCounters::status() noexcept {
+    return g_status;
+}
+
+// ============================================================================
+// PerfScope
+// ============================================================================
+
+PerfScope::PerfScope(benchmark::State& state, PerfWork work)
+    : state_(state), work_(work) {
+    fds_.fill(-1);
+#if defined(__linux__)
+    if (!g_enabled) {
+        return;
+    }
+    // Individual events may be missing (e.g. cache events on a virtual PMU);
+    // those are skipped and simply not reported.
+    for (size_t i = 0; i < PerfCounters::NUM_EVENTS; ++i) {
+        fds_[i] = open_event(EVENT_CONFIGS[i]);
+    }
+    for (int fd : fds_) {
+        if (fd >= 0) {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+#endif
+}
+
+PerfScope::~PerfScope() {
+#if defined(__linux__)
+    std::array<double, PerfCounters::NUM_EVENTS> totals;
+    totals.fill(-1.0);
+    for (size_t i = 0; i < PerfCounters::NUM_EVENTS; ++i) {
+        if (fds_[i] >= 0) {
+            ioctl(fds_[i], PERF_EVENT_IOC_DISABLE, 0);
+            totals[i] = read_scaled(fds_[i]);
+            close(fds_[i]);
+        }
+    }
+
+    double iterations = static_cast<double>(state_.iterations());
+    if (!g_enabled || iterations == 0) {
+        return;
+    }
+
+    for (size_t i = 0; i < PerfCounters::NUM_EVENTS; ++i) {
+        if (totals[i] >= 0) {
+            state_.counters[PerfCounters::EVENT_NAMES[i]] =
+                benchmark::Counter(totals[i], benchmark::Counter::kAvgIterations);
+        }
+    }
+
+    double cycles = totals[PerfCounters::CYCLES];
+    double instructions = totals[PerfCounters::INSTRUCTIONS];
+    if (cycles > 0 && instructions >= 0) {
+        state_.counters["ipc"] = instructions / cycles;
+    }
+
+    auto normalize = [&](const char* unit, double per_iteration) {
+        if (per_iteration <= 0) {
+            return;
+        }
+        double units = iterations * per_iteration;
+        if (cycles >= 0) {
+            state_.counters[std::string("cycles_per_") + unit] = cycles / units;
+        }
+        if (instructions >= 0) {
+            state_.counters[std::string("instructions_per_") + unit] = instructions / units;
+        }
+    };
+    normalize("field_op", work_.field_ops);
+    normalize("permutation", work_.permutations);
+    normalize("element", work_.elements);
+#endif
+}
+
+}  // namespace rescue::bench
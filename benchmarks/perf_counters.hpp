@@ -0,0 +1,81 @@
+#pragma once
+
+/**
+ * @file perf_counters.hpp
+ * @brief Optional hardware performance counters for the benchmark suite.
+ *
+ * Wraps Linux perf_event_open so that each benchmark can report cycles,
+ * instructions, IPC, branch misses and L1D/LLC misses per iteration, and
+ * normalize them per field op, per permutation and per encrypted element.
+ *
+ * Counters are opt-in (--hw_counters). When the kernel refuses access
+ * (perf_event_paranoid, containers, VMs without a virtual PMU) or the platform
+ * is not Linux, scopes become no-ops and only wall time is reported.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace rescue::bench {
+
+/**
+ * @brief Units of work performed by one benchmark iteration.
+ *
+ * Zero means "not meaningful for this benchmark"; the matching normalized
+ * counters are then omitted.
+ */
+struct PerfWork {
+    double field_ops = 0;
+    double permutations = 0;
+    double elements = 0;
+};
+
+/**
+ * @brief Process-wide switch and availability probe for hardware counters.
+ */
+class PerfCounters {
+public:
+    /// Hardware events, in the order they are opened and reported.
+    enum Event : size_t { CYCLES, INSTRUCTIONS, BRANCH_MISSES, L1D_MISSES, LLC_MISSES, NUM_EVENTS };
+
+    /// Counter names as written to the console and benchmark_results_cpp.json.
+    static constexpr std::array<const char*, NUM_EVENTS> EVENT_NAMES = {
+        "cycles", "instructions", "branch_misses", "l1d_misses", "llc_misses"};
+
+    /**
+     * @brief Request counters for subsequent benchmark runs.
+     * @return true if at least the cycle counter could be opened.
+     */
+    static bool enable();
+
+    /// True once enable() succeeded.
+    [[nodiscard]] static bool enabled() noexcept;
+
+    /// Human-readable status: "enabled", "disabled" or "unavailable: <reason>".
+    [[nodiscard]] static const std::string& status() noexcept;
+};
+
+/**
+ * @brief RAII scope measuring hardware events around a benchmark loop.
+ *
+ * Construct immediately before `for (auto _ : state)`; on destruction the
+ * per-iteration and normalized counters are added to state.counters.
+ */
+class PerfScope {
+public:
+    PerfScope(benchmark::State& state, PerfWork work);
+    ~PerfScope();
+
+    PerfScope(const PerfScope&) = delete;
+    PerfScope& operator=(const PerfScope&) = delete;
+
+private:
+    benchmark::State& state_;
+    PerfWork work_;
+    std::array<int, PerfCounters::NUM_EVENTS> fds_;
+};
+
+}  // namespace rescue::bench
@@ -0,0 +1,71 @@
+/**
+ * @file c_api.c
+ * @brief Example of the rescue_c.h C ABI, compiled as C.
+ *
+ * Encrypts a batch of three messages under one key in a single call,
+ * decrypts them again and hashes each plaintext.
+ */
+
+#include <rescue/rescue_c.h>
+
+#include <stdio.h>
+#include <string.h>
+
+#define N_MESSAGES 3
+#define TOTAL_ELEMENTS 9
+
+static int check(rescue_status status, const char* what) {
+    if (status != RESCUE_OK) {
+        fprintf(stderr, "%s: %s\n", what, rescue_status_string(status));
+        return 1;
+    }
+    return 0;
+}
+
+int main(void) {
+    uint8_t secret[RESCUE_C_SECRET_SIZE];
+    uint8_t nonces[N_MESSAGES * RESCUE_C_NONCE_SIZE];
+    size_t lengths[N_MESSAGES] = {2, 5, 2};
+    uint8_t plain[TOTAL_ELEMENTS * RESCUE_C_ELEMENT_SIZE];
+    uint8_t cipher_text[sizeof(plain)];
+    uint8_t decrypted[sizeof(plain)];
+    uint8_t digests[N_MESSAGES * RESCUE_C_DIGEST_ELEMENTS * RESCUE_C_ELEMENT_SIZE];
+    rescue_cipher* cipher = NULL;
+    rescue_hasher* hasher = NULL;
+    size_t i;
+    int failed = 0;
+
+    for (i = 0; i < sizeof(secret); ++i) {
+        secret[i] = (uint8_t)i;
+    }
+    for (i = 0; i < sizeof(nonces); ++i) {
+        nonces[i] = (uint8_t)(i * 7);
+    }
+    /* Small little-endian values: element i is i + 1 */
+    memset(plain, 0, sizeof(plain));
+    for (i = 0; i < TOTAL_ELEMENTS; ++i) {
+        plain[i * RESCUE_C_ELEMENT_SIZE] = (uint8_t)(i + 1);
+    }
+
+    printf("rescue C ABI version %u\n", rescue_abi_version());
+
+    failed |= check(rescue_cipher_new(5, secret, &cipher), "rescue_cipher_new");
+    failed |= check(rescue_hasher_new(&hasher), "rescue_hasher_new");
+    if (!failed) {
+        failed |= check(rescue_cipher_encrypt_batch(cipher, N_MESSAGES, nonces, lengths, plain, cipher_text),
+                        "encrypt_batch");
+        failed |= check(rescue_cipher_decrypt_batch(cipher, N_MESSAGES, nonces, lengths, cipher_text, decrypted),
+                        "decrypt_batch");
+        failed |= check(rescue_hash_batch(hasher, N_MESSAGES, lengths, plain, digests), "hash_batch");
+    }
+    if (!failed) {
+        printf("round trip %s\n", memcmp(plain, decrypted, sizeof(plain)) == 0 ? "ok" : "FAILED");
+        printf("first digest byte of each message: %02x %02x %02x\n", digests[0],
+               digests[RESCUE_C_DIGEST_ELEMENTS * RESCUE_C_ELEMENT_SIZE],
+               digests[2 * RESCUE_C_DIGEST_ELEMENTS * RESCUE_C_ELEMENT_SIZE]);
+    }
+
+    rescue_cipher_free(cipher);
+    rescue_hasher_free(hasher);
+    return failed;
+}
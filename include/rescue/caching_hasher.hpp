@@ -0,0 +1,129 @@
+#pragma once
+
+/**
+ * @file caching_hasher.hpp
+ * @brief Memoizing wrapper around RescuePrimeHash.
+ *
+ * Pipelines that rehash the same messages (public parameters, unchanged
+ * records) can wrap their hasher in a CachingHasher. Digests are cached by
+ * message content: a 64-bit non-cryptographic fingerprint selects the
+ * entry and the stored message is compared in full, so a fingerprint
+ * collision costs a recomputation and never returns a wrong digest.
+ *
+ * The cache is split into shards, each with its own lock and LRU list, and
+ * is bounded by a total entry capacity. Digests are computed outside the
+ * lock.
+ */
+
+#include <rescue/field.hpp>
+#include <rescue/rescue_hash.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace rescue {
+
+/**
+ * @brief Hit statistics of a CachingHasher.
+ */
+struct CacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t entries = 0;
+
+    /// hits / (hits + misses), or 0 before the first lookup
+    [[nodiscard]] double hit_rate() const {
+        const uint64_t total = hits + misses;
+        return total == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(total);
+    }
+};
+
+/**
+ * @brief RescuePrimeHash with a bounded, thread-safe digest cache.
+ *
+ * digest() may be called concurrently from any number of threads.
+ */
+class CachingHasher {
+public:
+    /// Default number of independently locked shards
+    static constexpr size_t DEFAULT_SHARDS = 16;
+
+    /**
+     * @brief Wrap a default RescuePrimeHash.
+     * @param capacity Maximum number of cached messages (at least 1).
+     * @param shards Number of lock shards; reduced to capacity if larger.
+     * @throws std::invalid_argument if capacity or shards is zero.
+     */
+    explicit CachingHasher(size_t capacity, size_t shards = DEFAULT_SHARDS);
+
+    /**
+     * @brief Wrap an existing hasher.
+     * @throws std::invalid_argument if capacity or shards is zero.
+     */
+    CachingHasher(RescuePrimeHash hasher, size_t capacity, size_t shards = DEFAULT_SHARDS);
+
+    CachingHasher(const CachingHasher&) = delete;
+    CachingHasher& operator=(const CachingHasher&) = delete;
+    ~CachingHasher();
+
+    /**
+     * @brief Digest of a message, from the cache when possible.
+     */
+    [[nodiscard]] std::vector<Fp> digest(std::span<const Fp> message) const;
+
+    /**
+     * @brief Digest of a message (vector overload, as RescuePrimeHash).
+     */
+    [[nodiscard]] std::vector<Fp> digest(const std::vector<Fp>& message) const {
+        return digest(std::span<const Fp>(message));
+    }
+
+    /// Current statistics; counters are read without stopping concurrent lookups
+    [[nodiscard]] CacheStats stats() const;
+
+    /// Drop all entries and reset the statistics
+    void clear();
+
+    [[nodiscard]] size_t capacity() const { return capacity_; }
+
+    /// The wrapped hasher
+    [[nodiscard]] const RescuePrimeHash& hasher() const { return hasher_; }
+
+    /**
+     * @brief The 64-bit content fingerprint used as the cache key.
+     */
+    [[nodiscard]] static uint64_t fingerprint(std::span<const Fp> message);
+
+private:
+    struct Entry {
+        uint64_t fingerprint;
+        std::vector<Fp> message;
+        std::vector<Fp> digest;
+    };
+
+    struct Shard {
+        std::mutex mutex;
+        std::list<Entry> lru;  // most recently used first
+        std::unordered_map<uint64_t, std::list<Entry>::iterator> index;
+    };
+
+    RescuePrimeHash hasher_;
+    size_t capacity_;
+    size_t shard_capacity_;
+    std::unique_ptr<Shard[]> shards_;
+    size_t n_shards_;
+
+    mutable std::atomic<uint64_t> hits_{0};
+    mutable std::atomic<uint64_t> misses_{0};
+    mutable std::atomic<uint64_t> evictions_{0};
+};
+
+}  // namespace rescue
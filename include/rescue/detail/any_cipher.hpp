@@ -0,0 +1,58 @@
+#pragma once
+
+/**
+ * @file any_cipher.hpp
+ * @brief A BasicRescueCipher whose state width is chosen at run time.
+ *
+ * Shared by the C ABI and the command-line tools, which both take the width
+ * as a number.
+ */
+
+#include <rescue/rescue_cipher.hpp>
+
+#include <cstdint>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+
+namespace rescue::detail {
+
+/// One cipher of any supported width
+using AnyCipher =
+    std::variant<BasicRescueCipher<5>, BasicRescueCipher<8>, BasicRescueCipher<12>, BasicRescueCipher<16>>;
+
+/**
+ * @brief Derive the cipher for a state width.
+ * @throws std::invalid_argument if width is not supported.
+ */
+[[nodiscard]] inline AnyCipher make_any_cipher(uint32_t width,
+                                               std::span<const uint8_t, RESCUE_CIPHER_SECRET_SIZE> secret) {
+    switch (width) {
+        case 5:
+            return BasicRescueCipher<5>(secret);
+        case 8:
+            return BasicRescueCipher<8>(secret);
+        case 12:
+            return BasicRescueCipher<12>(secret);
+        case 16:
+            return BasicRescueCipher<16>(secret);
+        default:
+            throw std::invalid_argument("Unsupported cipher width " + std::to_string(width));
+    }
+}
+
+/**
+ * @brief State width of the held cipher.
+ */
+[[nodiscard]] inline uint32_t cipher_width(const AnyCipher& cipher) noexcept {
+    return std::visit(
+        [](const auto& c) {
+            return static_cast<uint32_t>(std::tuple_size_v<typename std::decay_t<decltype(c)>::Block>);
+        },
+        cipher);
+}
+
+}  // namespace rescue::detail
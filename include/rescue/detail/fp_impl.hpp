@@ -14,6 +14,7 @@
  */
 
 #include <rescue/detail/uint256.hpp>
+#include <rescue/op_counters.hpp>
 
 #include <cstdint>
 
@@ -104,6 +105,7 @@ inline constexpr uint256 P_MINUS_2{
  * Assumes a, b are in [0, p). Result is in [0, p).
  */
 [[nodiscard]] inline constexpr uint256 add(const uint256& a, const uint256& b) noexcept {
+    RESCUE_COUNT_OP(add);
     // a + b is in [0, 2p - 2], so one conditional subtraction suffices
     auto [sum, carry] = uint256::add_with_carry(a, b);
 
@@ -132,6 +134,7 @@ inline constexpr uint256 P_MINUS_2{
  * Assumes a, b are in [0, p). Result is in [0, p).
  */
 [[nodiscard]] inline constexpr uint256 sub(const uint256& a, const uint256& b) noexcept {
+    RESCUE_COUNT_OP(sub);
     auto [diff, borrow] = uint256::sub_with_borrow(a, b);
 
     // If borrow, add p back
@@ -267,6 +270,7 @@ inline constexpr uint256 P_MINUS_2{
  * @brief Field multiplication: (a * b) mod p.
  */
 [[nodiscard]] inline uint256 mul(const uint256& a, const uint256& b) noexcept {
+    RESCUE_COUNT_OP(mul);
     uint512 wide = mul_wide(a, b);
     return reduce_512(wide);
 }
@@ -277,6 +281,7 @@ inline constexpr uint256 P_MINUS_2{
  * Uses optimized squaring that exploits the symmetry of the product.
  */
 [[nodiscard]] inline uint256 sqr(const uint256& a) noexcept {
+    RESCUE_COUNT_OP(sqr);
     uint512 wide = sqr_wide(a);
     return reduce_512(wide);
 }
@@ -290,6 +295,7 @@ inline constexpr uint256 P_MINUS_2{
  * a^5 = a^4 * a = (a^2)^2 * a
  */
 [[nodiscard]] inline uint256 pow5(const uint256& a) noexcept {
+    RESCUE_COUNT_OP(pow5);
     uint256 a2 = sqr(a);      // a^2
     uint256 a4 = sqr(a2);     // a^4
     return mul(a4, a);        // a^5
@@ -327,6 +333,7 @@ inline constexpr uint256 P_MINUS_2{
  * We use the standard addition chain that builds up powers of 2^n - 1.
  */
 [[nodiscard]] inline uint256 inv(const uint256& a) noexcept {
+    RESCUE_COUNT_OP(inv);
     // Build up a^(2^n - 1) for increasing n
 
     // a^(2^2 - 1) = a^3
@@ -401,12 +408,13 @@ inline constexpr uint256 P_MINUS_2{
  * goes where based on the bit value.
  */
 [[nodiscard]] inline uint256 pow(const uint256& base, const uint256& exp) noexcept {
+    RESCUE_COUNT_OP(pow);
     uint256 r0 = uint256::one();  // Accumulates base^(bits seen so far)
     uint256 r1 = base;            // Maintains r0 * base
 
-    // Process all 255 bits (the maximum for our field)
-    // Start from bit 254 (MSB for values < p)
-    for (int i = 254; i >= 0; --i) {
+    // Process all 256 exponent bits; exponents are not reduced, so bit 255
+    // may be set even though field elements never use it
+    for (int i = 255; i >= 0; --i) {
         bool bit = exp.bit(static_cast<size_t>(i));
 
         // Always compute both branches
@@ -430,6 +438,7 @@ inline constexpr uint256 P_MINUS_2{
  * Uses Montgomery ladder for constant-time execution.
  */
 [[nodiscard]] inline uint256 pow(const uint256& base, uint64_t exp) noexcept {
+    RESCUE_COUNT_OP(pow);
     uint256 r0 = uint256::one();
     uint256 r1 = base;
 
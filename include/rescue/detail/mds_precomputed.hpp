@@ -6,6 +6,8 @@
  *
  * This file contains hardcoded MDS matrices for:
  * - m=5: Cipher mode (RESCUE_CIPHER_BLOCK_SIZE)
+ * - m=8, m=16: Wide cipher modes (BasicRescueCipher<8>, BasicRescueCipher<16>)
+ * - m=12: Hash mode (RESCUE_HASH_STATE_SIZE) and BasicRescueCipher<12>
  *
  * The Cauchy MDS matrix is defined as M[i][j] = 1/(i+j) for i,j = 1..m
  * computed over the field F_p where p = 2^255 - 19.
@@ -74,6 +76,107 @@ inline constexpr std::array<std::array<uint256, 5>, 5> MDS_5x5 = {{
     }},
 }};
 
+// ============================================================================
+// MDS Matrix for m=8 (Cipher mode, BasicRescueCipher<8>)
+// M[i][j] = 1/(i+j) mod p, for i,j in [1,8]
+// ============================================================================
+
+/**
+ * @brief Precomputed 8x8 MDS matrix for wide cipher mode.
+ *
+ * Entry (i,j) = 1/(i+j+2) mod p, since array is 0-indexed.
+ */
+inline constexpr std::array<std::array<uint256, 8>, 8> MDS_8x8 = {{
+    // Row 0: 1/2, 1/3, 1/4, 1/5, 1/6, 1/7, 1/8, 1/9
+    {{
+        uint256{0xfffffffffffffff7ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x3fffffffffffffffULL},
+        uint256{0x5555555555555549ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x5555555555555555ULL},
+        uint256{0xfffffffffffffff2ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x5fffffffffffffffULL},
+        uint256{0x9999999999999996ULL, 0x9999999999999999ULL, 0x9999999999999999ULL, 0x1999999999999999ULL},
+        uint256{0xaaaaaaaaaaaaaa9bULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x6aaaaaaaaaaaaaaaULL},
+        uint256{0x249249249249248dULL, 0x9249249249249249ULL, 0x4924924924924924ULL, 0x2492492492492492ULL},
+        uint256{0xfffffffffffffff9ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2fffffffffffffffULL},
+        uint256{0xc71c71c71c71c712ULL, 0x1c71c71c71c71c71ULL, 0x71c71c71c71c71c7ULL, 0x471c71c71c71c71cULL},
+    }},
+    // Row 1: 1/3, 1/4, 1/5, 1/6, 1/7, 1/8, 1/9, 1/10
+    {{
+        uint256{0x5555555555555549ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x5555555555555555ULL},
+        uint256{0xfffffffffffffff2ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x5fffffffffffffffULL},
+        uint256{0x9999999999999996ULL, 0x9999999999999999ULL, 0x9999999999999999ULL, 0x1999999999999999ULL},
+        uint256{0xaaaaaaaaaaaaaa9bULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x6aaaaaaaaaaaaaaaULL},
+        uint256{0x249249249249248dULL, 0x9249249249249249ULL, 0x4924924924924924ULL, 0x2492492492492492ULL},
+        uint256{0xfffffffffffffff9ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2fffffffffffffffULL},
+        uint256{0xc71c71c71c71c712ULL, 0x1c71c71c71c71c71ULL, 0x71c71c71c71c71c7ULL, 0x471c71c71c71c71cULL},
+        uint256{0xcccccccccccccccbULL, 0xccccccccccccccccULL, 0xccccccccccccccccULL, 0x0cccccccccccccccULL},
+    }},
+    // Row 2: 1/4, 1/5, 1/6, 1/7, 1/8, 1/9, 1/10, 1/11
+    {{
+        uint256{0xfffffffffffffff2ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x5fffffffffffffffULL},
+        uint256{0x9999999999999996ULL, 0x9999999999999999ULL, 0x9999999999999999ULL, 0x1999999999999999ULL},
+        uint256{0xaaaaaaaaaaaaaa9bULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x6aaaaaaaaaaaaaaaULL},
+        uint256{0x249249249249248dULL, 0x9249249249249249ULL, 0x4924924924924924ULL, 0x2492492492492492ULL},
+        uint256{0xfffffffffffffff9ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2fffffffffffffffULL},
+        uint256{0xc71c71c71c71c712ULL, 0x1c71c71c71c71c71ULL, 0x71c71c71c71c71c7ULL, 0x471c71c71c71c71cULL},
+        uint256{0xcccccccccccccccbULL, 0xccccccccccccccccULL, 0xccccccccccccccccULL, 0x0cccccccccccccccULL},
+        uint256{0xe8ba2e8ba2e8ba26ULL, 0x2e8ba2e8ba2e8ba2ULL, 0xa2e8ba2e8ba2e8baULL, 0x3a2e8ba2e8ba2e8bULL},
+    }},
+    // Row 3: 1/5, 1/6, 1/7, 1/8, 1/9, 1/10, 1/11, 1/12
+    {{
+        uint256{0x9999999999999996ULL, 0x9999999999999999ULL, 0x9999999999999999ULL, 0x1999999999999999ULL},
+        uint256{0xaaaaaaaaaaaaaa9bULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x6aaaaaaaaaaaaaaaULL},
+        uint256{0x249249249249248dULL, 0x9249249249249249ULL, 0x4924924924924924ULL, 0x2492492492492492ULL},
+        uint256{0xfffffffffffffff9ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2fffffffffffffffULL},
+        uint256{0xc71c71c71c71c712ULL, 0x1c71c71c71c71c71ULL, 0x71c71c71c71c71c7ULL, 0x471c71c71c71c71cULL},
+        uint256{0xcccccccccccccccbULL, 0xccccccccccccccccULL, 0xccccccccccccccccULL, 0x0cccccccccccccccULL},
+        uint256{0xe8ba2e8ba2e8ba26ULL, 0x2e8ba2e8ba2e8ba2ULL, 0xa2e8ba2e8ba2e8baULL, 0x3a2e8ba2e8ba2e8bULL},
+        uint256{0x5555555555555544ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x7555555555555555ULL},
+    }},
+    // Row 4: 1/6, 1/7, 1/8, 1/9, 1/10, 1/11, 1/12, 1/13
+    {{
+        uint256{0xaaaaaaaaaaaaaa9bULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x6aaaaaaaaaaaaaaaULL},
+        uint256{0x249249249249248dULL, 0x9249249249249249ULL, 0x4924924924924924ULL, 0x2492492492492492ULL},
+        uint256{0xfffffffffffffff9ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2fffffffffffffffULL},
+        uint256{0xc71c71c71c71c712ULL, 0x1c71c71c71c71c71ULL, 0x71c71c71c71c71c7ULL, 0x471c71c71c71c71cULL},
+        uint256{0xcccccccccccccccbULL, 0xccccccccccccccccULL, 0xccccccccccccccccULL, 0x0cccccccccccccccULL},
+        uint256{0xe8ba2e8ba2e8ba26ULL, 0x2e8ba2e8ba2e8ba2ULL, 0xa2e8ba2e8ba2e8baULL, 0x3a2e8ba2e8ba2e8bULL},
+        uint256{0x5555555555555544ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x7555555555555555ULL},
+        uint256{0x3b13b13b13b13b0bULL, 0x13b13b13b13b13b1ULL, 0xb13b13b13b13b13bULL, 0x3b13b13b13b13b13ULL},
+    }},
+    // Row 5: 1/7, 1/8, 1/9, 1/10, 1/11, 1/12, 1/13, 1/14
+    {{
+        uint256{0x249249249249248dULL, 0x9249249249249249ULL, 0x4924924924924924ULL, 0x2492492492492492ULL},
+        uint256{0xfffffffffffffff9ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2fffffffffffffffULL},
+        uint256{0xc71c71c71c71c712ULL, 0x1c71c71c71c71c71ULL, 0x71c71c71c71c71c7ULL, 0x471c71c71c71c71cULL},
+        uint256{0xcccccccccccccccbULL, 0xccccccccccccccccULL, 0xccccccccccccccccULL, 0x0cccccccccccccccULL},
+        uint256{0xe8ba2e8ba2e8ba26ULL, 0x2e8ba2e8ba2e8ba2ULL, 0xa2e8ba2e8ba2e8baULL, 0x3a2e8ba2e8ba2e8bULL},
+        uint256{0x5555555555555544ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x7555555555555555ULL},
+        uint256{0x3b13b13b13b13b0bULL, 0x13b13b13b13b13b1ULL, 0xb13b13b13b13b13bULL, 0x3b13b13b13b13b13ULL},
+        uint256{0x924924924924923dULL, 0x4924924924924924ULL, 0x2492492492492492ULL, 0x5249249249249249ULL},
+    }},
+    // Row 6: 1/8, 1/9, 1/10, 1/11, 1/12, 1/13, 1/14, 1/15
+    {{
+        uint256{0xfffffffffffffff9ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2fffffffffffffffULL},
+        uint256{0xc71c71c71c71c712ULL, 0x1c71c71c71c71c71ULL, 0x71c71c71c71c71c7ULL, 0x471c71c71c71c71cULL},
+        uint256{0xcccccccccccccccbULL, 0xccccccccccccccccULL, 0xccccccccccccccccULL, 0x0cccccccccccccccULL},
+        uint256{0xe8ba2e8ba2e8ba26ULL, 0x2e8ba2e8ba2e8ba2ULL, 0xa2e8ba2e8ba2e8baULL, 0x3a2e8ba2e8ba2e8bULL},
+        uint256{0x5555555555555544ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x7555555555555555ULL},
+        uint256{0x3b13b13b13b13b0bULL, 0x13b13b13b13b13b1ULL, 0xb13b13b13b13b13bULL, 0x3b13b13b13b13b13ULL},
+        uint256{0x924924924924923dULL, 0x4924924924924924ULL, 0x2492492492492492ULL, 0x5249249249249249ULL},
+        uint256{0xddddddddddddddd0ULL, 0xddddddddddddddddULL, 0xddddddddddddddddULL, 0x5dddddddddddddddULL},
+    }},
+    // Row 7: 1/9, 1/10, 1/11, 1/12, 1/13, 1/14, 1/15, 1/16
+    {{
+        uint256{0xc71c71c71c71c712ULL, 0x1c71c71c71c71c71ULL, 0x71c71c71c71c71c7ULL, 0x471c71c71c71c71cULL},
+        uint256{0xcccccccccccccccbULL, 0xccccccccccccccccULL, 0xccccccccccccccccULL, 0x0cccccccccccccccULL},
+        uint256{0xe8ba2e8ba2e8ba26ULL, 0x2e8ba2e8ba2e8ba2ULL, 0xa2e8ba2e8ba2e8baULL, 0x3a2e8ba2e8ba2e8bULL},
+        uint256{0x5555555555555544ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x7555555555555555ULL},
+        uint256{0x3b13b13b13b13b0bULL, 0x13b13b13b13b13b1ULL, 0xb13b13b13b13b13bULL, 0x3b13b13b13b13b13ULL},
+        uint256{0x924924924924923dULL, 0x4924924924924924ULL, 0x2492492492492492ULL, 0x5249249249249249ULL},
+        uint256{0xddddddddddddddd0ULL, 0xddddddddddddddddULL, 0xddddddddddddddddULL, 0x5dddddddddddddddULL},
+        uint256{0xfffffffffffffff3ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x57ffffffffffffffULL},
+    }},
+}};
+
 // ============================================================================
 // MDS Matrix for m=12 (Hash mode)
 // M[i][j] = 1/(i+j) mod p, for i,j in [1,12]
@@ -267,15 +370,335 @@ inline constexpr std::array<std::array<uint256, 12>, 12> MDS_12x12 = {{
     }},
 }};
 
+// ============================================================================
+// MDS Matrix for m=16 (Cipher mode, BasicRescueCipher<16>)
+// M[i][j] = 1/(i+j) mod p, for i,j in [1,16]
+// ============================================================================
+
+/**
+ * @brief Precomputed 16x16 MDS matrix for wide cipher mode.
+ *
+ * Entry (i,j) = 1/(i+j+2) mod p, since array is 0-indexed.
+ */
+inline constexpr std::array<std::array<uint256, 16>, 16> MDS_16x16 = {{
+    // Row 0: 1/2, 1/3, 1/4, 1/5, 1/6, 1/7, 1/8, 1/9, 1/10, 1/11, 1/12, 1/13, 1/14, 1/15, 1/16, 1/17
+    {{
+        uint256{0xfffffffffffffff7ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x3fffffffffffffffULL},
+        uint256{0x5555555555555549ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x5555555555555555ULL},
+        uint256{0xfffffffffffffff2ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x5fffffffffffffffULL},
+        uint256{0x9999999999999996ULL, 0x9999999999999999ULL, 0x9999999999999999ULL, 0x1999999999999999ULL},
+        uint256{0xaaaaaaaaaaaaaa9bULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x6aaaaaaaaaaaaaaaULL},
+        uint256{0x249249249249248dULL, 0x9249249249249249ULL, 0x4924924924924924ULL, 0x2492492492492492ULL},
+        uint256{0xfffffffffffffff9ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2fffffffffffffffULL},
+        uint256{0xc71c71c71c71c712ULL, 0x1c71c71c71c71c71ULL, 0x71c71c71c71c71c7ULL, 0x471c71c71c71c71cULL},
+        uint256{0xcccccccccccccccbULL, 0xccccccccccccccccULL, 0xccccccccccccccccULL, 0x0cccccccccccccccULL},
+        uint256{0xe8ba2e8ba2e8ba26ULL, 0x2e8ba2e8ba2e8ba2ULL, 0xa2e8ba2e8ba2e8baULL, 0x3a2e8ba2e8ba2e8bULL},
+        uint256{0x5555555555555544ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x7555555555555555ULL},
+        uint256{0x3b13b13b13b13b0bULL, 0x13b13b13b13b13b1ULL, 0xb13b13b13b13b13bULL, 0x3b13b13b13b13b13ULL},
+        uint256{0x924924924924923dULL, 0x4924924924924924ULL, 0x2492492492492492ULL, 0x5249249249249249ULL},
+        uint256{0xddddddddddddddd0ULL, 0xddddddddddddddddULL, 0xddddddddddddddddULL, 0x5dddddddddddddddULL},
+        uint256{0xfffffffffffffff3ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x57ffffffffffffffULL},
+        uint256{0x5a5a5a5a5a5a5a4dULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL},
+    }},
+    // Row 1: 1/3, 1/4, 1/5, 1/6, 1/7, 1/8, 1/9, 1/10, 1/11, 1/12, 1/13, 1/14, 1/15, 1/16, 1/17, 1/18
+    {{
+        uint256{0x5555555555555549ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x5555555555555555ULL},
+        uint256{0xfffffffffffffff2ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x5fffffffffffffffULL},
+        uint256{0x9999999999999996ULL, 0x9999999999999999ULL, 0x9999999999999999ULL, 0x1999999999999999ULL},
+        uint256{0xaaaaaaaaaaaaaa9bULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x6aaaaaaaaaaaaaaaULL},
+        uint256{0x249249249249248dULL, 0x9249249249249249ULL, 0x4924924924924924ULL, 0x2492492492492492ULL},
+        uint256{0xfffffffffffffff9ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2fffffffffffffffULL},
+        uint256{0xc71c71c71c71c712ULL, 0x1c71c71c71c71c71ULL, 0x71c71c71c71c71c7ULL, 0x471c71c71c71c71cULL},
+        uint256{0xcccccccccccccccbULL, 0xccccccccccccccccULL, 0xccccccccccccccccULL, 0x0cccccccccccccccULL},
+        uint256{0xe8ba2e8ba2e8ba26ULL, 0x2e8ba2e8ba2e8ba2ULL, 0xa2e8ba2e8ba2e8baULL, 0x3a2e8ba2e8ba2e8bULL},
+        uint256{0x5555555555555544ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x7555555555555555ULL},
+        uint256{0x3b13b13b13b13b0bULL, 0x13b13b13b13b13b1ULL, 0xb13b13b13b13b13bULL, 0x3b13b13b13b13b13ULL},
+        uint256{0x924924924924923dULL, 0x4924924924924924ULL, 0x2492492492492492ULL, 0x5249249249249249ULL},
+        uint256{0xddddddddddddddd0ULL, 0xddddddddddddddddULL, 0xddddddddddddddddULL, 0x5dddddddddddddddULL},
+        uint256{0xfffffffffffffff3ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x57ffffffffffffffULL},
+        uint256{0x5a5a5a5a5a5a5a4dULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL},
+        uint256{0xe38e38e38e38e389ULL, 0x8e38e38e38e38e38ULL, 0x38e38e38e38e38e3ULL, 0x238e38e38e38e38eULL},
+    }},
+    // Row 2: 1/4, 1/5, 1/6, 1/7, 1/8, 1/9, 1/10, 1/11, 1/12, 1/13, 1/14, 1/15, 1/16, 1/17, 1/18, 1/19
+    {{
+        uint256{0xfffffffffffffff2ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x5fffffffffffffffULL},
+        uint256{0x9999999999999996ULL, 0x9999999999999999ULL, 0x9999999999999999ULL, 0x1999999999999999ULL},
+        uint256{0xaaaaaaaaaaaaaa9bULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x6aaaaaaaaaaaaaaaULL},
+        uint256{0x249249249249248dULL, 0x9249249249249249ULL, 0x4924924924924924ULL, 0x2492492492492492ULL},
+        uint256{0xfffffffffffffff9ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2fffffffffffffffULL},
+        uint256{0xc71c71c71c71c712ULL, 0x1c71c71c71c71c71ULL, 0x71c71c71c71c71c7ULL, 0x471c71c71c71c71cULL},
+        uint256{0xcccccccccccccccbULL, 0xccccccccccccccccULL, 0xccccccccccccccccULL, 0x0cccccccccccccccULL},
+        uint256{0xe8ba2e8ba2e8ba26ULL, 0x2e8ba2e8ba2e8ba2ULL, 0xa2e8ba2e8ba2e8baULL, 0x3a2e8ba2e8ba2e8bULL},
+        uint256{0x5555555555555544ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x7555555555555555ULL},
+        uint256{0x3b13b13b13b13b0bULL, 0x13b13b13b13b13b1ULL, 0xb13b13b13b13b13bULL, 0x3b13b13b13b13b13ULL},
+        uint256{0x924924924924923dULL, 0x4924924924924924ULL, 0x2492492492492492ULL, 0x5249249249249249ULL},
+        uint256{0xddddddddddddddd0ULL, 0xddddddddddddddddULL, 0xddddddddddddddddULL, 0x5dddddddddddddddULL},
+        uint256{0xfffffffffffffff3ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x57ffffffffffffffULL},
+        uint256{0x5a5a5a5a5a5a5a4dULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL},
+        uint256{0xe38e38e38e38e389ULL, 0x8e38e38e38e38e38ULL, 0x38e38e38e38e38e3ULL, 0x238e38e38e38e38eULL},
+        uint256{0x86bca1af286bca14ULL, 0xbca1af286bca1af2ULL, 0xa1af286bca1af286ULL, 0x2f286bca1af286bcULL},
+    }},
+    // Row 3: 1/5, 1/6, 1/7, 1/8, 1/9, 1/10, 1/11, 1/12, 1/13, 1/14, 1/15, 1/16, 1/17, 1/18, 1/19, 1/20
+    {{
+        uint256{0x9999999999999996ULL, 0x9999999999999999ULL, 0x9999999999999999ULL, 0x1999999999999999ULL},
+        uint256{0xaaaaaaaaaaaaaa9bULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x6aaaaaaaaaaaaaaaULL},
+        uint256{0x249249249249248dULL, 0x9249249249249249ULL, 0x4924924924924924ULL, 0x2492492492492492ULL},
+        uint256{0xfffffffffffffff9ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2fffffffffffffffULL},
+        uint256{0xc71c71c71c71c712ULL, 0x1c71c71c71c71c71ULL, 0x71c71c71c71c71c7ULL, 0x471c71c71c71c71cULL},
+        uint256{0xcccccccccccccccbULL, 0xccccccccccccccccULL, 0xccccccccccccccccULL, 0x0cccccccccccccccULL},
+        uint256{0xe8ba2e8ba2e8ba26ULL, 0x2e8ba2e8ba2e8ba2ULL, 0xa2e8ba2e8ba2e8baULL, 0x3a2e8ba2e8ba2e8bULL},
+        uint256{0x5555555555555544ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x7555555555555555ULL},
+        uint256{0x3b13b13b13b13b0bULL, 0x13b13b13b13b13b1ULL, 0xb13b13b13b13b13bULL, 0x3b13b13b13b13b13ULL},
+        uint256{0x924924924924923dULL, 0x4924924924924924ULL, 0x2492492492492492ULL, 0x5249249249249249ULL},
+        uint256{0xddddddddddddddd0ULL, 0xddddddddddddddddULL, 0xddddddddddddddddULL, 0x5dddddddddddddddULL},
+        uint256{0xfffffffffffffff3ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x57ffffffffffffffULL},
+        uint256{0x5a5a5a5a5a5a5a4dULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL},
+        uint256{0xe38e38e38e38e389ULL, 0x8e38e38e38e38e38ULL, 0x38e38e38e38e38e3ULL, 0x238e38e38e38e38eULL},
+        uint256{0x86bca1af286bca14ULL, 0xbca1af286bca1af2ULL, 0xa1af286bca1af286ULL, 0x2f286bca1af286bcULL},
+        uint256{0x666666666666665cULL, 0x6666666666666666ULL, 0x6666666666666666ULL, 0x4666666666666666ULL},
+    }},
+    // Row 4: 1/6, 1/7, 1/8, 1/9, 1/10, 1/11, 1/12, 1/13, 1/14, 1/15, 1/16, 1/17, 1/18, 1/19, 1/20, 1/21
+    {{
+        uint256{0xaaaaaaaaaaaaaa9bULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x6aaaaaaaaaaaaaaaULL},
+        uint256{0x249249249249248dULL, 0x9249249249249249ULL, 0x4924924924924924ULL, 0x2492492492492492ULL},
+        uint256{0xfffffffffffffff9ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2fffffffffffffffULL},
+        uint256{0xc71c71c71c71c712ULL, 0x1c71c71c71c71c71ULL, 0x71c71c71c71c71c7ULL, 0x471c71c71c71c71cULL},
+        uint256{0xcccccccccccccccbULL, 0xccccccccccccccccULL, 0xccccccccccccccccULL, 0x0cccccccccccccccULL},
+        uint256{0xe8ba2e8ba2e8ba26ULL, 0x2e8ba2e8ba2e8ba2ULL, 0xa2e8ba2e8ba2e8baULL, 0x3a2e8ba2e8ba2e8bULL},
+        uint256{0x5555555555555544ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x7555555555555555ULL},
+        uint256{0x3b13b13b13b13b0bULL, 0x13b13b13b13b13b1ULL, 0xb13b13b13b13b13bULL, 0x3b13b13b13b13b13ULL},
+        uint256{0x924924924924923dULL, 0x4924924924924924ULL, 0x2492492492492492ULL, 0x5249249249249249ULL},
+        uint256{0xddddddddddddddd0ULL, 0xddddddddddddddddULL, 0xddddddddddddddddULL, 0x5dddddddddddddddULL},
+        uint256{0xfffffffffffffff3ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x57ffffffffffffffULL},
+        uint256{0x5a5a5a5a5a5a5a4dULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL},
+        uint256{0xe38e38e38e38e389ULL, 0x8e38e38e38e38e38ULL, 0x38e38e38e38e38e3ULL, 0x238e38e38e38e38eULL},
+        uint256{0x86bca1af286bca14ULL, 0xbca1af286bca1af2ULL, 0xa1af286bca1af286ULL, 0x2f286bca1af286bcULL},
+        uint256{0x666666666666665cULL, 0x6666666666666666ULL, 0x6666666666666666ULL, 0x4666666666666666ULL},
+        uint256{0x0c30c30c30c30c2fULL, 0x30c30c30c30c30c3ULL, 0xc30c30c30c30c30cULL, 0x0c30c30c30c30c30ULL},
+    }},
+    // Row 5: 1/7, 1/8, 1/9, 1/10, 1/11, 1/12, 1/13, 1/14, 1/15, 1/16, 1/17, 1/18, 1/19, 1/20, 1/21, 1/22
+    {{
+        uint256{0x249249249249248dULL, 0x9249249249249249ULL, 0x4924924924924924ULL, 0x2492492492492492ULL},
+        uint256{0xfffffffffffffff9ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2fffffffffffffffULL},
+        uint256{0xc71c71c71c71c712ULL, 0x1c71c71c71c71c71ULL, 0x71c71c71c71c71c7ULL, 0x471c71c71c71c71cULL},
+        uint256{0xcccccccccccccccbULL, 0xccccccccccccccccULL, 0xccccccccccccccccULL, 0x0cccccccccccccccULL},
+        uint256{0xe8ba2e8ba2e8ba26ULL, 0x2e8ba2e8ba2e8ba2ULL, 0xa2e8ba2e8ba2e8baULL, 0x3a2e8ba2e8ba2e8bULL},
+        uint256{0x5555555555555544ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x7555555555555555ULL},
+        uint256{0x3b13b13b13b13b0bULL, 0x13b13b13b13b13b1ULL, 0xb13b13b13b13b13bULL, 0x3b13b13b13b13b13ULL},
+        uint256{0x924924924924923dULL, 0x4924924924924924ULL, 0x2492492492492492ULL, 0x5249249249249249ULL},
+        uint256{0xddddddddddddddd0ULL, 0xddddddddddddddddULL, 0xddddddddddddddddULL, 0x5dddddddddddddddULL},
+        uint256{0xfffffffffffffff3ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x57ffffffffffffffULL},
+        uint256{0x5a5a5a5a5a5a5a4dULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL},
+        uint256{0xe38e38e38e38e389ULL, 0x8e38e38e38e38e38ULL, 0x38e38e38e38e38e3ULL, 0x238e38e38e38e38eULL},
+        uint256{0x86bca1af286bca14ULL, 0xbca1af286bca1af2ULL, 0xa1af286bca1af286ULL, 0x2f286bca1af286bcULL},
+        uint256{0x666666666666665cULL, 0x6666666666666666ULL, 0x6666666666666666ULL, 0x4666666666666666ULL},
+        uint256{0x0c30c30c30c30c2fULL, 0x30c30c30c30c30c3ULL, 0xc30c30c30c30c30cULL, 0x0c30c30c30c30c30ULL},
+        uint256{0x745d1745d1745d13ULL, 0x1745d1745d1745d1ULL, 0xd1745d1745d1745dULL, 0x1d1745d1745d1745ULL},
+    }},
+    // Row 6: 1/8, 1/9, 1/10, 1/11, 1/12, 1/13, 1/14, 1/15, 1/16, 1/17, 1/18, 1/19, 1/20, 1/21, 1/22, 1/23
+    {{
+        uint256{0xfffffffffffffff9ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x2fffffffffffffffULL},
+        uint256{0xc71c71c71c71c712ULL, 0x1c71c71c71c71c71ULL, 0x71c71c71c71c71c7ULL, 0x471c71c71c71c71cULL},
+        uint256{0xcccccccccccccccbULL, 0xccccccccccccccccULL, 0xccccccccccccccccULL, 0x0cccccccccccccccULL},
+        uint256{0xe8ba2e8ba2e8ba26ULL, 0x2e8ba2e8ba2e8ba2ULL, 0xa2e8ba2e8ba2e8baULL, 0x3a2e8ba2e8ba2e8bULL},
+        uint256{0x5555555555555544ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x7555555555555555ULL},
+        uint256{0x3b13b13b13b13b0bULL, 0x13b13b13b13b13b1ULL, 0xb13b13b13b13b13bULL, 0x3b13b13b13b13b13ULL},
+        uint256{0x924924924924923dULL, 0x4924924924924924ULL, 0x2492492492492492ULL, 0x5249249249249249ULL},
+        uint256{0xddddddddddddddd0ULL, 0xddddddddddddddddULL, 0xddddddddddddddddULL, 0x5dddddddddddddddULL},
+        uint256{0xfffffffffffffff3ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x57ffffffffffffffULL},
+        uint256{0x5a5a5a5a5a5a5a4dULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL},
+        uint256{0xe38e38e38e38e389ULL, 0x8e38e38e38e38e38ULL, 0x38e38e38e38e38e3ULL, 0x238e38e38e38e38eULL},
+        uint256{0x86bca1af286bca14ULL, 0xbca1af286bca1af2ULL, 0xa1af286bca1af286ULL, 0x2f286bca1af286bcULL},
+        uint256{0x666666666666665cULL, 0x6666666666666666ULL, 0x6666666666666666ULL, 0x4666666666666666ULL},
+        uint256{0x0c30c30c30c30c2fULL, 0x30c30c30c30c30c3ULL, 0xc30c30c30c30c30cULL, 0x0c30c30c30c30c30ULL},
+        uint256{0x745d1745d1745d13ULL, 0x1745d1745d1745d1ULL, 0xd1745d1745d1745dULL, 0x1d1745d1745d1745ULL},
+        uint256{0xe9bd37a6f4de9bc3ULL, 0xa6f4de9bd37a6f4dULL, 0x9bd37a6f4de9bd37ULL, 0x6f4de9bd37a6f4deULL},
+    }},
+    // Row 7: 1/9, 1/10, 1/11, 1/12, 1/13, 1/14, 1/15, 1/16, 1/17, 1/18, 1/19, 1/20, 1/21, 1/22, 1/23, 1/24
+    {{
+        uint256{0xc71c71c71c71c712ULL, 0x1c71c71c71c71c71ULL, 0x71c71c71c71c71c7ULL, 0x471c71c71c71c71cULL},
+        uint256{0xcccccccccccccccbULL, 0xccccccccccccccccULL, 0xccccccccccccccccULL, 0x0cccccccccccccccULL},
+        uint256{0xe8ba2e8ba2e8ba26ULL, 0x2e8ba2e8ba2e8ba2ULL, 0xa2e8ba2e8ba2e8baULL, 0x3a2e8ba2e8ba2e8bULL},
+        uint256{0x5555555555555544ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x7555555555555555ULL},
+        uint256{0x3b13b13b13b13b0bULL, 0x13b13b13b13b13b1ULL, 0xb13b13b13b13b13bULL, 0x3b13b13b13b13b13ULL},
+        uint256{0x924924924924923dULL, 0x4924924924924924ULL, 0x2492492492492492ULL, 0x5249249249249249ULL},
+        uint256{0xddddddddddddddd0ULL, 0xddddddddddddddddULL, 0xddddddddddddddddULL, 0x5dddddddddddddddULL},
+        uint256{0xfffffffffffffff3ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x57ffffffffffffffULL},
+        uint256{0x5a5a5a5a5a5a5a4dULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL},
+        uint256{0xe38e38e38e38e389ULL, 0x8e38e38e38e38e38ULL, 0x38e38e38e38e38e3ULL, 0x238e38e38e38e38eULL},
+        uint256{0x86bca1af286bca14ULL, 0xbca1af286bca1af2ULL, 0xa1af286bca1af286ULL, 0x2f286bca1af286bcULL},
+        uint256{0x666666666666665cULL, 0x6666666666666666ULL, 0x6666666666666666ULL, 0x4666666666666666ULL},
+        uint256{0x0c30c30c30c30c2fULL, 0x30c30c30c30c30c3ULL, 0xc30c30c30c30c30cULL, 0x0c30c30c30c30c30ULL},
+        uint256{0x745d1745d1745d13ULL, 0x1745d1745d1745d1ULL, 0xd1745d1745d1745dULL, 0x1d1745d1745d1745ULL},
+        uint256{0xe9bd37a6f4de9bc3ULL, 0xa6f4de9bd37a6f4dULL, 0x9bd37a6f4de9bd37ULL, 0x6f4de9bd37a6f4deULL},
+        uint256{0xaaaaaaaaaaaaaaa2ULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x3aaaaaaaaaaaaaaaULL},
+    }},
+    // Row 8: 1/10, 1/11, 1/12, 1/13, 1/14, 1/15, 1/16, 1/17, 1/18, 1/19, 1/20, 1/21, 1/22, 1/23, 1/24, 1/25
+    {{
+        uint256{0xcccccccccccccccbULL, 0xccccccccccccccccULL, 0xccccccccccccccccULL, 0x0cccccccccccccccULL},
+        uint256{0xe8ba2e8ba2e8ba26ULL, 0x2e8ba2e8ba2e8ba2ULL, 0xa2e8ba2e8ba2e8baULL, 0x3a2e8ba2e8ba2e8bULL},
+        uint256{0x5555555555555544ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x7555555555555555ULL},
+        uint256{0x3b13b13b13b13b0bULL, 0x13b13b13b13b13b1ULL, 0xb13b13b13b13b13bULL, 0x3b13b13b13b13b13ULL},
+        uint256{0x924924924924923dULL, 0x4924924924924924ULL, 0x2492492492492492ULL, 0x5249249249249249ULL},
+        uint256{0xddddddddddddddd0ULL, 0xddddddddddddddddULL, 0xddddddddddddddddULL, 0x5dddddddddddddddULL},
+        uint256{0xfffffffffffffff3ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x57ffffffffffffffULL},
+        uint256{0x5a5a5a5a5a5a5a4dULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL},
+        uint256{0xe38e38e38e38e389ULL, 0x8e38e38e38e38e38ULL, 0x38e38e38e38e38e3ULL, 0x238e38e38e38e38eULL},
+        uint256{0x86bca1af286bca14ULL, 0xbca1af286bca1af2ULL, 0xa1af286bca1af286ULL, 0x2f286bca1af286bcULL},
+        uint256{0x666666666666665cULL, 0x6666666666666666ULL, 0x6666666666666666ULL, 0x4666666666666666ULL},
+        uint256{0x0c30c30c30c30c2fULL, 0x30c30c30c30c30c3ULL, 0xc30c30c30c30c30cULL, 0x0c30c30c30c30c30ULL},
+        uint256{0x745d1745d1745d13ULL, 0x1745d1745d1745d1ULL, 0xd1745d1745d1745dULL, 0x1d1745d1745d1745ULL},
+        uint256{0xe9bd37a6f4de9bc3ULL, 0xa6f4de9bd37a6f4dULL, 0x9bd37a6f4de9bd37ULL, 0x6f4de9bd37a6f4deULL},
+        uint256{0xaaaaaaaaaaaaaaa2ULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x3aaaaaaaaaaaaaaaULL},
+        uint256{0xeb851eb851eb851eULL, 0x1eb851eb851eb851ULL, 0x51eb851eb851eb85ULL, 0x051eb851eb851eb8ULL},
+    }},
+    // Row 9: 1/11, 1/12, 1/13, 1/14, 1/15, 1/16, 1/17, 1/18, 1/19, 1/20, 1/21, 1/22, 1/23, 1/24, 1/25, 1/26
+    {{
+        uint256{0xe8ba2e8ba2e8ba26ULL, 0x2e8ba2e8ba2e8ba2ULL, 0xa2e8ba2e8ba2e8baULL, 0x3a2e8ba2e8ba2e8bULL},
+        uint256{0x5555555555555544ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x7555555555555555ULL},
+        uint256{0x3b13b13b13b13b0bULL, 0x13b13b13b13b13b1ULL, 0xb13b13b13b13b13bULL, 0x3b13b13b13b13b13ULL},
+        uint256{0x924924924924923dULL, 0x4924924924924924ULL, 0x2492492492492492ULL, 0x5249249249249249ULL},
+        uint256{0xddddddddddddddd0ULL, 0xddddddddddddddddULL, 0xddddddddddddddddULL, 0x5dddddddddddddddULL},
+        uint256{0xfffffffffffffff3ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x57ffffffffffffffULL},
+        uint256{0x5a5a5a5a5a5a5a4dULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL},
+        uint256{0xe38e38e38e38e389ULL, 0x8e38e38e38e38e38ULL, 0x38e38e38e38e38e3ULL, 0x238e38e38e38e38eULL},
+        uint256{0x86bca1af286bca14ULL, 0xbca1af286bca1af2ULL, 0xa1af286bca1af286ULL, 0x2f286bca1af286bcULL},
+        uint256{0x666666666666665cULL, 0x6666666666666666ULL, 0x6666666666666666ULL, 0x4666666666666666ULL},
+        uint256{0x0c30c30c30c30c2fULL, 0x30c30c30c30c30c3ULL, 0xc30c30c30c30c30cULL, 0x0c30c30c30c30c30ULL},
+        uint256{0x745d1745d1745d13ULL, 0x1745d1745d1745d1ULL, 0xd1745d1745d1745dULL, 0x1d1745d1745d1745ULL},
+        uint256{0xe9bd37a6f4de9bc3ULL, 0xa6f4de9bd37a6f4dULL, 0x9bd37a6f4de9bd37ULL, 0x6f4de9bd37a6f4deULL},
+        uint256{0xaaaaaaaaaaaaaaa2ULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x3aaaaaaaaaaaaaaaULL},
+        uint256{0xeb851eb851eb851eULL, 0x1eb851eb851eb851ULL, 0x51eb851eb851eb85ULL, 0x051eb851eb851eb8ULL},
+        uint256{0x9d89d89d89d89d7cULL, 0x89d89d89d89d89d8ULL, 0xd89d89d89d89d89dULL, 0x5d89d89d89d89d89ULL},
+    }},
+    // Row 10: 1/12, 1/13, 1/14, 1/15, 1/16, 1/17, 1/18, 1/19, 1/20, 1/21, 1/22, 1/23, 1/24, 1/25, 1/26, 1/27
+    {{
+        uint256{0x5555555555555544ULL, 0x5555555555555555ULL, 0x5555555555555555ULL, 0x7555555555555555ULL},
+        uint256{0x3b13b13b13b13b0bULL, 0x13b13b13b13b13b1ULL, 0xb13b13b13b13b13bULL, 0x3b13b13b13b13b13ULL},
+        uint256{0x924924924924923dULL, 0x4924924924924924ULL, 0x2492492492492492ULL, 0x5249249249249249ULL},
+        uint256{0xddddddddddddddd0ULL, 0xddddddddddddddddULL, 0xddddddddddddddddULL, 0x5dddddddddddddddULL},
+        uint256{0xfffffffffffffff3ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x57ffffffffffffffULL},
+        uint256{0x5a5a5a5a5a5a5a4dULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL},
+        uint256{0xe38e38e38e38e389ULL, 0x8e38e38e38e38e38ULL, 0x38e38e38e38e38e3ULL, 0x238e38e38e38e38eULL},
+        uint256{0x86bca1af286bca14ULL, 0xbca1af286bca1af2ULL, 0xa1af286bca1af286ULL, 0x2f286bca1af286bcULL},
+        uint256{0x666666666666665cULL, 0x6666666666666666ULL, 0x6666666666666666ULL, 0x4666666666666666ULL},
+        uint256{0x0c30c30c30c30c2fULL, 0x30c30c30c30c30c3ULL, 0xc30c30c30c30c30cULL, 0x0c30c30c30c30c30ULL},
+        uint256{0x745d1745d1745d13ULL, 0x1745d1745d1745d1ULL, 0xd1745d1745d1745dULL, 0x1d1745d1745d1745ULL},
+        uint256{0xe9bd37a6f4de9bc3ULL, 0xa6f4de9bd37a6f4dULL, 0x9bd37a6f4de9bd37ULL, 0x6f4de9bd37a6f4deULL},
+        uint256{0xaaaaaaaaaaaaaaa2ULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x3aaaaaaaaaaaaaaaULL},
+        uint256{0xeb851eb851eb851eULL, 0x1eb851eb851eb851ULL, 0x51eb851eb851eb85ULL, 0x051eb851eb851eb8ULL},
+        uint256{0x9d89d89d89d89d7cULL, 0x89d89d89d89d89d8ULL, 0xd89d89d89d89d89dULL, 0x5d89d89d89d89d89ULL},
+        uint256{0x425ed097b425ed06ULL, 0x5ed097b425ed097bULL, 0xd097b425ed097b42ULL, 0x17b425ed097b425eULL},
+    }},
+    // Row 11: 1/13, 1/14, 1/15, 1/16, 1/17, 1/18, 1/19, 1/20, 1/21, 1/22, 1/23, 1/24, 1/25, 1/26, 1/27, 1/28
+    {{
+        uint256{0x3b13b13b13b13b0bULL, 0x13b13b13b13b13b1ULL, 0xb13b13b13b13b13bULL, 0x3b13b13b13b13b13ULL},
+        uint256{0x924924924924923dULL, 0x4924924924924924ULL, 0x2492492492492492ULL, 0x5249249249249249ULL},
+        uint256{0xddddddddddddddd0ULL, 0xddddddddddddddddULL, 0xddddddddddddddddULL, 0x5dddddddddddddddULL},
+        uint256{0xfffffffffffffff3ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x57ffffffffffffffULL},
+        uint256{0x5a5a5a5a5a5a5a4dULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL},
+        uint256{0xe38e38e38e38e389ULL, 0x8e38e38e38e38e38ULL, 0x38e38e38e38e38e3ULL, 0x238e38e38e38e38eULL},
+        uint256{0x86bca1af286bca14ULL, 0xbca1af286bca1af2ULL, 0xa1af286bca1af286ULL, 0x2f286bca1af286bcULL},
+        uint256{0x666666666666665cULL, 0x6666666666666666ULL, 0x6666666666666666ULL, 0x4666666666666666ULL},
+        uint256{0x0c30c30c30c30c2fULL, 0x30c30c30c30c30c3ULL, 0xc30c30c30c30c30cULL, 0x0c30c30c30c30c30ULL},
+        uint256{0x745d1745d1745d13ULL, 0x1745d1745d1745d1ULL, 0xd1745d1745d1745dULL, 0x1d1745d1745d1745ULL},
+        uint256{0xe9bd37a6f4de9bc3ULL, 0xa6f4de9bd37a6f4dULL, 0x9bd37a6f4de9bd37ULL, 0x6f4de9bd37a6f4deULL},
+        uint256{0xaaaaaaaaaaaaaaa2ULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x3aaaaaaaaaaaaaaaULL},
+        uint256{0xeb851eb851eb851eULL, 0x1eb851eb851eb851ULL, 0x51eb851eb851eb85ULL, 0x051eb851eb851eb8ULL},
+        uint256{0x9d89d89d89d89d7cULL, 0x89d89d89d89d89d8ULL, 0xd89d89d89d89d89dULL, 0x5d89d89d89d89d89ULL},
+        uint256{0x425ed097b425ed06ULL, 0x5ed097b425ed097bULL, 0xd097b425ed097b42ULL, 0x17b425ed097b425eULL},
+        uint256{0x4924924924924915ULL, 0x2492492492492492ULL, 0x9249249249249249ULL, 0x6924924924924924ULL},
+    }},
+    // Row 12: 1/14, 1/15, 1/16, 1/17, 1/18, 1/19, 1/20, 1/21, 1/22, 1/23, 1/24, 1/25, 1/26, 1/27, 1/28, 1/29
+    {{
+        uint256{0x924924924924923dULL, 0x4924924924924924ULL, 0x2492492492492492ULL, 0x5249249249249249ULL},
+        uint256{0xddddddddddddddd0ULL, 0xddddddddddddddddULL, 0xddddddddddddddddULL, 0x5dddddddddddddddULL},
+        uint256{0xfffffffffffffff3ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x57ffffffffffffffULL},
+        uint256{0x5a5a5a5a5a5a5a4dULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL},
+        uint256{0xe38e38e38e38e389ULL, 0x8e38e38e38e38e38ULL, 0x38e38e38e38e38e3ULL, 0x238e38e38e38e38eULL},
+        uint256{0x86bca1af286bca14ULL, 0xbca1af286bca1af2ULL, 0xa1af286bca1af286ULL, 0x2f286bca1af286bcULL},
+        uint256{0x666666666666665cULL, 0x6666666666666666ULL, 0x6666666666666666ULL, 0x4666666666666666ULL},
+        uint256{0x0c30c30c30c30c2fULL, 0x30c30c30c30c30c3ULL, 0xc30c30c30c30c30cULL, 0x0c30c30c30c30c30ULL},
+        uint256{0x745d1745d1745d13ULL, 0x1745d1745d1745d1ULL, 0xd1745d1745d1745dULL, 0x1d1745d1745d1745ULL},
+        uint256{0xe9bd37a6f4de9bc3ULL, 0xa6f4de9bd37a6f4dULL, 0x9bd37a6f4de9bd37ULL, 0x6f4de9bd37a6f4deULL},
+        uint256{0xaaaaaaaaaaaaaaa2ULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x3aaaaaaaaaaaaaaaULL},
+        uint256{0xeb851eb851eb851eULL, 0x1eb851eb851eb851ULL, 0x51eb851eb851eb85ULL, 0x051eb851eb851eb8ULL},
+        uint256{0x9d89d89d89d89d7cULL, 0x89d89d89d89d89d8ULL, 0xd89d89d89d89d89dULL, 0x5d89d89d89d89d89ULL},
+        uint256{0x425ed097b425ed06ULL, 0x5ed097b425ed097bULL, 0xd097b425ed097b42ULL, 0x17b425ed097b425eULL},
+        uint256{0x4924924924924915ULL, 0x2492492492492492ULL, 0x9249249249249249ULL, 0x6924924924924924ULL},
+        uint256{0xc234f72c234f72bdULL, 0x72c234f72c234f72ULL, 0x4f72c234f72c234fULL, 0x234f72c234f72c23ULL},
+    }},
+    // Row 13: 1/15, 1/16, 1/17, 1/18, 1/19, 1/20, 1/21, 1/22, 1/23, 1/24, 1/25, 1/26, 1/27, 1/28, 1/29, 1/30
+    {{
+        uint256{0xddddddddddddddd0ULL, 0xddddddddddddddddULL, 0xddddddddddddddddULL, 0x5dddddddddddddddULL},
+        uint256{0xfffffffffffffff3ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x57ffffffffffffffULL},
+        uint256{0x5a5a5a5a5a5a5a4dULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL},
+        uint256{0xe38e38e38e38e389ULL, 0x8e38e38e38e38e38ULL, 0x38e38e38e38e38e3ULL, 0x238e38e38e38e38eULL},
+        uint256{0x86bca1af286bca14ULL, 0xbca1af286bca1af2ULL, 0xa1af286bca1af286ULL, 0x2f286bca1af286bcULL},
+        uint256{0x666666666666665cULL, 0x6666666666666666ULL, 0x6666666666666666ULL, 0x4666666666666666ULL},
+        uint256{0x0c30c30c30c30c2fULL, 0x30c30c30c30c30c3ULL, 0xc30c30c30c30c30cULL, 0x0c30c30c30c30c30ULL},
+        uint256{0x745d1745d1745d13ULL, 0x1745d1745d1745d1ULL, 0xd1745d1745d1745dULL, 0x1d1745d1745d1745ULL},
+        uint256{0xe9bd37a6f4de9bc3ULL, 0xa6f4de9bd37a6f4dULL, 0x9bd37a6f4de9bd37ULL, 0x6f4de9bd37a6f4deULL},
+        uint256{0xaaaaaaaaaaaaaaa2ULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x3aaaaaaaaaaaaaaaULL},
+        uint256{0xeb851eb851eb851eULL, 0x1eb851eb851eb851ULL, 0x51eb851eb851eb85ULL, 0x051eb851eb851eb8ULL},
+        uint256{0x9d89d89d89d89d7cULL, 0x89d89d89d89d89d8ULL, 0xd89d89d89d89d89dULL, 0x5d89d89d89d89d89ULL},
+        uint256{0x425ed097b425ed06ULL, 0x5ed097b425ed097bULL, 0xd097b425ed097b42ULL, 0x17b425ed097b425eULL},
+        uint256{0x4924924924924915ULL, 0x2492492492492492ULL, 0x9249249249249249ULL, 0x6924924924924924ULL},
+        uint256{0xc234f72c234f72bdULL, 0x72c234f72c234f72ULL, 0x4f72c234f72c234fULL, 0x234f72c234f72c23ULL},
+        uint256{0xeeeeeeeeeeeeeee8ULL, 0xeeeeeeeeeeeeeeeeULL, 0xeeeeeeeeeeeeeeeeULL, 0x2eeeeeeeeeeeeeeeULL},
+    }},
+    // Row 14: 1/16, 1/17, 1/18, 1/19, 1/20, 1/21, 1/22, 1/23, 1/24, 1/25, 1/26, 1/27, 1/28, 1/29, 1/30, 1/31
+    {{
+        uint256{0xfffffffffffffff3ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x57ffffffffffffffULL},
+        uint256{0x5a5a5a5a5a5a5a4dULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL},
+        uint256{0xe38e38e38e38e389ULL, 0x8e38e38e38e38e38ULL, 0x38e38e38e38e38e3ULL, 0x238e38e38e38e38eULL},
+        uint256{0x86bca1af286bca14ULL, 0xbca1af286bca1af2ULL, 0xa1af286bca1af286ULL, 0x2f286bca1af286bcULL},
+        uint256{0x666666666666665cULL, 0x6666666666666666ULL, 0x6666666666666666ULL, 0x4666666666666666ULL},
+        uint256{0x0c30c30c30c30c2fULL, 0x30c30c30c30c30c3ULL, 0xc30c30c30c30c30cULL, 0x0c30c30c30c30c30ULL},
+        uint256{0x745d1745d1745d13ULL, 0x1745d1745d1745d1ULL, 0xd1745d1745d1745dULL, 0x1d1745d1745d1745ULL},
+        uint256{0xe9bd37a6f4de9bc3ULL, 0xa6f4de9bd37a6f4dULL, 0x9bd37a6f4de9bd37ULL, 0x6f4de9bd37a6f4deULL},
+        uint256{0xaaaaaaaaaaaaaaa2ULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x3aaaaaaaaaaaaaaaULL},
+        uint256{0xeb851eb851eb851eULL, 0x1eb851eb851eb851ULL, 0x51eb851eb851eb85ULL, 0x051eb851eb851eb8ULL},
+        uint256{0x9d89d89d89d89d7cULL, 0x89d89d89d89d89d8ULL, 0xd89d89d89d89d89dULL, 0x5d89d89d89d89d89ULL},
+        uint256{0x425ed097b425ed06ULL, 0x5ed097b425ed097bULL, 0xd097b425ed097b42ULL, 0x17b425ed097b425eULL},
+        uint256{0x4924924924924915ULL, 0x2492492492492492ULL, 0x9249249249249249ULL, 0x6924924924924924ULL},
+        uint256{0xc234f72c234f72bdULL, 0x72c234f72c234f72ULL, 0x4f72c234f72c234fULL, 0x234f72c234f72c23ULL},
+        uint256{0xeeeeeeeeeeeeeee8ULL, 0xeeeeeeeeeeeeeeeeULL, 0xeeeeeeeeeeeeeeeeULL, 0x2eeeeeeeeeeeeeeeULL},
+        uint256{0x39ce739ce739ce68ULL, 0x739ce739ce739ce7ULL, 0xe739ce739ce739ceULL, 0x4e739ce739ce739cULL},
+    }},
+    // Row 15: 1/17, 1/18, 1/19, 1/20, 1/21, 1/22, 1/23, 1/24, 1/25, 1/26, 1/27, 1/28, 1/29, 1/30, 1/31, 1/32
+    {{
+        uint256{0x5a5a5a5a5a5a5a4dULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL, 0x5a5a5a5a5a5a5a5aULL},
+        uint256{0xe38e38e38e38e389ULL, 0x8e38e38e38e38e38ULL, 0x38e38e38e38e38e3ULL, 0x238e38e38e38e38eULL},
+        uint256{0x86bca1af286bca14ULL, 0xbca1af286bca1af2ULL, 0xa1af286bca1af286ULL, 0x2f286bca1af286bcULL},
+        uint256{0x666666666666665cULL, 0x6666666666666666ULL, 0x6666666666666666ULL, 0x4666666666666666ULL},
+        uint256{0x0c30c30c30c30c2fULL, 0x30c30c30c30c30c3ULL, 0xc30c30c30c30c30cULL, 0x0c30c30c30c30c30ULL},
+        uint256{0x745d1745d1745d13ULL, 0x1745d1745d1745d1ULL, 0xd1745d1745d1745dULL, 0x1d1745d1745d1745ULL},
+        uint256{0xe9bd37a6f4de9bc3ULL, 0xa6f4de9bd37a6f4dULL, 0x9bd37a6f4de9bd37ULL, 0x6f4de9bd37a6f4deULL},
+        uint256{0xaaaaaaaaaaaaaaa2ULL, 0xaaaaaaaaaaaaaaaaULL, 0xaaaaaaaaaaaaaaaaULL, 0x3aaaaaaaaaaaaaaaULL},
+        uint256{0xeb851eb851eb851eULL, 0x1eb851eb851eb851ULL, 0x51eb851eb851eb85ULL, 0x051eb851eb851eb8ULL},
+        uint256{0x9d89d89d89d89d7cULL, 0x89d89d89d89d89d8ULL, 0xd89d89d89d89d89dULL, 0x5d89d89d89d89d89ULL},
+        uint256{0x425ed097b425ed06ULL, 0x5ed097b425ed097bULL, 0xd097b425ed097b42ULL, 0x17b425ed097b425eULL},
+        uint256{0x4924924924924915ULL, 0x2492492492492492ULL, 0x9249249249249249ULL, 0x6924924924924924ULL},
+        uint256{0xc234f72c234f72bdULL, 0x72c234f72c234f72ULL, 0x4f72c234f72c234fULL, 0x234f72c234f72c23ULL},
+        uint256{0xeeeeeeeeeeeeeee8ULL, 0xeeeeeeeeeeeeeeeeULL, 0xeeeeeeeeeeeeeeeeULL, 0x2eeeeeeeeeeeeeeeULL},
+        uint256{0x39ce739ce739ce68ULL, 0x739ce739ce739ce7ULL, 0xe739ce739ce739ceULL, 0x4e739ce739ce739cULL},
+        uint256{0xfffffffffffffff0ULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL, 0x6bffffffffffffffULL},
+    }},
+}};
+
 // Flags to indicate that precomputed MDS matrices are available
 inline constexpr bool HAS_PRECOMPUTED_MDS_5 = true;
+inline constexpr bool HAS_PRECOMPUTED_MDS_8 = true;
 inline constexpr bool HAS_PRECOMPUTED_MDS_12 = true;
+inline constexpr bool HAS_PRECOMPUTED_MDS_16 = true;
 
 /**
  * @brief Check if a precomputed MDS matrix is available for the given size.
  */
 [[nodiscard]] inline constexpr bool has_precomputed_mds(size_t size) noexcept {
-    return (size == 5 && HAS_PRECOMPUTED_MDS_5) || (size == 12 && HAS_PRECOMPUTED_MDS_12);
+    return (size == 5 && HAS_PRECOMPUTED_MDS_5) || (size == 8 && HAS_PRECOMPUTED_MDS_8) ||
+           (size == 12 && HAS_PRECOMPUTED_MDS_12) || (size == 16 && HAS_PRECOMPUTED_MDS_16);
 }
 
 }  // namespace rescue::mds
@@ -0,0 +1,117 @@
+#pragma once
+
+/**
+ * @file executor.hpp
+ * @brief Executors for the library's parallel APIs.
+ *
+ * Parallel overloads (BasicRescueCipher::encrypt_raw / decrypt_raw with an
+ * Executor, RescuePrimeHash::digest_many) express their work as one
+ * parallel_for and never start threads themselves. Services that already
+ * run a thread pool implement Executor over it, so library work shares
+ * that pool instead of competing with it:
+ *
+ * @code
+ * class MyPoolExecutor : public rescue::Executor {
+ * public:
+ *     size_t concurrency() const noexcept override { return pool_.size(); }
+ *     void parallel_for(size_t n, const Task& task) override { pool_.run_and_wait(n, task); }
+ * private:
+ *     MyPool& pool_;
+ * };
+ * @endcode
+ *
+ * Otherwise default_executor() is a process-wide WorkStealingExecutor.
+ */
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace rescue {
+
+/**
+ * @brief Runs the index-parallel loops of the library.
+ */
+class Executor {
+public:
+    /// Body of a parallel loop, called once per index
+    using Task = std::function<void(size_t)>;
+
+    virtual ~Executor() = default;
+
+    /// Number of threads that may run tasks at the same time (at least 1)
+    [[nodiscard]] virtual size_t concurrency() const noexcept = 0;
+
+    /**
+     * @brief Call task(i) for every i in [0, n) and return when all calls have finished.
+     *
+     * Calls may run on any thread, including the caller, in any order.
+     * Implementations must allow parallel_for from inside a task. If a task
+     * throws, the remaining calls may be skipped and the first exception is
+     * rethrown to the caller.
+     */
+    virtual void parallel_for(size_t n, const Task& task) = 0;
+};
+
+/**
+ * @brief Runs every task on the calling thread, in index order.
+ */
+class SequentialExecutor final : public Executor {
+public:
+    [[nodiscard]] size_t concurrency() const noexcept override { return 1; }
+    void parallel_for(size_t n, const Task& task) override;
+};
+
+/**
+ * @brief Fixed pool of workers with per-worker deques and work stealing.
+ *
+ * A parallel_for splits its index range in halves: a thread keeps working
+ * on one half and pushes the other onto the back of its own deque, and idle
+ * workers steal from the front of other deques, so they take the largest
+ * pieces. The thread that calls parallel_for runs tasks too until the loop
+ * is done. A nested parallel_for therefore runs on the same workers, and no
+ * thread blocks while work it could run is queued, so nesting never adds
+ * threads or deadlocks.
+ */
+class WorkStealingExecutor final : public Executor {
+public:
+    struct Options {
+        /// Worker threads; 0 uses std::thread::hardware_concurrency()
+        size_t threads = 0;
+
+        /// Pin worker i to CPU i modulo the CPU count (Linux; ignored elsewhere)
+        bool pin_threads = false;
+    };
+
+    WorkStealingExecutor() : WorkStealingExecutor(Options{}) {}
+    explicit WorkStealingExecutor(Options options);
+
+    WorkStealingExecutor(const WorkStealingExecutor&) = delete;
+    WorkStealingExecutor& operator=(const WorkStealingExecutor&) = delete;
+
+    /// Finishes queued work, then joins the workers
+    ~WorkStealingExecutor() override;
+
+    [[nodiscard]] size_t concurrency() const noexcept override;
+    void parallel_for(size_t n, const Task& task) override;
+
+private:
+    struct Job;
+    struct Range;
+    struct Worker;
+    struct Shared;
+
+    std::unique_ptr<Shared> shared_;
+    std::vector<std::thread> threads_;
+};
+
+/**
+ * @brief Process-wide WorkStealingExecutor with one worker per hardware thread.
+ *
+ * Created on first use.
+ */
+[[nodiscard]] Executor& default_executor();
+
+}  // namespace rescue
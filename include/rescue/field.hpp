@@ -6,6 +6,10 @@
  *
  * This file provides the Fp class for field element operations over
  * the prime field p = 2^255 - 19 (Curve25519 base field).
+ *
+ * Arithmetic (except inversion and exponentiation) and comparison are
+ * defined inline over the rescue::fp kernels, so callers inline them across
+ * translation units. field.cpp still emits the out-of-line symbols.
  */
 
 #include <rescue/detail/fp_impl.hpp>
@@ -26,7 +30,8 @@ namespace rescue {
  * @brief Field element in F_p where p = 2^255 - 19 (Curve25519 base field).
  *
  * This class provides constant-time arithmetic operations for cryptographic use.
- * All operations are performed modulo the field prime p.
+ * All operations are performed modulo the field prime p. Arithmetic never
+ * allocates; only the string conversions do.
  */
 class Fp {
 public:
@@ -100,6 +105,13 @@ public:
      */
     [[nodiscard]] static Fp create(const uint256& value);
 
+    /**
+     * @brief Wrap a value the caller guarantees is already in [0, p).
+     *
+     * Skips the reduction, for results of the rescue::fp kernels.
+     */
+    [[nodiscard]] static Fp from_reduced(const uint256& value) { return Fp(value, Reduced{}); }
+
     // Arithmetic operations
 
     /**
@@ -107,27 +119,27 @@ public:
      * @param rhs Right-hand side operand.
      * @return this + rhs (mod p).
      */
-    [[nodiscard]] Fp add(const Fp& rhs) const;
+    [[nodiscard]] Fp add(const Fp& rhs) const { return Fp(fp::add(value_, rhs.value_), Reduced{}); }
 
     /**
      * @brief Subtract two field elements.
      * @param rhs Right-hand side operand.
      * @return this - rhs (mod p).
      */
-    [[nodiscard]] Fp sub(const Fp& rhs) const;
+    [[nodiscard]] Fp sub(const Fp& rhs) const { return Fp(fp::sub(value_, rhs.value_), Reduced{}); }
 
     /**
      * @brief Multiply two field elements.
      * @param rhs Right-hand side operand.
      * @return this * rhs (mod p).
      */
-    [[nodiscard]] Fp mul(const Fp& rhs) const;
+    [[nodiscard]] Fp mul(const Fp& rhs) const { return Fp(fp::mul(value_, rhs.value_), Reduced{}); }
 
     /**
      * @brief Negate the field element.
      * @return -this (mod p).
      */
-    [[nodiscard]] Fp neg() const;
+    [[nodiscard]] Fp neg() const { return Fp(fp::neg(value_), Reduced{}); }
 
     /**
      * @brief Compute the multiplicative inverse.
@@ -154,7 +166,7 @@ public:
      * @brief Square the field element.
      * @return this^2 (mod p).
      */
-    [[nodiscard]] Fp square() const;
+    [[nodiscard]] Fp square() const { return Fp(fp::sqr(value_), Reduced{}); }
 
     // Comparison operations
 
@@ -162,23 +174,23 @@ public:
      * @brief Check if this is zero.
      * @return True if this == 0.
      */
-    [[nodiscard]] bool is_zero() const;
+    [[nodiscard]] bool is_zero() const { return value_.is_zero(); }
 
     /**
      * @brief Check if this is one.
      * @return True if this == 1.
      */
-    [[nodiscard]] bool is_one() const;
+    [[nodiscard]] bool is_one() const { return value_.is_one(); }
 
     /**
      * @brief Equality comparison.
      */
-    [[nodiscard]] bool operator==(const Fp& rhs) const;
+    [[nodiscard]] bool operator==(const Fp& rhs) const { return value_ == rhs.value_; }
 
     /**
      * @brief Three-way comparison (for ordering, not constant-time).
      */
-    [[nodiscard]] std::strong_ordering operator<=>(const Fp& rhs) const;
+    [[nodiscard]] std::strong_ordering operator<=>(const Fp& rhs) const { return value_ <=> rhs.value_; }
 
     // Serialization
 
@@ -245,6 +257,11 @@ public:
 private:
     uint256 value_;
 
+    /// Tag for values the fp kernels already reduced to [0, p)
+    struct Reduced {};
+
+    Fp(const uint256& value, Reduced) : value_(value) {}
+
     /**
      * @brief Reduce the value modulo p (internal helper).
      */
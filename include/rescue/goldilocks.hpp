@@ -0,0 +1,225 @@
+#pragma once
+
+/**
+ * @file goldilocks.hpp
+ * @brief The 64-bit Goldilocks prime field, p = 2^64 - 2^32 + 1.
+ *
+ * An alternative to Fp for internal hashing where the field is ours to
+ * choose. Elements fit one machine word, and a product reduces with a few
+ * adds and subtracts using 2^64 = 2^32 - 1 and 2^96 = -1 (mod p), so a
+ * permutation costs a small fraction of the 2^255 - 19 one. Arithmetic is
+ * header-inline so that it folds into the permutation loops.
+ */
+
+#include <rescue/detail/uint256.hpp>
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <span>
+
+namespace rescue {
+
+/**
+ * @brief Element of F_p with p = 2^64 - 2^32 + 1, held in canonical form.
+ */
+class Goldilocks {
+public:
+    /// The modulus as a machine word
+    static constexpr uint64_t MODULUS = 0xFFFFFFFF00000001ULL;
+
+    /// The modulus as uint256, for parameter derivation shared with Fp
+    static const uint256 P;
+
+    /// Number of bits in the field modulus
+    static constexpr size_t BITS = 64;
+
+    /// Number of bytes in a serialized element
+    static constexpr size_t BYTES = 8;
+
+    /// Zero element
+    static const Goldilocks ZERO;
+
+    /// One element (multiplicative identity)
+    static const Goldilocks ONE;
+
+    constexpr Goldilocks() = default;
+
+    /**
+     * @brief Construct from an unsigned integer (reduced modulo p).
+     */
+    constexpr explicit Goldilocks(uint64_t value) : value_(canonical(value)) {}
+
+    /**
+     * @brief Construct from a uint256 (reduced modulo p).
+     */
+    constexpr explicit Goldilocks(const uint256& value) {
+        // Horner over 64-bit limbs, most significant first
+        Goldilocks acc;
+        for (size_t i = uint256::LIMBS; i-- > 0;) {
+            acc = acc * Goldilocks(TWO_64_MOD_P) + Goldilocks(value.limb(i));
+        }
+        value_ = acc.value_;
+    }
+
+    [[nodiscard]] constexpr Goldilocks operator+(const Goldilocks& rhs) const {
+        uint64_t sum = value_ + rhs.value_;
+        // On carry, 2^64 = EPSILON (mod p)
+        uint64_t adj = sum < value_ ? EPSILON : 0;
+        return from_canonical(canonical(sum + adj));
+    }
+
+    [[nodiscard]] constexpr Goldilocks operator-(const Goldilocks& rhs) const {
+        uint64_t diff = value_ - rhs.value_;
+        // On borrow, the wrapped result is 2^64 too large: subtract EPSILON
+        uint64_t adj = value_ < rhs.value_ ? EPSILON : 0;
+        return from_canonical(diff - adj);
+    }
+
+    [[nodiscard]] constexpr Goldilocks operator-() const { return Goldilocks() - *this; }
+
+    [[nodiscard]] constexpr Goldilocks operator*(const Goldilocks& rhs) const {
+        uint64_t hi = 0;
+        uint64_t lo = mul_wide(value_, rhs.value_, hi);
+        return from_canonical(reduce128(hi, lo));
+    }
+
+    constexpr Goldilocks& operator+=(const Goldilocks& rhs) { return *this = *this + rhs; }
+    constexpr Goldilocks& operator-=(const Goldilocks& rhs) { return *this = *this - rhs; }
+    constexpr Goldilocks& operator*=(const Goldilocks& rhs) { return *this = *this * rhs; }
+
+    [[nodiscard]] constexpr Goldilocks square() const { return *this * *this; }
+
+    /**
+     * @brief Raise to a public exponent.
+     */
+    [[nodiscard]] constexpr Goldilocks pow(uint64_t exp) const {
+        Goldilocks result = unit();
+        Goldilocks base = *this;
+        while (exp != 0) {
+            if ((exp & 1) != 0) {
+                result *= base;
+            }
+            base = base.square();
+            exp >>= 1;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Raise to a public exponent given as uint256.
+     */
+    [[nodiscard]] constexpr Goldilocks pow(const uint256& exp) const {
+        Goldilocks result = unit();
+        for (size_t i = exp.bit_length(); i-- > 0;) {
+            result = result.square();
+            if (exp.bit(i)) {
+                result *= *this;
+            }
+        }
+        return result;
+    }
+
+    /**
+     * @brief Multiplicative inverse via Fermat, x^(p-2). The inverse of 0 is 0.
+     */
+    [[nodiscard]] constexpr Goldilocks inv() const { return pow(MODULUS - 2); }
+
+    [[nodiscard]] constexpr bool is_zero() const { return value_ == 0; }
+
+    [[nodiscard]] constexpr bool operator==(const Goldilocks& rhs) const = default;
+    [[nodiscard]] constexpr std::strong_ordering operator<=>(const Goldilocks& rhs) const = default;
+
+    /// Canonical value in [0, p)
+    [[nodiscard]] constexpr uint64_t value() const { return value_; }
+
+    /**
+     * @brief Serialize to 8 bytes, little-endian.
+     */
+    [[nodiscard]] std::array<uint8_t, BYTES> to_bytes() const {
+        std::array<uint8_t, BYTES> out{};
+        to_bytes(out);
+        return out;
+    }
+
+    void to_bytes(std::span<uint8_t, BYTES> out) const {
+        for (size_t i = 0; i < BYTES; ++i) {
+            out[i] = static_cast<uint8_t>(value_ >> (8 * i));
+        }
+    }
+
+    /**
+     * @brief Deserialize up to 8 little-endian bytes, reducing modulo p.
+     */
+    [[nodiscard]] static Goldilocks from_bytes(std::span<const uint8_t> bytes) {
+        uint64_t v = 0;
+        for (size_t i = 0; i < bytes.size() && i < BYTES; ++i) {
+            v |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+        }
+        return Goldilocks(v);
+    }
+
+    friend std::ostream& operator<<(std::ostream& os, const Goldilocks& x) { return os << x.value_; }
+
+private:
+    /// 2^64 mod p = 2^32 - 1
+    static constexpr uint64_t EPSILON = 0xFFFFFFFFULL;
+    static constexpr uint64_t TWO_64_MOD_P = EPSILON;
+
+    uint64_t value_ = 0;
+
+    static constexpr Goldilocks unit() { return from_canonical(1); }
+
+    static constexpr Goldilocks from_canonical(uint64_t v) {
+        Goldilocks x;
+        x.value_ = v;
+        return x;
+    }
+
+    static constexpr uint64_t canonical(uint64_t v) { return v >= MODULUS ? v - MODULUS : v; }
+
+    static constexpr uint64_t mul_wide(uint64_t a, uint64_t b, uint64_t& hi) {
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef unsigned __int128 u128;
+        u128 p = static_cast<u128>(a) * b;
+        hi = static_cast<uint64_t>(p >> 64);
+        return static_cast<uint64_t>(p);
+#else
+        uint64_t a_lo = a & 0xFFFFFFFF, a_hi = a >> 32;
+        uint64_t b_lo = b & 0xFFFFFFFF, b_hi = b >> 32;
+        uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi, hl = a_hi * b_lo, hh = a_hi * b_hi;
+        uint64_t mid = (ll >> 32) + (lh & 0xFFFFFFFF) + (hl & 0xFFFFFFFF);
+        hi = hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+        return (mid << 32) | (ll & 0xFFFFFFFF);
+#endif
+    }
+
+    /**
+     * @brief Reduce hi * 2^64 + lo using 2^64 = 2^32 - 1 and 2^96 = -1.
+     */
+    static constexpr uint64_t reduce128(uint64_t hi, uint64_t lo) {
+        uint64_t hi_hi = hi >> 32;
+        uint64_t hi_lo = hi & EPSILON;
+
+        // lo - hi_hi, borrowing 2^64 = EPSILON
+        uint64_t t0 = lo - hi_hi;
+        if (lo < hi_hi) {
+            t0 -= EPSILON;
+        }
+        // + hi_lo * (2^32 - 1), which is < 2^64
+        uint64_t t1 = hi_lo * EPSILON;
+        uint64_t t2 = t0 + t1;
+        if (t2 < t1) {
+            t2 += EPSILON;
+        }
+        return canonical(t2);
+    }
+};
+
+inline const uint256 Goldilocks::P{Goldilocks::MODULUS};
+inline const Goldilocks Goldilocks::ZERO{};
+inline const Goldilocks Goldilocks::ONE{uint64_t{1}};
+
+}  // namespace rescue
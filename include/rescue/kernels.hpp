@@ -0,0 +1,110 @@
+#pragma once
+
+/**
+ * @file kernels.hpp
+ * @brief Runtime selection of the compiled-in permutation kernels.
+ *
+ * The hot permutation kernels are compiled several times from the same
+ * source, once per code-generation variant: the build's baseline and
+ * x86-64 with BMI2/ADX (mulx for the 64x64-bit products).
+ * On first use the library reads the CPU features once and binds each
+ * kernel to the best variant the host supports. Field multiplication and
+ * squaring are inlined into every variant rather than dispatched on their
+ * own, since an indirect call would cost as much as the operation.
+ *
+ * The environment variable RESCUE_FORCE_KERNEL pins variants, for A/B
+ * benchmarking or to rule a variant out on a suspect host:
+ *
+ * @code
+ * RESCUE_FORCE_KERNEL=portable                 # every kernel
+ * RESCUE_FORCE_KERNEL=sbox=bmi2,mds=portable   # per kernel
+ * @endcode
+ *
+ * A variant that is not compiled in or that the host cannot run is an
+ * error (std::runtime_error from the first permutation), so a pinned run
+ * never silently falls back.
+ *
+ * @code
+ * std::clog << "rescue kernels: " << rescue::active_kernels() << "\n";
+ * @endcode
+ */
+
+#include <cstddef>
+#include <string>
+
+namespace rescue {
+
+/**
+ * @brief Dispatched kernels.
+ */
+enum class Kernel : size_t {
+    PERMUTATION,  ///< Forward rounds of permute_in_place and permute_many
+    SBOX,         ///< Element-wise S-box of the inverse and traced permutations
+    MDS,          ///< MDS matrix-vector product of the inverse and traced permutations
+    COUNT
+};
+
+/// Number of dispatched kernels
+inline constexpr size_t KERNEL_COUNT = static_cast<size_t>(Kernel::COUNT);
+
+/**
+ * @brief Code-generation variants, each compiled from the same source.
+ */
+enum class KernelVariant : size_t {
+    PORTABLE,  ///< Baseline instruction set of the build
+    BMI2,      ///< x86-64 with BMI2 and ADX
+    COUNT
+};
+
+/// Number of kernel variants
+inline constexpr size_t KERNEL_VARIANT_COUNT = static_cast<size_t>(KernelVariant::COUNT);
+
+/**
+ * @brief Host CPU features relevant to variant selection.
+ */
+struct CpuFeatures {
+    bool bmi2 = false;
+    bool adx = false;
+};
+
+/// Features of the host, detected once
+[[nodiscard]] const CpuFeatures& cpu_features() noexcept;
+
+[[nodiscard]] const char* name(Kernel k) noexcept;
+[[nodiscard]] const char* name(KernelVariant v) noexcept;
+
+/**
+ * @brief Whether a variant is compiled into this build and the host can run it.
+ */
+[[nodiscard]] bool kernel_variant_available(KernelVariant v) noexcept;
+
+/**
+ * @brief The variant a kernel is currently bound to.
+ * @throws std::runtime_error if RESCUE_FORCE_KERNEL is invalid.
+ */
+[[nodiscard]] KernelVariant active_variant(Kernel k);
+
+/**
+ * @brief Current binding of every kernel, e.g. "permutation=bmi2 sbox=bmi2 mds=bmi2".
+ * @throws std::runtime_error if RESCUE_FORCE_KERNEL is invalid.
+ */
+[[nodiscard]] std::string active_kernels();
+
+/**
+ * @brief Bind one kernel to a variant, for all threads.
+ * @throws std::invalid_argument if the variant is not available.
+ */
+void set_kernel_variant(Kernel k, KernelVariant v);
+
+/**
+ * @brief Bind every kernel to a variant, for all threads.
+ * @throws std::invalid_argument if the variant is not available.
+ */
+void set_kernel_variant(KernelVariant v);
+
+/**
+ * @brief Restore the startup binding: detection plus RESCUE_FORCE_KERNEL.
+ */
+void reset_kernel_variants();
+
+}  // namespace rescue
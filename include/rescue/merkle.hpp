@@ -0,0 +1,78 @@
+#pragma once
+
+/**
+ * @file merkle.hpp
+ * @brief Batched verification of Rescue-Prime Merkle inclusion paths.
+ *
+ * Nodes are hashed as RescuePrimeHash::digest(left || right): the two
+ * five-element children are absorbed in two rate-7 blocks, so a parent costs
+ * two permutations. MerkleVerifier::verify_paths checks many paths together:
+ * it walks all of them level by level, computes each distinct parent only
+ * once when paths overlap, and runs the remaining parents of a level through
+ * RescueDesc::permute_many.
+ */
+
+#include <rescue/field.hpp>
+#include <rescue/rescue_desc.hpp>
+#include <rescue/rescue_hash.hpp>
+
+#include <array>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace rescue {
+
+/// A Merkle node: a RescuePrimeHash digest
+using MerkleDigest = std::array<Fp, RESCUE_HASH_DIGEST_LENGTH>;
+
+/**
+ * @brief Inclusion path of one leaf.
+ */
+struct MerklePath {
+    /// The leaf digest
+    MerkleDigest leaf{};
+
+    /// Leaf position; bit k selects whether the node at level k is a right child
+    uint64_t index = 0;
+
+    /// Sibling digests from the leaf level up to just below the root
+    std::vector<MerkleDigest> siblings;
+};
+
+/**
+ * @brief Verifies Merkle paths hashed with the default RescuePrimeHash.
+ *
+ * Construction derives the hash parameters once; verification is const and
+ * may run concurrently from several threads.
+ */
+class MerkleVerifier {
+public:
+    MerkleVerifier();
+
+    /**
+     * @brief Parent of two nodes, equal to RescuePrimeHash().digest(left || right).
+     */
+    [[nodiscard]] MerkleDigest hash_pair(const MerkleDigest& left, const MerkleDigest& right) const;
+
+    /**
+     * @brief Verify a single path.
+     * @return true if the path leads from its leaf to root.
+     */
+    [[nodiscard]] bool verify_path(const MerklePath& path, const MerkleDigest& root) const;
+
+    /**
+     * @brief Verify a batch of paths against the same root.
+     *
+     * Paths may have different lengths. A path whose index does not fit its
+     * length is invalid.
+     *
+     * @return One flag per path, true if that path is valid.
+     */
+    [[nodiscard]] std::vector<bool> verify_paths(std::span<const MerklePath> paths, const MerkleDigest& root) const;
+
+private:
+    RescueDesc desc_;
+};
+
+}  // namespace rescue
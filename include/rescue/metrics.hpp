@@ -0,0 +1,203 @@
+#pragma once
+
+/**
+ * @file metrics.hpp
+ * @brief Opt-in runtime metrics: operation counters and per-phase timers.
+ *
+ * Metrics are disabled by default. Call rescue::metrics::set_enabled(true) to
+ * start collecting; while disabled every hook is a single relaxed atomic load
+ * and branch, and timers never read the clock.
+ *
+ * Writes go to a per-thread shard (no contention, no read-modify-write across
+ * threads). snapshot() sums all shards without locking, so it can be called
+ * from a scrape thread while other threads keep encrypting.
+ *
+ * A thread's first update allocates its shard (or reuses one released by an
+ * exited thread); later updates never allocate.
+ *
+ * @code
+ * rescue::metrics::set_enabled(true);
+ * // ... use RescueCipher / RescuePrimeHash ...
+ * auto snap = rescue::metrics::snapshot();
+ * std::string body = rescue::metrics::to_prometheus(snap);
+ * @endcode
+ */
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace rescue::metrics {
+
+/**
+ * @brief Monotonic event counters.
+ */
+enum class Counter : size_t {
+    PERMUTATIONS,          ///< Rescue permutations (forward or inverse) executed
+    ELEMENTS_ENCRYPTED,    ///< Field elements encrypted in CTR mode
+    ELEMENTS_DECRYPTED,    ///< Field elements decrypted in CTR mode
+    HASH_BLOCKS_ABSORBED,  ///< Rate-sized blocks absorbed by RescuePrimeHash
+    CIPHER_CONSTRUCTIONS,  ///< Cipher instances constructed
+    COUNT
+};
+
+/**
+ * @brief Timed phases of the library.
+ */
+enum class Phase : size_t {
+    KEY_DERIVATION,     ///< Shared secret to cipher key (KDF)
+    ROUND_PARAMETERS,   ///< Alpha, its inverse and the round count for a RescueDesc
+    MDS_SETUP,          ///< MDS matrix and its inverse for a RescueDesc
+    CONSTANT_SAMPLING,  ///< SHAKE256 round-constant sampling
+    KEY_SCHEDULE,       ///< Round-key expansion from the cipher key
+    ENCRYPTION,         ///< encrypt_raw
+    DECRYPTION,         ///< decrypt_raw
+    COUNT
+};
+
+constexpr size_t COUNTER_COUNT = static_cast<size_t>(Counter::COUNT);
+constexpr size_t PHASE_COUNT = static_cast<size_t>(Phase::COUNT);
+
+/// Histogram buckets: bucket i counts durations <= 2^i microseconds, the
+/// last bucket counts everything longer.
+constexpr size_t HISTOGRAM_BUCKETS = 25;
+
+/**
+ * @brief Upper bound of histogram bucket @p i in nanoseconds (0 for +Inf).
+ */
+[[nodiscard]] constexpr uint64_t bucket_upper_bound_ns(size_t i) noexcept {
+    return i + 1 < HISTOGRAM_BUCKETS ? (uint64_t{1000} << i) : 0;
+}
+
+/**
+ * @brief Aggregated timings for one phase.
+ */
+struct PhaseStats {
+    uint64_t count = 0;
+    uint64_t total_ns = 0;
+    std::array<uint64_t, HISTOGRAM_BUCKETS> buckets{};  ///< Non-cumulative
+
+    [[nodiscard]] double mean_ns() const noexcept {
+        return count == 0 ? 0.0 : static_cast<double>(total_ns) / static_cast<double>(count);
+    }
+};
+
+/**
+ * @brief Point-in-time sum over all thread shards.
+ */
+struct Snapshot {
+    std::array<uint64_t, COUNTER_COUNT> counters{};
+    std::array<PhaseStats, PHASE_COUNT> phases{};
+
+    [[nodiscard]] uint64_t counter(Counter c) const noexcept {
+        return counters[static_cast<size_t>(c)];
+    }
+    [[nodiscard]] const PhaseStats& phase(Phase p) const noexcept {
+        return phases[static_cast<size_t>(p)];
+    }
+};
+
+namespace detail {
+
+inline std::atomic<bool> metrics_enabled{false};
+
+void add_counter(Counter c, uint64_t n) noexcept;
+void record_phase(Phase p, uint64_t ns) noexcept;
+
+}  // namespace detail
+
+/**
+ * @brief Enable or disable metrics collection process-wide.
+ */
+void set_enabled(bool enabled) noexcept;
+
+/**
+ * @brief Check whether metrics collection is enabled.
+ */
+[[nodiscard]] inline bool enabled() noexcept {
+    return detail::metrics_enabled.load(std::memory_order_relaxed);
+}
+
+/**
+ * @brief Add @p n to a counter on the calling thread's shard.
+ */
+inline void add(Counter c, uint64_t n = 1) noexcept {
+    if (enabled()) {
+        detail::add_counter(c, n);
+    }
+}
+
+/**
+ * @brief Record one duration for a phase on the calling thread's shard.
+ */
+inline void record(Phase p, std::chrono::nanoseconds duration) noexcept {
+    if (enabled()) {
+        detail::record_phase(p, static_cast<uint64_t>(duration.count()));
+    }
+}
+
+/**
+ * @brief RAII timer recording the lifetime of a scope into a phase.
+ *
+ * The clock is only read when metrics were enabled at construction.
+ */
+class ScopedTimer {
+public:
+    explicit ScopedTimer(Phase phase) noexcept : phase_(phase), active_(enabled()) {
+        if (active_) {
+            start_ = std::chrono::steady_clock::now();
+        }
+    }
+
+    ~ScopedTimer() {
+        if (active_) {
+            record(phase_, std::chrono::steady_clock::now() - start_);
+        }
+    }
+
+    ScopedTimer(const ScopedTimer&) = delete;
+    ScopedTimer& operator=(const ScopedTimer&) = delete;
+
+private:
+    Phase phase_;
+    bool active_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+/**
+ * @brief Sum all thread shards without blocking writers.
+ *
+ * Each value is read atomically; values recorded concurrently with the
+ * snapshot may or may not be included.
+ */
+[[nodiscard]] Snapshot snapshot();
+
+/**
+ * @brief Zero all shards (intended for tests and benchmarks).
+ *
+ * Updates racing with reset() on other threads may survive it.
+ */
+void reset() noexcept;
+
+/**
+ * @brief Metric name suffix for a counter, e.g. "permutations".
+ */
+[[nodiscard]] const char* name(Counter c) noexcept;
+
+/**
+ * @brief Label value for a phase, e.g. "key_derivation".
+ */
+[[nodiscard]] const char* name(Phase p) noexcept;
+
+/**
+ * @brief Render a snapshot in the Prometheus text exposition format.
+ *
+ * Counters are exported as rescue_<name>_total and phases as the histogram
+ * rescue_phase_duration_seconds{phase="..."}.
+ */
+[[nodiscard]] std::string to_prometheus(const Snapshot& snap);
+
+}  // namespace rescue::metrics
@@ -0,0 +1,173 @@
+#pragma once
+
+/**
+ * @file mmr.hpp
+ * @brief Append-only Merkle Mountain Range over the Rescue-Prime permutation.
+ *
+ * A Merkle Mountain Range is a list of perfect binary trees ("peaks") whose
+ * sizes follow the binary digits of the leaf count. Appending a leaf merges
+ * equal-height peaks, one two-to-one compression per merge, so an append
+ * costs one permutation amortized and at most log2(n). The root bags the
+ * peaks right to left together with the leaf count.
+ *
+ * Nodes are stored in post-order, the order in which they are created, so
+ * the node list can be journaled to an append-only file and replayed.
+ *
+ * Two-to-one compression runs the 12-element hash permutation once over
+ * [left, right, domain, length] and keeps the first RESCUE_HASH_DIGEST_LENGTH
+ * elements. Internal nodes and bagging steps use distinct domain tags.
+ */
+
+#include <rescue/field.hpp>
+#include <rescue/rescue_desc.hpp>
+#include <rescue/rescue_hash.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace rescue {
+
+/// A node or leaf digest: RESCUE_HASH_DIGEST_LENGTH field elements
+using MmrDigest = std::array<Fp, RESCUE_HASH_DIGEST_LENGTH>;
+
+/// Serialized size of an MmrDigest in a journal file
+constexpr size_t MMR_DIGEST_BYTES = RESCUE_HASH_DIGEST_LENGTH * Fp::BYTES;
+
+/**
+ * @brief Inclusion proof for one leaf against an MMR root.
+ */
+struct MmrProof {
+    /// Zero-based index of the proven leaf
+    uint64_t leaf_index = 0;
+
+    /// Number of leaves when the proof was made (determines the peaks)
+    uint64_t leaf_count = 0;
+
+    /// Sibling digests from the leaf up to its peak
+    std::vector<MmrDigest> siblings;
+
+    /// All peaks, left (tallest) to right
+    std::vector<MmrDigest> peaks;
+};
+
+/**
+ * @brief Append-only Merkle Mountain Range accumulator.
+ *
+ * Leaves are digests supplied by the caller, typically RescuePrimeHash
+ * outputs. Not thread-safe for concurrent appends; const members may be
+ * called concurrently when no append is in progress.
+ */
+class MerkleMountainRange {
+public:
+    /**
+     * @brief Create an empty in-memory MMR.
+     */
+    MerkleMountainRange();
+
+    /**
+     * @brief Open an MMR journaled to an append-only file.
+     *
+     * Existing nodes are loaded from the file. A torn tail left by a crash
+     * (a partial record, or a leaf without all of its merges) is truncated
+     * back to the last complete append. Every node created afterwards is
+     * appended to the file; call flush() to push them to the OS.
+     *
+     * Stored nodes are trusted, not recomputed.
+     *
+     * @throws std::runtime_error if the file cannot be opened or read.
+     */
+    explicit MerkleMountainRange(const std::filesystem::path& journal);
+
+    MerkleMountainRange(const MerkleMountainRange&) = delete;
+    MerkleMountainRange& operator=(const MerkleMountainRange&) = delete;
+    MerkleMountainRange(MerkleMountainRange&&) noexcept = default;
+    MerkleMountainRange& operator=(MerkleMountainRange&&) noexcept = default;
+    ~MerkleMountainRange() = default;
+
+    /**
+     * @brief Append a leaf.
+     *
+     * The leaf and its merged nodes reach the journal in one write before the
+     * in-memory state changes, so a failed write leaves the MMR as it was.
+     * The journal stream stays failed afterwards; reopening the file
+     * truncates any partial record.
+     *
+     * @return The index of the new leaf.
+     * @throws std::runtime_error if writing the journal fails.
+     */
+    uint64_t append(const MmrDigest& leaf);
+
+    /**
+     * @brief Commitment to all leaves: the bagged peaks and the leaf count.
+     *
+     * Costs one compression per peak. The empty MMR has an all-zero root.
+     */
+    [[nodiscard]] MmrDigest root() const;
+
+    /**
+     * @brief Build an inclusion proof for a leaf against the current root.
+     * @throws std::out_of_range if leaf_index >= leaf_count().
+     */
+    [[nodiscard]] MmrProof prove(uint64_t leaf_index) const;
+
+    /**
+     * @brief Check an inclusion proof.
+     * @return true if leaf is at proof.leaf_index in an MMR of
+     *         proof.leaf_count leaves with the given root.
+     */
+    [[nodiscard]] bool verify(const MmrDigest& root, const MmrDigest& leaf, const MmrProof& proof) const;
+
+    /**
+     * @brief Two-to-one compression of internal nodes.
+     */
+    [[nodiscard]] MmrDigest hash_children(const MmrDigest& left, const MmrDigest& right) const;
+
+    /// Number of leaves appended
+    [[nodiscard]] uint64_t leaf_count() const { return leaf_count_; }
+
+    /// Number of stored nodes (leaves and internal nodes)
+    [[nodiscard]] size_t node_count() const { return nodes_.size(); }
+
+    /// Node at a post-order position
+    [[nodiscard]] const MmrDigest& node(size_t position) const { return nodes_.at(position); }
+
+    /**
+     * @brief Flush journaled nodes to the file.
+     * @throws std::runtime_error if writing fails.
+     */
+    void flush();
+
+    /**
+     * @brief Number of nodes in an MMR of leaf_count leaves.
+     */
+    [[nodiscard]] static constexpr uint64_t node_count_for(uint64_t leaf_count) {
+        return 2 * leaf_count - static_cast<uint64_t>(std::popcount(leaf_count));
+    }
+
+private:
+    RescueDesc desc_;
+    std::vector<MmrDigest> nodes_;
+    std::vector<size_t> peaks_;  // node positions, left to right
+    uint64_t leaf_count_ = 0;
+    std::optional<std::ofstream> journal_;
+
+    [[nodiscard]] MmrDigest compress(const MmrDigest& left, const MmrDigest& right, uint64_t domain,
+                                     uint64_t length) const;
+    /// The one peak fold shared by root() and verify(); peak(i) is the i-th peak, left to right
+    template <typename PeakFn>
+    [[nodiscard]] MmrDigest bag(size_t n_peaks, PeakFn&& peak, uint64_t leaf_count) const;
+    /// Nodes one append can create: the leaf and one per merge
+    static constexpr size_t MAX_APPEND_NODES = 64;
+
+    void write_journal(std::span<const MmrDigest> nodes);
+    void rebuild_peaks();
+};
+
+}  // namespace rescue
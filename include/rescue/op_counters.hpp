@@ -0,0 +1,116 @@
+#pragma once
+
+/**
+ * @file op_counters.hpp
+ * @brief Optional field-operation counters for cost modelling.
+ *
+ * When the library is built with -DRESCUE_OP_COUNTERS=ON, every primitive in
+ * rescue::fp increments a thread-local counter. OpCountScope reports how many
+ * operations ran on the current thread while it was alive, which gives a
+ * hardware-independent cost for each API call:
+ *
+ * @code
+ * rescue::OpCountScope scope;
+ * auto digest = hasher.digest(message);
+ * rescue::OpCounts ops = scope.counts();  // ops.mul, ops.sqr, ...
+ * @endcode
+ *
+ * Counts are inclusive: composite operations (pow5, inv, pow) are counted
+ * themselves and also increment the mul/sqr calls they are built from.
+ *
+ * Without the option, RESCUE_COUNT_OP expands to nothing, so the primitives
+ * compile exactly as before and OpCountScope always reports zero.
+ */
+
+#include <cstdint>
+#include <type_traits>
+
+namespace rescue {
+
+/**
+ * @brief Number of calls to each rescue::fp primitive.
+ */
+struct OpCounts {
+    uint64_t add = 0;
+    uint64_t sub = 0;
+    uint64_t mul = 0;
+    uint64_t sqr = 0;
+    uint64_t pow5 = 0;
+    uint64_t inv = 0;
+    uint64_t pow = 0;
+
+    /// Multiplications including squarings, the dominant cost.
+    [[nodiscard]] constexpr uint64_t multiplications() const noexcept { return mul + sqr; }
+
+    [[nodiscard]] constexpr OpCounts operator-(const OpCounts& other) const noexcept {
+        return OpCounts{add - other.add, sub - other.sub, mul - other.mul, sqr - other.sqr,
+                        pow5 - other.pow5, inv - other.inv, pow - other.pow};
+    }
+
+    [[nodiscard]] constexpr bool operator==(const OpCounts&) const noexcept = default;
+};
+
+/**
+ * @brief Check whether the library was built with RESCUE_OP_COUNTERS.
+ */
+[[nodiscard]] constexpr bool op_counters_enabled() noexcept {
+#if defined(RESCUE_OP_COUNTERS) && RESCUE_OP_COUNTERS
+    return true;
+#else
+    return false;
+#endif
+}
+
+namespace detail {
+
+#if defined(RESCUE_OP_COUNTERS) && RESCUE_OP_COUNTERS
+/// Per-thread operation tallies, incremented by RESCUE_COUNT_OP.
+inline thread_local OpCounts thread_op_counts;
+#endif
+
+}  // namespace detail
+
+/**
+ * @brief Snapshot of the current thread's cumulative operation counts.
+ */
+[[nodiscard]] inline OpCounts current_op_counts() noexcept {
+#if defined(RESCUE_OP_COUNTERS) && RESCUE_OP_COUNTERS
+    return detail::thread_op_counts;
+#else
+    return OpCounts{};
+#endif
+}
+
+/**
+ * @brief Counts field operations on the current thread since construction.
+ */
+class OpCountScope {
+public:
+    OpCountScope() noexcept : start_(current_op_counts()) {}
+
+    /// Operations performed on this thread since the scope was created.
+    [[nodiscard]] OpCounts counts() const noexcept { return current_op_counts() - start_; }
+
+private:
+    OpCounts start_;
+};
+
+}  // namespace rescue
+
+/**
+ * @brief Increment the thread-local counter for primitive @p op.
+ *
+ * Skipped during constant evaluation so constexpr primitives stay constexpr.
+ */
+#if defined(RESCUE_OP_COUNTERS) && RESCUE_OP_COUNTERS
+#define RESCUE_COUNT_OP(op)                          \
+    do {                                             \
+        if (!std::is_constant_evaluated()) {         \
+            ++::rescue::detail::thread_op_counts.op; \
+        }                                            \
+    } while (0)
+#else
+#define RESCUE_COUNT_OP(op) \
+    do {                    \
+    } while (0)
+#endif
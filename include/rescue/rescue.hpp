@@ -36,15 +36,42 @@
 // Utility functions
 #include <rescue/utils.hpp>
 
+// Field-operation counters (RESCUE_OP_COUNTERS builds)
+#include <rescue/op_counters.hpp>
+
+// Runtime metrics (opt-in counters and phase timers)
+#include <rescue/metrics.hpp>
+
 // Rescue core (permutation, parameters)
 #include <rescue/rescue_desc.hpp>
 
+// Kernel variant dispatch (CPU feature detection, overrides)
+#include <rescue/kernels.hpp>
+
+// Executors for the parallel APIs (work-stealing pool)
+#include <rescue/executor.hpp>
+
 // Rescue-Prime hash function
 #include <rescue/rescue_hash.hpp>
 
+// Memoizing hash wrapper
+#include <rescue/caching_hasher.hpp>
+
+// Rescue-Prime over other fields (Goldilocks)
+#include <rescue/rescue_prime.hpp>
+
 // Rescue cipher (CTR mode)
 #include <rescue/rescue_cipher.hpp>
 
+// Merkle Mountain Range accumulator
+#include <rescue/mmr.hpp>
+
+// Batched Merkle path verification
+#include <rescue/merkle.hpp>
+
+// Columnar permutation traces
+#include <rescue/trace.hpp>
+
 /**
  * @namespace rescue
  * @brief Namespace containing all Rescue cipher library components.
@@ -54,4 +81,5 @@
  * - rescue::Matrix - Matrix operations over Fp
  * - rescue::RescuePrimeHash - Sponge-based hash function
  * - rescue::RescueCipher - Block cipher in CTR mode
+ * - rescue::GoldilocksRescuePrimeHash - Rescue-Prime over the 64-bit Goldilocks field
  */
@@ -0,0 +1,158 @@
+#ifndef RESCUE_C_H
+#define RESCUE_C_H
+
+/**
+ * @file rescue_c.h
+ * @brief Stable C ABI for foreign-function callers.
+ *
+ * Handles are opaque and buffers are flat: every field element is 32 bytes
+ * little-endian, and a run of n elements is n * 32 contiguous bytes. All
+ * output buffers are owned by the caller. Functions report failures through
+ * rescue_status and never let a C++ exception cross the boundary.
+ *
+ * The batch entry points take many messages in one call so that runtimes such
+ * as Node or Python pay the FFI crossing once per batch instead of once per
+ * message. Messages in a batch are concatenated; lengths[i] gives the element
+ * count of message i, and outputs use the same layout as inputs.
+ *
+ * Input elements must be canonical (< p). A handle may be used from several
+ * threads at once; it is not modified after creation.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#define RESCUE_C_API __declspec(dllexport)
+#else
+#define RESCUE_C_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Incremented when a function signature or buffer layout changes. */
+#define RESCUE_C_ABI_VERSION 1
+
+/** Bytes per serialized field element. */
+#define RESCUE_C_ELEMENT_SIZE 32
+/** Bytes per CTR nonce. */
+#define RESCUE_C_NONCE_SIZE 16
+/** Bytes per shared secret. */
+#define RESCUE_C_SECRET_SIZE 32
+/** Field elements per hash digest. */
+#define RESCUE_C_DIGEST_ELEMENTS 5
+
+/**
+ * @brief Result of every fallible call.
+ */
+typedef enum rescue_status {
+    RESCUE_OK = 0,
+    RESCUE_ERR_NULL_POINTER = 1,      /**< A required pointer was NULL */
+    RESCUE_ERR_INVALID_ARGUMENT = 2,  /**< Unsupported width or size overflow */
+    RESCUE_ERR_NON_CANONICAL = 3,     /**< An input element was >= p */
+    RESCUE_ERR_OUT_OF_MEMORY = 4,
+    RESCUE_ERR_INTERNAL = 5
+} rescue_status;
+
+/** Keyed Rescue cipher in CTR mode. */
+typedef struct rescue_cipher rescue_cipher;
+
+/** Rescue-Prime hash with the default parameters (rate 7, capacity 5). */
+typedef struct rescue_hasher rescue_hasher;
+
+/** @brief The ABI version the library was built with. */
+RESCUE_C_API uint32_t rescue_abi_version(void);
+
+/** @brief Static, human-readable name of a status code. */
+RESCUE_C_API const char* rescue_status_string(rescue_status status);
+
+/* ========================================================================= */
+/* Cipher                                                                    */
+/* ========================================================================= */
+
+/**
+ * @brief Derive a cipher from a shared secret.
+ * @param width State width: 5 (interoperable default), 8, 12 or 16.
+ * @param secret RESCUE_C_SECRET_SIZE bytes.
+ * @param out Receives the handle; free it with rescue_cipher_free().
+ */
+RESCUE_C_API rescue_status rescue_cipher_new(uint32_t width, const uint8_t* secret, rescue_cipher** out);
+
+/**
+ * @brief Derive `count` ciphers from contiguous secrets.
+ * @param secrets count * RESCUE_C_SECRET_SIZE bytes.
+ * @param out Array of `count` handles. On failure no handle is created and
+ *        every entry is set to NULL.
+ */
+RESCUE_C_API rescue_status rescue_cipher_new_batch(uint32_t width, const uint8_t* secrets, size_t count,
+                                                   rescue_cipher** out);
+
+/** @brief Release a cipher. NULL is ignored. */
+RESCUE_C_API void rescue_cipher_free(rescue_cipher* cipher);
+
+/** @brief State width of a cipher, or 0 for NULL. */
+RESCUE_C_API uint32_t rescue_cipher_width(const rescue_cipher* cipher);
+
+/**
+ * @brief Encrypt one message; identical to BasicRescueCipher::encrypt_raw().
+ * @param nonce RESCUE_C_NONCE_SIZE bytes.
+ * @param in n_elements * 32 bytes of plaintext.
+ * @param out n_elements * 32 bytes; may equal `in`.
+ */
+RESCUE_C_API rescue_status rescue_cipher_encrypt(const rescue_cipher* cipher, const uint8_t* nonce,
+                                                 const uint8_t* in, size_t n_elements, uint8_t* out);
+
+/** @brief Decrypt one message; the inverse of rescue_cipher_encrypt(). */
+RESCUE_C_API rescue_status rescue_cipher_decrypt(const rescue_cipher* cipher, const uint8_t* nonce,
+                                                 const uint8_t* in, size_t n_elements, uint8_t* out);
+
+/**
+ * @brief Encrypt `count` messages under one key.
+ * @param nonces count * RESCUE_C_NONCE_SIZE bytes, one nonce per message.
+ * @param lengths Element count of each message.
+ * @param in Concatenated plaintexts.
+ * @param out Concatenated ciphertexts, same size as `in`; may equal `in`.
+ *
+ * All inputs are validated before any output is written.
+ */
+RESCUE_C_API rescue_status rescue_cipher_encrypt_batch(const rescue_cipher* cipher, size_t count,
+                                                       const uint8_t* nonces, const size_t* lengths,
+                                                       const uint8_t* in, uint8_t* out);
+
+/** @brief Decrypt `count` messages under one key. */
+RESCUE_C_API rescue_status rescue_cipher_decrypt_batch(const rescue_cipher* cipher, size_t count,
+                                                       const uint8_t* nonces, const size_t* lengths,
+                                                       const uint8_t* in, uint8_t* out);
+
+/* ========================================================================= */
+/* Hash                                                                      */
+/* ========================================================================= */
+
+/** @brief Create a hasher; free it with rescue_hasher_free(). */
+RESCUE_C_API rescue_status rescue_hasher_new(rescue_hasher** out);
+
+/** @brief Release a hasher. NULL is ignored. */
+RESCUE_C_API void rescue_hasher_free(rescue_hasher* hasher);
+
+/**
+ * @brief Hash one message.
+ * @param out RESCUE_C_DIGEST_ELEMENTS * 32 bytes.
+ */
+RESCUE_C_API rescue_status rescue_hash(const rescue_hasher* hasher, const uint8_t* in, size_t n_elements,
+                                       uint8_t* out);
+
+/**
+ * @brief Hash `count` concatenated messages, absorbed in lockstep.
+ * @param out count * RESCUE_C_DIGEST_ELEMENTS * 32 bytes, one digest per
+ *        message. Must not overlap `in`.
+ */
+RESCUE_C_API rescue_status rescue_hash_batch(const rescue_hasher* hasher, size_t count, const size_t* lengths,
+                                             const uint8_t* in, uint8_t* out);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif /* RESCUE_C_H */
@@ -10,6 +10,7 @@
  * See: https://tosc.iacr.org/index.php/ToSC/article/view/8695/8287
  */
 
+#include <rescue/executor.hpp>
 #include <rescue/field.hpp>
 #include <rescue/rescue_desc.hpp>
 #include <rescue/rescue_hash.hpp>
@@ -32,45 +33,69 @@ constexpr size_t RESCUE_CIPHER_NONCE_SIZE = 16;
 constexpr size_t RESCUE_CIPHER_SECRET_SIZE = 32;
 
 /**
- * @brief Rescue cipher in Counter (CTR) mode.
+ * @brief Check whether a state width is supported by BasicRescueCipher.
+ *
+ * Supported widths are those with a precomputed MDS matrix: 5, 8, 12 and 16.
+ */
+[[nodiscard]] constexpr bool is_supported_cipher_width(size_t m) noexcept {
+    return m == 5 || m == 8 || m == 12 || m == 16;
+}
+
+/**
+ * @brief Rescue cipher in Counter (CTR) mode with a compile-time state width.
  *
  * This class provides symmetric encryption/decryption using the Rescue
  * permutation. The cipher key is derived from a shared secret using
  * RescuePrimeHash, following NIST SP 800-56C Option 1.
  *
+ * Each permutation call produces M keystream elements from the counter block
+ * [nonce, counter, 0, ..., 0], so wider states need fewer permutations per
+ * encrypted element. RescueCipher (M = 5) is the interoperable default.
+ *
  * Security:
  * - 128-bit security level
- * - Block size: 5 field elements
+ * - Block size: M field elements
  * - Constant-time operations for side-channel resistance
+ *
+ * @tparam M State width in field elements (5, 8, 12 or 16).
  */
-class RescueCipher {
+template <size_t M>
+class BasicRescueCipher {
+    static_assert(is_supported_cipher_width(M), "BasicRescueCipher width must be 5, 8, 12 or 16");
+
 public:
+    /// Block size (number of field elements per block)
+    static constexpr size_t BLOCK_SIZE = M;
+
+    /// A single block of field elements for the raw block-cipher API
+    using Block = std::array<Fp, M>;
+
     /**
-     * @brief Construct a RescueCipher from a shared secret.
+     * @brief Construct a cipher from a shared secret.
      * @param shared_secret 32-byte shared secret (e.g., from key exchange).
      * @throws std::invalid_argument if shared_secret is not 32 bytes.
      */
-    explicit RescueCipher(std::span<const uint8_t, RESCUE_CIPHER_SECRET_SIZE> shared_secret);
+    explicit BasicRescueCipher(std::span<const uint8_t, RESCUE_CIPHER_SECRET_SIZE> shared_secret);
 
     /**
-     * @brief Construct a RescueCipher from a shared secret (vector version).
+     * @brief Construct a cipher from a shared secret (vector version).
      * @param shared_secret 32-byte shared secret.
      * @throws std::invalid_argument if shared_secret is not 32 bytes.
      */
-    explicit RescueCipher(const std::vector<uint8_t>& shared_secret);
+    explicit BasicRescueCipher(const std::vector<uint8_t>& shared_secret);
 
     /**
-     * @brief Construct a RescueCipher from a shared secret (array version).
+     * @brief Construct a cipher from a shared secret (array version).
      * @param shared_secret 32-byte shared secret.
      */
-    explicit RescueCipher(const std::array<uint8_t, RESCUE_CIPHER_SECRET_SIZE>& shared_secret);
+    explicit BasicRescueCipher(const std::array<uint8_t, RESCUE_CIPHER_SECRET_SIZE>& shared_secret);
 
     // Default copy/move operations
-    RescueCipher(const RescueCipher&) = default;
-    RescueCipher(RescueCipher&&) noexcept = default;
-    RescueCipher& operator=(const RescueCipher&) = default;
-    RescueCipher& operator=(RescueCipher&&) noexcept = default;
-    ~RescueCipher() = default;
+    BasicRescueCipher(const BasicRescueCipher&) = default;
+    BasicRescueCipher(BasicRescueCipher&&) noexcept = default;
+    BasicRescueCipher& operator=(const BasicRescueCipher&) = default;
+    BasicRescueCipher& operator=(BasicRescueCipher&&) noexcept = default;
+    ~BasicRescueCipher() = default;
 
     // =========================================================================
     // High-level API (serialized)
@@ -122,6 +147,81 @@ public:
         const std::vector<Fp>& ciphertext,
         std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE> nonce) const;
 
+    /**
+     * @brief Encrypt plaintext field elements, one keystream block per executor task.
+     *
+     * The output is identical to the sequential overload.
+     *
+     * @param plaintext The plaintext as field elements.
+     * @param nonce 16-byte nonce.
+     * @param executor Runs the block permutations.
+     * @return Ciphertext as field elements.
+     */
+    [[nodiscard]] std::vector<Fp> encrypt_raw(
+        const std::vector<Fp>& plaintext,
+        std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE> nonce,
+        Executor& executor) const;
+
+    /**
+     * @brief Decrypt ciphertext field elements, one keystream block per executor task.
+     * @param ciphertext The ciphertext as field elements.
+     * @param nonce 16-byte nonce.
+     * @param executor Runs the block permutations.
+     * @return Decrypted plaintext as field elements.
+     */
+    [[nodiscard]] std::vector<Fp> decrypt_raw(
+        const std::vector<Fp>& ciphertext,
+        std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE> nonce,
+        Executor& executor) const;
+
+    // =========================================================================
+    // Block-cipher API (raw Rescue permutation)
+    // =========================================================================
+
+    /**
+     * @brief Apply the keyed Rescue permutation to a single block.
+     *
+     * Does not allocate; neither do decrypt_block() and the span overloads
+     * of encrypt_blocks() and decrypt_blocks().
+     *
+     * @param block The input block.
+     * @return The encrypted block.
+     */
+    [[nodiscard]] Block encrypt_block(const Block& block) const;
+
+    /**
+     * @brief Apply the inverse keyed Rescue permutation to a single block.
+     * @param block The encrypted block.
+     * @return The decrypted block.
+     */
+    [[nodiscard]] Block decrypt_block(const Block& block) const;
+
+    /**
+     * @brief Encrypt a batch of blocks into a caller-provided output.
+     * @param in The input blocks.
+     * @param out The output blocks (may alias in).
+     * @throws std::invalid_argument if in and out differ in size.
+     */
+    void encrypt_blocks(std::span<const Block> in, std::span<Block> out) const;
+
+    /**
+     * @brief Decrypt a batch of blocks into a caller-provided output.
+     * @param in The encrypted blocks.
+     * @param out The output blocks (may alias in).
+     * @throws std::invalid_argument if in and out differ in size.
+     */
+    void decrypt_blocks(std::span<const Block> in, std::span<Block> out) const;
+
+    /**
+     * @brief Encrypt a batch of blocks.
+     */
+    [[nodiscard]] std::vector<Block> encrypt_blocks(std::span<const Block> in) const;
+
+    /**
+     * @brief Decrypt a batch of blocks.
+     */
+    [[nodiscard]] std::vector<Block> decrypt_blocks(std::span<const Block> in) const;
+
     // =========================================================================
     // Convenience overloads
     // =========================================================================
@@ -158,7 +258,7 @@ private:
     RescueDesc desc_;
 
     /**
-     * @brief Derive cipher key from shared secret.
+     * @brief Derive an M-element cipher key from a shared secret.
      */
     static std::vector<Fp> derive_key(std::span<const uint8_t> shared_secret);
 
@@ -167,6 +267,14 @@ private:
      */
     [[nodiscard]] std::vector<Fp> generate_counter(const uint256& nonce, size_t n_blocks) const;
 
+    /**
+     * @brief Combine data with the CTR keystream on an executor (add, or subtract to decrypt).
+     */
+    [[nodiscard]] std::vector<Fp> apply_keystream(const std::vector<Fp>& data,
+                                                   std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE> nonce,
+                                                   bool subtract,
+                                                   Executor& executor) const;
+
     /**
      * @brief Encrypt/decrypt a single block.
      */
@@ -174,6 +282,14 @@ private:
                                                  const std::vector<Fp>& counter) const;
 };
 
+/// Interoperable Rescue cipher with a 5-element state.
+using RescueCipher = BasicRescueCipher<RESCUE_CIPHER_BLOCK_SIZE>;
+
+extern template class BasicRescueCipher<5>;
+extern template class BasicRescueCipher<8>;
+extern template class BasicRescueCipher<12>;
+extern template class BasicRescueCipher<16>;
+
 /**
  * @brief Generate a random nonce for Rescue cipher.
  * @return 16-byte random nonce.
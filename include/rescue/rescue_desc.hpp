@@ -15,6 +15,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <variant>
 #include <vector>
 
@@ -144,6 +145,14 @@ public:
      */
     [[nodiscard]] const std::vector<Matrix>& round_keys() const { return round_keys_; }
 
+    /**
+     * @brief Get the transformed round keys used by the inverse permutation.
+     *
+     * Entry r holds M^(-1) * round_keys()[r], so that an inverse round
+     * M^(-1) * (s - k) becomes M^(-1) * s - M^(-1) * k.
+     */
+    [[nodiscard]] const std::vector<Matrix>& inverse_round_keys() const { return inverse_round_keys_; }
+
     // Permutation operations
 
     /**
@@ -160,6 +169,63 @@ public:
      */
     [[nodiscard]] Matrix permute_inverse(const Matrix& state) const;
 
+    /**
+     * @brief Apply the Rescue permutation in place, without a state trace.
+     *
+     * Does not allocate for m <= 16.
+     *
+     * @param state The state (m elements), overwritten with the permuted state.
+     * @throws std::invalid_argument if state.size() != m.
+     */
+    void permute_in_place(std::span<Fp> state) const;
+
+    /**
+     * @brief Apply the Rescue permutation to several independent states.
+     *
+     * The states are processed in lockstep, one round at a time across all
+     * lanes, so each round key and MDS row is loaded once per round rather
+     * than once per state and the S-boxes of different lanes overlap.
+     * Results equal permute_in_place() on each state. Does not allocate for
+     * m <= 16.
+     *
+     * @param states Concatenated states, a multiple of m elements.
+     * @throws std::invalid_argument if states.size() is not a multiple of m.
+     */
+    void permute_many(std::span<Fp> states) const;
+
+    /**
+     * @brief Apply the inverse Rescue permutation in place, without a state trace.
+     *
+     * Each round costs one mat-vec with the inverse MDS matrix and one S-box,
+     * using the precomputed inverse_round_keys(). Does not allocate for m <= 16.
+     *
+     * @param state The state (m elements), overwritten with the inverse-permuted state.
+     * @throws std::invalid_argument if state.size() != m.
+     */
+    void permute_inverse_in_place(std::span<Fp> state) const;
+
+    /**
+     * @brief Number of trace rows written by permute_traced().
+     *
+     * Two rows per round key: the input and the keyed input, then for each
+     * round the S-box output and the state after the MDS and round key.
+     */
+    [[nodiscard]] size_t trace_rows() const { return 2 * round_keys_.size(); }
+
+    /**
+     * @brief Apply the Rescue permutation in place and record every row.
+     *
+     * Row 0 is the input, row 1 the input plus the first round key, then
+     * rows 2r + 2 and 2r + 3 hold the S-box output and the next state of
+     * round r. The last row equals the permuted state. Does not allocate
+     * for m <= 16.
+     *
+     * @param state The state (m elements), overwritten with the permuted state.
+     * @param trace trace_rows() * m elements, row-major.
+     * @throws std::invalid_argument on a size mismatch.
+     */
+    void permute_traced(std::span<Fp> state, std::span<Fp> trace) const;
+
 private:
     RescueMode mode_;
     size_t m_;
@@ -171,6 +237,7 @@ private:
     Matrix mds_mat_;
     Matrix mds_mat_inverse_;
     std::vector<Matrix> round_keys_;
+    std::vector<Matrix> inverse_round_keys_;
 
     /**
      * @brief Initialize common parameters.
@@ -216,6 +283,14 @@ private:
  */
 [[nodiscard]] size_t get_n_rounds(const RescueMode& mode, const uint256& alpha, size_t m);
 
+/**
+ * @brief Calculate the number of rounds for an arbitrary field and security level.
+ * @param field_bits Bit length of the field modulus.
+ * @param security_level Target security in bits.
+ */
+[[nodiscard]] size_t get_n_rounds(const RescueMode& mode, const uint256& alpha, size_t m, size_t field_bits,
+                                  size_t security_level);
+
 /**
  * @brief Build a Cauchy MDS matrix.
  * @param size The matrix dimension.
@@ -11,10 +11,12 @@
  * second-preimage attacks for any field of size at least 102 bits.
  */
 
+#include <rescue/executor.hpp>
 #include <rescue/field.hpp>
 #include <rescue/rescue_desc.hpp>
 
 #include <cstddef>
+#include <span>
 #include <vector>
 
 namespace rescue {
@@ -84,6 +86,26 @@ public:
      */
     [[nodiscard]] std::vector<Fp> digest(const std::vector<uint256>& message) const;
 
+    /**
+     * @brief Hash several messages, one executor task per message.
+     * @param messages The input messages as field elements.
+     * @param executor Runs the digests.
+     * @return The digest of each message, in input order.
+     */
+    [[nodiscard]] std::vector<std::vector<Fp>> digest_many(std::span<const std::vector<Fp>> messages,
+                                                           Executor& executor) const;
+
+    /**
+     * @brief Hash several messages in lockstep on the calling thread.
+     *
+     * Each absorption step runs every message still absorbing through one
+     * RescueDesc::permute_many() call. Results equal digest() on each message.
+     *
+     * @param messages The input messages as field elements.
+     * @return The digest of each message, in input order.
+     */
+    [[nodiscard]] std::vector<std::vector<Fp>> digest_batch(std::span<const std::vector<Fp>> messages) const;
+
     /**
      * @brief Get the rate parameter.
      */
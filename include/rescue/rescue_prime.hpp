@@ -0,0 +1,152 @@
+#pragma once
+
+/**
+ * @file rescue_prime.hpp
+ * @brief Rescue-Prime hash over an arbitrary prime field.
+ *
+ * RescueDesc and RescuePrimeHash are fixed to Fp (2^255 - 19), which the
+ * interoperable cipher and hash require. BasicRescuePrime derives the same
+ * hash-mode parameters for any field type F: alpha is the smallest prime not
+ * dividing p - 1, the round count follows get_n_rounds() at the requested
+ * security level, the MDS matrix is the Cauchy matrix 1/(i + j), and round
+ * constants are sampled with SHAKE256 from the "Rescue-XLIX(p,m,c,s)" seed.
+ *
+ * A field type F must provide P (uint256), BITS, construction from
+ * uint64_t and uint256, +, - and *, pow(uint64_t), pow(uint256) and inv().
+ * Fp and Goldilocks are instantiated in the library.
+ */
+
+#include <rescue/field.hpp>
+#include <rescue/goldilocks.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace rescue {
+
+/**
+ * @brief Default sponge parameters for Rescue-Prime over a field.
+ */
+template <typename F>
+struct RescuePrimeParameters;
+
+/// 2^255 - 19: the RescuePrimeHash defaults
+template <>
+struct RescuePrimeParameters<Fp> {
+    static constexpr size_t RATE = 7;
+    static constexpr size_t CAPACITY = 5;
+    static constexpr size_t DIGEST_LENGTH = 5;
+    static constexpr size_t SECURITY_LEVEL = 256;
+};
+
+/// Goldilocks: a 12-element state with 4 capacity elements (256 bits) for
+/// 128-bit security, digest of 4 elements
+template <>
+struct RescuePrimeParameters<Goldilocks> {
+    static constexpr size_t RATE = 8;
+    static constexpr size_t CAPACITY = 4;
+    static constexpr size_t DIGEST_LENGTH = 4;
+    static constexpr size_t SECURITY_LEVEL = 128;
+};
+
+/**
+ * @brief Rescue-Prime permutation (hash mode) over the field F.
+ *
+ * @tparam F Field element type.
+ */
+template <typename F>
+class BasicRescuePrime {
+public:
+    /**
+     * @brief Derive the permutation for a state of m elements.
+     * @param m State size.
+     * @param capacity Capacity (must be less than m).
+     * @param security_level Target security in bits.
+     * @throws std::invalid_argument if capacity >= m or capacity == 0.
+     */
+    BasicRescuePrime(size_t m, size_t capacity, size_t security_level);
+
+    [[nodiscard]] size_t m() const { return m_; }
+    [[nodiscard]] size_t capacity() const { return capacity_; }
+    [[nodiscard]] size_t security_level() const { return security_level_; }
+    [[nodiscard]] size_t n_rounds() const { return n_rounds_; }
+    [[nodiscard]] uint64_t alpha() const { return alpha_; }
+    [[nodiscard]] const uint256& alpha_inverse() const { return alpha_inverse_; }
+
+    /// MDS matrix, row-major m x m
+    [[nodiscard]] std::span<const F> mds_matrix() const { return mds_; }
+
+    /// Round constants, (2 * n_rounds + 1) vectors of m elements; the first is zero
+    [[nodiscard]] std::span<const F> round_constants() const { return round_constants_; }
+
+    /**
+     * @brief Apply the permutation to a state of m elements.
+     * @throws std::invalid_argument if state.size() != m.
+     */
+    void permute_in_place(std::span<F> state) const;
+
+private:
+    size_t m_;
+    size_t capacity_;
+    size_t security_level_;
+    size_t n_rounds_ = 0;
+    uint64_t alpha_ = 0;
+    uint256 alpha_inverse_;
+    std::vector<F> mds_;
+    std::vector<F> round_constants_;
+
+    void sample_round_constants();
+};
+
+/**
+ * @brief Rescue-Prime sponge hash over the field F.
+ *
+ * Padding and absorption match RescuePrimeHash: append 1, pad with zeros to a
+ * multiple of the rate, add each block to the rate part of the state and
+ * permute; the digest is the first digest_length state elements.
+ *
+ * @tparam F Field element type.
+ */
+template <typename F>
+class BasicRescuePrimeHash {
+public:
+    /**
+     * @brief Construct with RescuePrimeParameters<F>.
+     */
+    BasicRescuePrimeHash();
+
+    /**
+     * @brief Construct with custom sponge parameters.
+     * @throws std::invalid_argument on a zero rate, capacity or digest length,
+     *         or a digest longer than the state.
+     */
+    BasicRescuePrimeHash(size_t rate, size_t capacity, size_t digest_length, size_t security_level);
+
+    /**
+     * @brief Compute the hash of a message.
+     */
+    [[nodiscard]] std::vector<F> digest(std::span<const F> message) const;
+
+    [[nodiscard]] size_t rate() const { return rate_; }
+    [[nodiscard]] size_t capacity() const { return permutation_.capacity(); }
+    [[nodiscard]] size_t digest_length() const { return digest_length_; }
+    [[nodiscard]] size_t state_size() const { return permutation_.m(); }
+    [[nodiscard]] const BasicRescuePrime<F>& permutation() const { return permutation_; }
+
+private:
+    size_t rate_;
+    size_t digest_length_;
+    BasicRescuePrime<F> permutation_;
+};
+
+/// Rescue-Prime over the Goldilocks field
+using GoldilocksRescuePrimeHash = BasicRescuePrimeHash<Goldilocks>;
+
+extern template class BasicRescuePrime<Fp>;
+extern template class BasicRescuePrime<Goldilocks>;
+extern template class BasicRescuePrimeHash<Fp>;
+extern template class BasicRescuePrimeHash<Goldilocks>;
+
+}  // namespace rescue
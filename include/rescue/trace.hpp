@@ -0,0 +1,67 @@
+#pragma once
+
+/**
+ * @file trace.hpp
+ * @brief Columnar permutation traces for proof witnesses.
+ *
+ * A trace holds every row that RescueDesc::permute_traced() records for a
+ * batch of permutations, stored column-major: column c is one contiguous run
+ * of cells holding state element c of every row of every permutation.
+ * Permutation p occupies rows [p * rows_per_permutation, (p + 1) *
+ * rows_per_permutation) of each column. Cells are 32-byte little-endian
+ * canonical field elements, so a buffer can be handed to a prover as is or
+ * mapped straight from a file.
+ */
+
+#include <rescue/executor.hpp>
+#include <rescue/field.hpp>
+#include <rescue/rescue_desc.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace rescue {
+
+/**
+ * @brief Shape of a columnar trace buffer.
+ */
+struct TraceLayout {
+    size_t columns = 0;               ///< State width m
+    size_t rows_per_permutation = 0;  ///< RescueDesc::trace_rows()
+    size_t n_permutations = 0;
+
+    /// Bytes per cell.
+    static constexpr size_t CELL_SIZE = Fp::BYTES;
+
+    /**
+     * @brief Layout for n_permutations of the given description.
+     */
+    [[nodiscard]] static TraceLayout for_desc(const RescueDesc& desc, size_t n_permutations);
+
+    /// Rows in each column.
+    [[nodiscard]] size_t rows() const { return n_permutations * rows_per_permutation; }
+
+    /// Total buffer size in bytes.
+    [[nodiscard]] size_t bytes() const { return columns * rows() * CELL_SIZE; }
+
+    /// Byte offset of a cell.
+    [[nodiscard]] size_t offset(size_t column, size_t row) const { return (column * rows() + row) * CELL_SIZE; }
+};
+
+/**
+ * @brief Run permutations and write their traces into a columnar buffer.
+ *
+ * `inputs` holds k consecutive input states of m elements each; they fill
+ * permutations [first_permutation, first_permutation + k) of `layout`, so a
+ * large trace can be produced in chunks. Permutations are split into
+ * chunks that run on `executor`. Does not allocate per permutation.
+ *
+ * @param out Buffer of layout.bytes() bytes, e.g. a shared file mapping.
+ * @throws std::invalid_argument if the layout does not match desc, inputs is
+ *         not a whole number of states, or the range exceeds the layout.
+ */
+void generate_trace(const RescueDesc& desc, std::span<const Fp> inputs, const TraceLayout& layout,
+                    size_t first_permutation, std::span<uint8_t> out, Executor& executor = default_executor());
+
+}  // namespace rescue
@@ -1,28 +1,57 @@
 /**
  * 100k Benchmark and Interop Test for Rescue Cipher (C++)
- * 
+ *
  * Reads test vectors from JavaScript, verifies interoperability,
  * and benchmarks C++ encryption/decryption performance.
+ *
+ * Input is either the NDJSON file written by js/benchmark_100k.js or a binary
+ * .rvec file (see vector_file.hpp and convert_vectors), detected by its magic.
+ *
+ * Usage: ./benchmark_100k [input] [--threads=N] [--scaling]
+ *
+ *   --threads=N  Verify on N worker threads (0 = all cores, default 1).
+ *                Vectors are handed out in batches and results are merged
+ *                in input order, so counts and failure reports do not
+ *                depend on the thread count.
+ *   --scaling    Before the main pass, time a sample on 1 and on N threads
+ *                and report speedup and scaling efficiency.
  */
 
+#include "vector_file.hpp"
+
 #include <rescue/rescue.hpp>
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <cstring>
 #include <ctime>
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
+#include <string_view>
+#include <thread>
 #include <vector>
 
 using json = nlohmann::json;
 using namespace rescue;
 
+using Clock = std::chrono::high_resolution_clock;
+using Duration = std::chrono::nanoseconds;
+
 // Configuration
-const size_t BATCH_SIZE = 1000;   // Smaller batches for more frequent progress
-const size_t LOG_INTERVAL = 100;  // Log every N tests within a batch
+const size_t BATCH_SIZE = 1000;               // Unit of work handed to a thread
+const auto PROGRESS_INTERVAL = std::chrono::milliseconds(250);
+const size_t MAX_LOGGED_FAILURES = 5;         // Failures printed to the console
+const size_t MAX_REPORTED_FAILURES = 100;     // Failures written to the results file
+const size_t SCALING_VECTORS_PER_THREAD = 64; // Sample size for --scaling
+const size_t SCALING_BATCH_SIZE = 16;
 
 /**
  * Get current timestamp string
@@ -32,7 +61,7 @@ std::string timestamp() {
     auto time_t = std::chrono::system_clock::to_time_t(now);
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(
         now.time_since_epoch()) % 1000;
-    
+
     std::stringstream ss;
     ss << std::put_time(std::localtime(&time_t), "%H:%M:%S");
     ss << '.' << std::setfill('0') << std::setw(3) << ms.count();
@@ -117,16 +146,364 @@ std::string format_bytes(size_t bytes) {
     return ss.str();
 }
 
+/**
+ * Format a double with fixed precision
+ */
+std::string format_fixed(double value, int precision) {
+    std::stringstream ss;
+    ss << std::fixed << std::setprecision(precision) << value;
+    return ss.str();
+}
+
+/**
+ * One decoded test vector
+ */
+struct TestInput {
+    int id = 0;
+    std::vector<uint8_t> shared_secret;
+    std::vector<uint8_t> nonce;
+    std::vector<Fp> plaintext;
+    std::vector<Fp> expected_ciphertext;
+};
+
+// ============================================================================
+// Input
+// ============================================================================
+
+/**
+ * Memory-mapped NDJSON file with an index of line boundaries, so any vector
+ * can be parsed by any thread without sharing a stream.
+ */
+class NdjsonFile {
+public:
+    explicit NdjsonFile(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("Could not open " + path);
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) != 0 || st.st_size == 0) {
+            ::close(fd);
+            throw std::runtime_error(path + " is empty");
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        void* base = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            throw std::runtime_error("Could not mmap " + path);
+        }
+        data_ = static_cast<const char*>(base);
+
+        // First line is metadata, every other non-empty line is a vector
+        size_t pos = 0;
+        while (pos < size_) {
+            const void* nl = std::memchr(data_ + pos, '\n', size_ - pos);
+            size_t end = nl != nullptr ? static_cast<size_t>(static_cast<const char*>(nl) - data_) : size_;
+            if (end > pos) {
+                lines_.emplace_back(data_ + pos, end - pos);
+            }
+            pos = end + 1;
+        }
+        if (lines_.empty()) {
+            ::munmap(const_cast<char*>(data_), size_);
+            throw std::runtime_error(path + " has no metadata line");
+        }
+    }
+
+    ~NdjsonFile() { ::munmap(const_cast<char*>(data_), size_); }
+
+    NdjsonFile(const NdjsonFile&) = delete;
+    NdjsonFile& operator=(const NdjsonFile&) = delete;
+
+    [[nodiscard]] size_t file_size() const { return size_; }
+    [[nodiscard]] size_t size() const { return lines_.size() - 1; }
+    [[nodiscard]] std::string_view metadata() const { return lines_[0]; }
+    [[nodiscard]] std::string_view operator[](size_t i) const { return lines_[i + 1]; }
+
+private:
+    const char* data_ = nullptr;
+    size_t size_ = 0;
+    std::vector<std::string_view> lines_;
+};
+
+/**
+ * Random-access view over whichever input format was given
+ */
+struct VectorSource {
+    std::unique_ptr<rvec::VectorFile> binary;
+    std::unique_ptr<NdjsonFile> ndjson;
+
+    [[nodiscard]] size_t size() const { return binary ? binary->size() : ndjson->size(); }
+
+    /**
+     * Decode vector i into in. Safe to call concurrently.
+     * @throws std::exception if the vector is malformed.
+     */
+    void load(size_t i, TestInput& in) const {
+        if (binary) {
+            rvec::VectorView v = (*binary)[i];
+            in.id = static_cast<int>(v.id);
+            in.shared_secret.assign(v.shared_secret.begin(), v.shared_secret.end());
+            in.nonce.assign(v.nonce.begin(), v.nonce.end());
+            in.plaintext.assign(v.plaintext.begin(), v.plaintext.end());
+            in.expected_ciphertext.assign(v.ciphertext.begin(), v.ciphertext.end());
+            return;
+        }
+
+        std::string_view line = (*ndjson)[i];
+        json test_vec = json::parse(line.begin(), line.end());
+
+        in.id = test_vec["id"];
+
+        // Parse inputs
+        in.shared_secret = hex_to_bytes(test_vec["shared_secret"]);
+        in.nonce = hex_to_bytes(test_vec["nonce"]);
+
+        // Parse plaintext
+        in.plaintext.clear();
+        in.plaintext.reserve(test_vec["plaintext"].size());
+        for (const auto& pt_hex : test_vec["plaintext"]) {
+            in.plaintext.push_back(hex_to_fp(pt_hex.get<std::string>()));
+        }
+
+        // Parse expected ciphertext from JS
+        in.expected_ciphertext.clear();
+        in.expected_ciphertext.reserve(test_vec["ciphertext"].size());
+        for (const auto& ct_hex : test_vec["ciphertext"]) {
+            in.expected_ciphertext.push_back(hex_to_fp(ct_hex.get<std::string>()));
+        }
+    }
+};
+
+// ============================================================================
+// Verification
+// ============================================================================
+
+/**
+ * A vector that did not round-trip
+ */
+struct Failure {
+    size_t index = 0;   // Position in the input file
+    int id = -1;
+    bool encrypt_ok = false;
+    bool decrypt_ok = false;
+    std::string error;  // Set when the vector could not be processed at all
+};
+
+/**
+ * Counts and timings for one batch; also used for the merged totals.
+ * Phase timings are summed thread time, wall_time is elapsed time.
+ */
+struct BatchResult {
+    size_t tests = 0;
+    size_t elements = 0;
+    size_t passed = 0;
+    size_t failed = 0;
+    size_t encrypt_mismatches = 0;
+    size_t decrypt_mismatches = 0;
+
+    Duration parse_time{0};
+    Duration cipher_init_time{0};
+    Duration encrypt_time{0};
+    Duration decrypt_time{0};
+    Duration verify_time{0};
+    Duration wall_time{0};
+
+    std::vector<Failure> failures;
+
+    [[nodiscard]] Duration busy_time() const {
+        return parse_time + cipher_init_time + encrypt_time + decrypt_time + verify_time;
+    }
+
+    /**
+     * Add another batch's totals. Callers merge in input order, so failures
+     * stay sorted by index.
+     */
+    void merge(const BatchResult& o) {
+        tests += o.tests;
+        elements += o.elements;
+        passed += o.passed;
+        failed += o.failed;
+        encrypt_mismatches += o.encrypt_mismatches;
+        decrypt_mismatches += o.decrypt_mismatches;
+        parse_time += o.parse_time;
+        cipher_init_time += o.cipher_init_time;
+        encrypt_time += o.encrypt_time;
+        decrypt_time += o.decrypt_time;
+        verify_time += o.verify_time;
+        wall_time += o.wall_time;
+        failures.insert(failures.end(), o.failures.begin(), o.failures.end());
+    }
+};
+
+/**
+ * Verify vectors [begin, end) on the calling thread
+ */
+BatchResult process_batch(const VectorSource& source, size_t begin, size_t end,
+                          std::atomic<size_t>& completed) {
+    BatchResult r;
+    auto batch_start = Clock::now();
+    TestInput input;
+
+    for (size_t index = begin; index < end; ++index) {
+        try {
+            // Parse JSON or copy out of the mapped file
+            auto parse_start = Clock::now();
+            source.load(index, input);
+            const auto& plaintext = input.plaintext;
+            const auto& expected_ciphertext = input.expected_ciphertext;
+            auto parse_end = Clock::now();
+            r.parse_time += std::chrono::duration_cast<Duration>(parse_end - parse_start);
+
+            r.elements += plaintext.size();
+
+            // Create cipher
+            auto cipher_init_start = Clock::now();
+            RescueCipher cipher(input.shared_secret);
+            auto cipher_init_end = Clock::now();
+            r.cipher_init_time += std::chrono::duration_cast<Duration>(cipher_init_end - cipher_init_start);
+
+            if (input.nonce.size() != RESCUE_CIPHER_NONCE_SIZE) {
+                throw std::invalid_argument("nonce must be 16 bytes");
+            }
+            std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE> nonce(input.nonce.data(),
+                                                                     RESCUE_CIPHER_NONCE_SIZE);
+
+            // Benchmark encryption
+            auto enc_start = Clock::now();
+            std::vector<Fp> cpp_ciphertext = cipher.encrypt_raw(plaintext, nonce);
+            auto enc_end = Clock::now();
+            r.encrypt_time += std::chrono::duration_cast<Duration>(enc_end - enc_start);
+
+            // Benchmark decryption
+            auto dec_start = Clock::now();
+            std::vector<Fp> cpp_decrypted = cipher.decrypt_raw(expected_ciphertext, nonce);
+            auto dec_end = Clock::now();
+            r.decrypt_time += std::chrono::duration_cast<Duration>(dec_end - dec_start);
+
+            // Verify encryption matches JS, and decryption the original plaintext
+            auto verify_start = Clock::now();
+            bool enc_match = cpp_ciphertext == expected_ciphertext;
+            bool dec_match = cpp_decrypted == plaintext;
+            auto verify_end = Clock::now();
+            r.verify_time += std::chrono::duration_cast<Duration>(verify_end - verify_start);
+
+            if (enc_match && dec_match) {
+                r.passed++;
+            } else {
+                r.failed++;
+                if (!enc_match) r.encrypt_mismatches++;
+                if (!dec_match) r.decrypt_mismatches++;
+                r.failures.push_back(Failure{index, input.id, enc_match, dec_match, {}});
+            }
+        } catch (const std::exception& e) {
+            r.failed++;
+            r.failures.push_back(Failure{index, -1, false, false, e.what()});
+        }
+
+        r.tests++;
+        completed.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    r.wall_time = std::chrono::duration_cast<Duration>(Clock::now() - batch_start);
+    return r;
+}
+
+/// Outcome of one verification pass
+struct PassResult {
+    Duration wall{0};
+
+    /// Workers actually started: the request clamped to the batch count
+    size_t threads = 1;
+};
+
+/**
+ * Verify vectors [0, count) using up to `threads` workers.
+ *
+ * Workers claim batches of batch_size vectors from a shared counter. The
+ * calling thread hands each finished batch to on_batch strictly in input
+ * order and calls on_progress with the number of completed vectors while it
+ * waits, so reporting and aggregation are independent of scheduling.
+ *
+ * @return Wall-clock time of the pass and the number of workers it used.
+ */
+template <typename OnBatch, typename OnProgress>
+PassResult run_pass(const VectorSource& source, size_t count, size_t threads, size_t batch_size,
+                  OnBatch on_batch, OnProgress on_progress) {
+    size_t num_batches = (count + batch_size - 1) / batch_size;
+    threads = std::max<size_t>(1, std::min(threads, num_batches));
+
+    std::vector<BatchResult> results(num_batches);
+    std::vector<char> done(num_batches, 0);
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::atomic<size_t> next_batch{0};
+    std::atomic<size_t> completed{0};
+
+    auto pass_start = Clock::now();
+
+    std::vector<std::thread> workers;
+    workers.reserve(threads);
+    for (size_t t = 0; t < threads; ++t) {
+        workers.emplace_back([&] {
+            for (size_t b; (b = next_batch.fetch_add(1, std::memory_order_relaxed)) < num_batches;) {
+                size_t begin = b * batch_size;
+                BatchResult r = process_batch(source, begin, std::min(begin + batch_size, count), completed);
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    results[b] = std::move(r);
+                    done[b] = 1;
+                }
+                cv.notify_all();
+            }
+        });
+    }
+
+    for (size_t b = 0; b < num_batches; ++b) {
+        BatchResult r;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (!cv.wait_for(lock, PROGRESS_INTERVAL, [&] { return done[b] != 0; })) {
+                on_progress(completed.load(std::memory_order_relaxed));
+            }
+            r = std::move(results[b]);
+        }
+        on_batch(b, num_batches, r);
+    }
+
+    for (auto& w : workers) {
+        w.join();
+    }
+    return PassResult{std::chrono::duration_cast<Duration>(Clock::now() - pass_start), threads};
+}
+
 int main(int argc, char* argv[]) {
-    using Clock = std::chrono::high_resolution_clock;
-    using Duration = std::chrono::nanoseconds;
-    
     auto program_start = Clock::now();
-    
+
     std::string input_file = "test_vectors_100k.ndjson";
-    
-    if (argc > 1) {
-        input_file = argv[1];
+    size_t num_threads = 1;
+    bool measure_scaling = false;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        if (arg.rfind("--threads=", 0) == 0) {
+            try {
+                num_threads = std::stoul(arg.substr(10));
+            } catch (const std::exception&) {
+                std::cerr << "ERROR: --threads expects a number\n";
+                return 1;
+            }
+            if (num_threads == 0) {
+                num_threads = std::max(1u, std::thread::hardware_concurrency());
+            }
+        } else if (arg == "--scaling") {
+            measure_scaling = true;
+        } else if (arg.rfind("--", 0) == 0) {
+            std::cerr << "Usage: " << argv[0] << " [input] [--threads=N] [--scaling]\n";
+            return 1;
+        } else {
+            input_file = arg;
+        }
     }
 
     std::cout << "\n";
@@ -137,275 +514,204 @@ int main(int argc, char* argv[]) {
     log("Configuration:");
     log("  - Input file: " + input_file);
     log("  - Batch size: " + format_number(BATCH_SIZE));
-    log("  - Log interval: " + format_number(LOG_INTERVAL));
+    log("  - Threads: " + std::to_string(num_threads));
     std::cout << std::string(80, '-') << "\n";
 
     // Open file
     log("Opening input file...");
-    std::ifstream ifs(input_file);
-    if (!ifs.is_open()) {
-        log("ERROR: Could not open " + input_file);
+    VectorSource source;
+    try {
+        if (rvec::is_vector_file(input_file)) {
+            source.binary = std::make_unique<rvec::VectorFile>(input_file);
+            log("  Format: rvec (memory-mapped)");
+            log("  File size: " + format_bytes(source.binary->file_size()));
+        } else {
+            source.ndjson = std::make_unique<NdjsonFile>(input_file);
+            log("  Format: NDJSON (memory-mapped)");
+            log("  File size: " + format_bytes(source.ndjson->file_size()));
+
+            // Read metadata (first line)
+            log("Reading metadata...");
+            std::string_view line = source.ndjson->metadata();
+            json metadata = json::parse(line.begin(), line.end());
+
+            size_t declared = metadata["num_tests"];
+            if (declared != source.ndjson->size()) {
+                log("  WARNING: metadata declares " + format_number(declared) + " tests, file has " +
+                    format_number(source.ndjson->size()));
+            }
+
+            // Print JS benchmark results if available
+            if (metadata.contains("benchmark_results")) {
+                auto& js_bench = metadata["benchmark_results"];
+                log("  JS Platform: " + js_bench["platform"].get<std::string>());
+                log("  JS Node version: " + js_bench["node_version"].get<std::string>());
+            }
+        }
+    } catch (const std::exception& e) {
+        log(std::string("ERROR: ") + e.what());
         return 1;
     }
-    
-    // Get file size
-    ifs.seekg(0, std::ios::end);
-    size_t file_size = ifs.tellg();
-    ifs.seekg(0, std::ios::beg);
-    log("  File size: " + format_bytes(file_size));
-
-    // Read metadata (first line)
-    log("Reading metadata...");
-    std::string line;
-    std::getline(ifs, line);
-    json metadata = json::parse(line);
-
-    size_t num_tests = metadata["num_tests"];
+    size_t num_tests = source.size();
     log("  Number of tests: " + format_number(num_tests));
     log("  Field: p = 2^255 - 19");
-    
-    // Print JS benchmark results if available
-    if (metadata.contains("benchmark_results")) {
-        auto& js_bench = metadata["benchmark_results"];
-        log("  JS Platform: " + js_bench["platform"].get<std::string>());
-        log("  JS Node version: " + js_bench["node_version"].get<std::string>());
-    }
     std::cout << "\n";
 
-    // Benchmark variables
-    size_t total_elements = 0;
-    size_t passed = 0;
-    size_t failed = 0;
-    size_t encrypt_mismatches = 0;
-    size_t decrypt_mismatches = 0;
+    if (num_tests == 0) {
+        log("ERROR: No test vectors in " + input_file);
+        return 1;
+    }
 
-    Duration total_encrypt_time{0};
-    Duration total_decrypt_time{0};
-    Duration total_parse_time{0};
-    Duration total_cipher_init_time{0};
-    Duration total_verify_time{0};
-
-    size_t num_batches = (num_tests + BATCH_SIZE - 1) / BATCH_SIZE;
-    size_t batch_num = 0;
-    size_t test_count = 0;
-    size_t batch_elements = 0;
-    
-    Duration batch_encrypt_time{0};
-    Duration batch_decrypt_time{0};
-    Duration batch_parse_time{0};
-    Duration batch_cipher_init_time{0};
-    Duration batch_verify_time{0};
-    
-    auto batch_start = Clock::now();
+    // Optional scaling calibration on a sample: same vectors, 1 vs N threads
+    bool have_scaling = false;
+    size_t scaling_sample = 0;
+    double scaling_speedup = 0.0;
+    double scaling_efficiency = 0.0;
+    Duration scaling_single_wall{0};
+    Duration scaling_multi_wall{0};
+    size_t scaling_threads = 1;
+    if (measure_scaling && num_threads > 1) {
+        scaling_sample = std::min(num_tests, SCALING_VECTORS_PER_THREAD * num_threads);
+        log("Measuring scaling on " + format_number(scaling_sample) + " vectors...");
+        auto ignore_batch = [](size_t, size_t, const BatchResult&) {};
+        auto ignore_progress = [](size_t) {};
+        scaling_single_wall = run_pass(source, scaling_sample, 1, SCALING_BATCH_SIZE,
+                                       ignore_batch, ignore_progress).wall;
+        PassResult multi = run_pass(source, scaling_sample, num_threads, SCALING_BATCH_SIZE,
+                                    ignore_batch, ignore_progress);
+        scaling_multi_wall = multi.wall;
+        scaling_threads = multi.threads;
+        scaling_speedup = static_cast<double>(scaling_single_wall.count()) /
+                          static_cast<double>(scaling_multi_wall.count());
+        scaling_efficiency = scaling_speedup / static_cast<double>(scaling_threads);
+        have_scaling = true;
+        log("  1 thread:  " + format_fixed(scaling_single_wall.count() / 1e6, 1) + "ms");
+        log("  " + std::to_string(scaling_threads) + " threads: " +
+            format_fixed(scaling_multi_wall.count() / 1e6, 1) + "ms");
+        log("  Speedup: " + format_fixed(scaling_speedup, 2) + "x, efficiency: " +
+            format_fixed(100.0 * scaling_efficiency, 1) + "%");
+        std::cout << "\n";
+    } else if (measure_scaling) {
+        log("Skipping scaling measurement: needs --threads > 1");
+        std::cout << "\n";
+    }
 
     log(std::string(79, '='));
     log("PHASE 1: Loading Test Vectors & Benchmarking");
     log(std::string(79, '='));
     std::cout << "\n";
-    
-    log("Batch " + std::to_string(batch_num + 1) + "/" + std::to_string(num_batches) + 
-        " starting (tests 0-" + std::to_string(std::min(BATCH_SIZE, num_tests) - 1) + ")");
-
-    // Process test vectors
-    while (std::getline(ifs, line)) {
-        // Parse JSON
-        auto parse_start = Clock::now();
-        json test_vec = json::parse(line);
-        
-        int test_id = test_vec["id"];
-        
-        // Parse inputs
-        std::vector<uint8_t> shared_secret = hex_to_bytes(test_vec["shared_secret"]);
-        std::vector<uint8_t> nonce = hex_to_bytes(test_vec["nonce"]);
-        
-        // Parse plaintext
-        std::vector<Fp> plaintext;
-        plaintext.reserve(test_vec["plaintext"].size());
-        for (const auto& pt_hex : test_vec["plaintext"]) {
-            plaintext.push_back(hex_to_fp(pt_hex.get<std::string>()));
-        }
-        
-        // Parse expected ciphertext from JS
-        std::vector<Fp> expected_ciphertext;
-        expected_ciphertext.reserve(test_vec["ciphertext"].size());
-        for (const auto& ct_hex : test_vec["ciphertext"]) {
-            expected_ciphertext.push_back(hex_to_fp(ct_hex.get<std::string>()));
-        }
-        auto parse_end = Clock::now();
-        batch_parse_time += std::chrono::duration_cast<Duration>(parse_end - parse_start);
-
-        total_elements += plaintext.size();
-        batch_elements += plaintext.size();
-
-        // Create cipher
-        auto cipher_init_start = Clock::now();
-        RescueCipher cipher(shared_secret);
-        auto cipher_init_end = Clock::now();
-        batch_cipher_init_time += std::chrono::duration_cast<Duration>(cipher_init_end - cipher_init_start);
-
-        // Benchmark encryption
-        auto enc_start = Clock::now();
-        std::vector<Fp> cpp_ciphertext = cipher.encrypt_raw(plaintext, nonce);
-        auto enc_end = Clock::now();
-        batch_encrypt_time += std::chrono::duration_cast<Duration>(enc_end - enc_start);
-
-        // Benchmark decryption
-        auto dec_start = Clock::now();
-        std::vector<Fp> cpp_decrypted = cipher.decrypt_raw(expected_ciphertext, nonce);
-        auto dec_end = Clock::now();
-        batch_decrypt_time += std::chrono::duration_cast<Duration>(dec_end - dec_start);
-
-        // Verify encryption matches JS
-        auto verify_start = Clock::now();
-        bool enc_match = (cpp_ciphertext.size() == expected_ciphertext.size());
-        if (enc_match) {
-            for (size_t i = 0; i < cpp_ciphertext.size(); i++) {
-                if (cpp_ciphertext[i] != expected_ciphertext[i]) {
-                    enc_match = false;
-                    break;
-                }
-            }
-        }
-
-        // Verify decryption matches original plaintext
-        bool dec_match = (cpp_decrypted.size() == plaintext.size());
-        if (dec_match) {
-            for (size_t i = 0; i < cpp_decrypted.size(); i++) {
-                if (cpp_decrypted[i] != plaintext[i]) {
-                    dec_match = false;
-                    break;
-                }
-            }
-        }
-        auto verify_end = Clock::now();
-        batch_verify_time += std::chrono::duration_cast<Duration>(verify_end - verify_start);
 
-        if (enc_match && dec_match) {
-            passed++;
-        } else {
-            failed++;
-            if (!enc_match) encrypt_mismatches++;
-            if (!dec_match) decrypt_mismatches++;
-            
-            // Print first few failures
-            if (failed <= 5) {
-                log("  ERROR: FAILED test " + std::to_string(test_id) + ": " +
-                    "encrypt=" + (enc_match ? "OK" : "MISMATCH") +
-                    ", decrypt=" + (dec_match ? "OK" : "MISMATCH"));
+    BatchResult total;
+    size_t logged_failures = 0;
+    auto on_progress = [&](size_t completed) {
+        double pct_total = (static_cast<double>(completed) / num_tests) * 100.0;
+        std::cout << "\r  [" << timestamp() << "]   Progress: "
+                  << format_number(completed) << "/" << format_number(num_tests)
+                  << " (" << std::fixed << std::setprecision(1) << pct_total << "%)" << std::flush;
+    };
+    auto on_batch = [&](size_t batch_num, size_t num_batches, const BatchResult& batch) {
+        // Failures arrive in input order, so the same ones are printed on every run
+        for (const auto& f : batch.failures) {
+            if (logged_failures >= MAX_LOGGED_FAILURES) {
+                break;
             }
-        }
-
-        test_count++;
-        size_t within_batch = test_count - (batch_num * BATCH_SIZE);
-        
-        // Progress within batch
-        if (within_batch % LOG_INTERVAL == 0) {
-            double pct_batch = (static_cast<double>(within_batch) / BATCH_SIZE) * 100.0;
-            double pct_total = (static_cast<double>(test_count) / num_tests) * 100.0;
-            std::cout << "\r  [" << timestamp() << "]   Progress: " 
-                      << within_batch << "/" << BATCH_SIZE 
-                      << " (" << std::fixed << std::setprecision(0) << pct_batch << "%) | Total: "
-                      << format_number(test_count) << "/" << format_number(num_tests) 
-                      << " (" << std::setprecision(1) << pct_total << "%)" << std::flush;
-        }
-        
-        // Batch complete
-        if (test_count % BATCH_SIZE == 0 || test_count == num_tests) {
-            std::cout << "\n";  // New line after progress
-            
-            auto batch_end = Clock::now();
-            auto batch_total = std::chrono::duration_cast<std::chrono::milliseconds>(batch_end - batch_start);
-            
-            total_encrypt_time += batch_encrypt_time;
-            total_decrypt_time += batch_decrypt_time;
-            total_parse_time += batch_parse_time;
-            total_cipher_init_time += batch_cipher_init_time;
-            total_verify_time += batch_verify_time;
-            
-            log("Batch " + std::to_string(batch_num + 1) + "/" + std::to_string(num_batches) + " complete:");
-            log("  - Time: " + std::to_string(batch_total.count()) + "ms");
-            log("  - Elements: " + format_number(batch_elements));
-            log("  - JSON parsing: " + std::to_string(batch_parse_time.count() / 1000000) + "ms");
-            log("  - Cipher init: " + std::to_string(batch_cipher_init_time.count() / 1000000) + "ms");
-            log("  - Encryption: " + std::to_string(batch_encrypt_time.count() / 1000000) + "ms");
-            log("  - Decryption: " + std::to_string(batch_decrypt_time.count() / 1000000) + "ms");
-            log("  - Verification: " + std::to_string(batch_verify_time.count() / 1000000) + "ms");
-            log("  - Passed so far: " + format_number(passed) + " | Failed: " + format_number(failed));
-            
-            double progress = 100.0 * test_count / num_tests;
-            log("  - Overall progress: " + std::to_string(static_cast<int>(progress)) + "%");
+            logged_failures++;
             std::cout << "\n";
-            
-            // Reset batch counters
-            batch_num++;
-            batch_elements = 0;
-            batch_encrypt_time = Duration{0};
-            batch_decrypt_time = Duration{0};
-            batch_parse_time = Duration{0};
-            batch_cipher_init_time = Duration{0};
-            batch_verify_time = Duration{0};
-            batch_start = Clock::now();
-            
-            // Start next batch logging
-            if (test_count < num_tests) {
-                size_t next_end = std::min(test_count + BATCH_SIZE, num_tests);
-                log("Batch " + std::to_string(batch_num + 1) + "/" + std::to_string(num_batches) + 
-                    " starting (tests " + format_number(test_count) + "-" + format_number(next_end - 1) + ")");
+            if (!f.error.empty()) {
+                log("  ERROR: FAILED test #" + std::to_string(f.index) + ": " + f.error);
+            } else {
+                log("  ERROR: FAILED test " + std::to_string(f.id) + ": " +
+                    "encrypt=" + (f.encrypt_ok ? "OK" : "MISMATCH") +
+                    ", decrypt=" + (f.decrypt_ok ? "OK" : "MISMATCH"));
             }
         }
-    }
+        total.merge(batch);
+        if (total.failures.size() > MAX_REPORTED_FAILURES) {
+            total.failures.resize(MAX_REPORTED_FAILURES);
+        }
 
-    ifs.close();
+        std::cout << "\n";  // New line after progress
+        size_t first = batch_num * BATCH_SIZE;
+        log("Batch " + std::to_string(batch_num + 1) + "/" + std::to_string(num_batches) +
+            " complete (tests " + format_number(first) + "-" + format_number(first + batch.tests - 1) + "):");
+        log("  - Time: " + std::to_string(batch.wall_time.count() / 1000000) + "ms");
+        log("  - Elements: " + format_number(batch.elements));
+        log("  - Parsing: " + std::to_string(batch.parse_time.count() / 1000000) + "ms");
+        log("  - Cipher init: " + std::to_string(batch.cipher_init_time.count() / 1000000) + "ms");
+        log("  - Encryption: " + std::to_string(batch.encrypt_time.count() / 1000000) + "ms");
+        log("  - Decryption: " + std::to_string(batch.decrypt_time.count() / 1000000) + "ms");
+        log("  - Verification: " + std::to_string(batch.verify_time.count() / 1000000) + "ms");
+        log("  - Passed so far: " + format_number(total.passed) + " | Failed: " + format_number(total.failed));
+
+        double progress = 100.0 * total.tests / num_tests;
+        log("  - Overall progress: " + std::to_string(static_cast<int>(progress)) + "%");
+        std::cout << "\n";
+    };
+
+    PassResult pass = run_pass(source, num_tests, num_threads, BATCH_SIZE, on_batch, on_progress);
+    Duration wall_time = pass.wall;
+
+    size_t total_elements = total.elements;
+    size_t passed = total.passed;
+    size_t failed = total.failed;
 
-    // Calculate statistics
-    double total_enc_sec = total_encrypt_time.count() / 1e9;
-    double total_dec_sec = total_decrypt_time.count() / 1e9;
-    double avg_enc_us = total_encrypt_time.count() / static_cast<double>(num_tests) / 1000.0;
-    double avg_dec_us = total_decrypt_time.count() / static_cast<double>(num_tests) / 1000.0;
+    // Calculate statistics. Phase times are summed over threads, so the
+    // per-operation figures are comparable between thread counts.
+    double total_enc_sec = total.encrypt_time.count() / 1e9;
+    double total_dec_sec = total.decrypt_time.count() / 1e9;
+    double wall_sec = wall_time.count() / 1e9;
+    double avg_enc_us = total.encrypt_time.count() / static_cast<double>(num_tests) / 1000.0;
+    double avg_dec_us = total.decrypt_time.count() / static_cast<double>(num_tests) / 1000.0;
     double enc_throughput = total_elements / total_enc_sec;
     double dec_throughput = total_elements / total_dec_sec;
+    double wall_throughput = total_elements / wall_sec;
+    double utilization = static_cast<double>(total.busy_time().count()) /
+                         (static_cast<double>(wall_time.count()) * static_cast<double>(pass.threads));
 
     // Print results
     log(std::string(79, '='));
     log("PHASE 1 COMPLETE: Benchmark Results");
     log(std::string(79, '='));
     std::cout << "\n";
-    
+
     log("Summary Statistics:");
     log("  Total test cases:        " + format_number(num_tests));
     log("  Total elements:          " + format_number(total_elements));
-    std::stringstream ss;
-    ss << std::fixed << std::setprecision(1) << static_cast<double>(total_elements) / num_tests;
-    log("  Avg elements/test:       " + ss.str());
+    log("  Avg elements/test:       " + format_fixed(static_cast<double>(total_elements) / num_tests, 1));
     std::cout << "\n";
-    
-    log("Timing Breakdown:");
-    ss.str(""); ss << std::fixed << std::setprecision(3) << (total_parse_time.count() / 1e9);
-    log("  JSON parsing:            " + ss.str() + " s");
-    ss.str(""); ss << std::fixed << std::setprecision(3) << (total_cipher_init_time.count() / 1e9);
-    log("  Cipher initialization:   " + ss.str() + " s");
-    ss.str(""); ss << std::fixed << std::setprecision(3) << total_enc_sec;
-    log("  Total encrypt time:      " + ss.str() + " s");
-    ss.str(""); ss << std::fixed << std::setprecision(3) << total_dec_sec;
-    log("  Total decrypt time:      " + ss.str() + " s");
-    ss.str(""); ss << std::fixed << std::setprecision(3) << (total_verify_time.count() / 1e9);
-    log("  Verification time:       " + ss.str() + " s");
+
+    log("Timing Breakdown" + std::string(num_threads > 1 ? " (summed over threads):" : ":"));
+    log("  Parsing:                 " + format_fixed(total.parse_time.count() / 1e9, 3) + " s");
+    log("  Cipher initialization:   " + format_fixed(total.cipher_init_time.count() / 1e9, 3) + " s");
+    log("  Total encrypt time:      " + format_fixed(total_enc_sec, 3) + " s");
+    log("  Total decrypt time:      " + format_fixed(total_dec_sec, 3) + " s");
+    log("  Verification time:       " + format_fixed(total.verify_time.count() / 1e9, 3) + " s");
+    log("  Wall-clock time:         " + format_fixed(wall_sec, 3) + " s");
     std::cout << "\n";
-    
+
     log("Per-Operation Averages:");
-    ss.str(""); ss << std::fixed << std::setprecision(3) << avg_enc_us;
-    log("  Avg encrypt time/test:   " + ss.str() + " μs");
-    ss.str(""); ss << std::fixed << std::setprecision(3) << avg_dec_us;
-    log("  Avg decrypt time/test:   " + ss.str() + " μs");
+    log("  Avg encrypt time/test:   " + format_fixed(avg_enc_us, 3) + " μs");
+    log("  Avg decrypt time/test:   " + format_fixed(avg_dec_us, 3) + " μs");
     std::cout << "\n";
-    
+
     log("Throughput:");
-    ss.str(""); ss << std::fixed << std::setprecision(0) << enc_throughput;
-    log("  Encrypt throughput:      " + ss.str() + " elements/s");
-    ss.str(""); ss << std::fixed << std::setprecision(0) << dec_throughput;
-    log("  Decrypt throughput:      " + ss.str() + " elements/s");
+    log("  Encrypt throughput:      " + format_fixed(enc_throughput, 0) + " elements/s");
+    log("  Decrypt throughput:      " + format_fixed(dec_throughput, 0) + " elements/s");
+    log("  Wall-clock throughput:   " + format_fixed(wall_throughput, 0) + " elements/s");
     std::cout << "\n";
 
+    if (num_threads > 1) {
+        log("Parallelism:");
+        log("  Threads:                 " + std::to_string(pass.threads) +
+            (pass.threads < num_threads ? " (of " + std::to_string(num_threads) + " requested)" : ""));
+        log("  Worker utilization:      " + format_fixed(100.0 * utilization, 1) + "%");
+        if (have_scaling) {
+            log("  Sample speedup:          " + format_fixed(scaling_speedup, 2) + "x");
+            log("  Scaling efficiency:      " + format_fixed(100.0 * scaling_efficiency, 1) + "%");
+        }
+        std::cout << "\n";
+    }
+
     // Interop results
     log(std::string(79, '='));
     log("Interoperability Results");
@@ -413,40 +719,67 @@ int main(int argc, char* argv[]) {
     log("  Passed:                  " + format_number(passed));
     log("  Failed:                  " + format_number(failed));
     if (failed > 0) {
-        log("    - Encryption mismatches: " + std::to_string(encrypt_mismatches));
-        log("    - Decryption mismatches: " + std::to_string(decrypt_mismatches));
+        log("    - Encryption mismatches: " + std::to_string(total.encrypt_mismatches));
+        log("    - Decryption mismatches: " + std::to_string(total.decrypt_mismatches));
     }
-    ss.str(""); ss << std::fixed << std::setprecision(2) << (100.0 * passed / num_tests);
-    log("  Success rate:            " + ss.str() + "%");
+    log("  Success rate:            " + format_fixed(100.0 * passed / num_tests, 2) + "%");
     std::cout << "\n";
 
     // Write results to JSON
     log(std::string(79, '='));
     log("PHASE 2: Writing Results");
     log(std::string(79, '='));
-    
+
     json results;
     results["description"] = "100k Rescue Cipher Benchmark Results (C++)";
     results["platform"] = "C++";
     results["benchmark_results"] = {
         {"total_tests", num_tests},
         {"total_elements", total_elements},
-        {"total_encrypt_time_ns", total_encrypt_time.count()},
-        {"total_decrypt_time_ns", total_decrypt_time.count()},
-        {"total_parse_time_ns", total_parse_time.count()},
-        {"total_cipher_init_time_ns", total_cipher_init_time.count()},
-        {"total_verify_time_ns", total_verify_time.count()},
+        {"total_encrypt_time_ns", total.encrypt_time.count()},
+        {"total_decrypt_time_ns", total.decrypt_time.count()},
+        {"total_parse_time_ns", total.parse_time.count()},
+        {"total_cipher_init_time_ns", total.cipher_init_time.count()},
+        {"total_verify_time_ns", total.verify_time.count()},
+        {"wall_time_ns", wall_time.count()},
         {"avg_encrypt_time_us", avg_enc_us},
         {"avg_decrypt_time_us", avg_dec_us},
         {"encrypt_throughput_elements_per_sec", enc_throughput},
-        {"decrypt_throughput_elements_per_sec", dec_throughput}
+        {"decrypt_throughput_elements_per_sec", dec_throughput},
+        {"wall_throughput_elements_per_sec", wall_throughput}
+    };
+    results["parallelism"] = {
+        {"threads", num_threads},
+        {"threads_used", pass.threads},
+        {"batch_size", BATCH_SIZE},
+        {"worker_utilization", utilization}
     };
+    if (have_scaling) {
+        results["parallelism"]["scaling"] = {
+            {"sample_tests", scaling_sample},
+            {"threads_used", scaling_threads},
+            {"single_thread_wall_ns", scaling_single_wall.count()},
+            {"multi_thread_wall_ns", scaling_multi_wall.count()},
+            {"speedup", scaling_speedup},
+            {"efficiency", scaling_efficiency}
+        };
+    }
+    json failures = json::array();
+    for (const auto& f : total.failures) {
+        json entry = {{"index", f.index}, {"id", f.id}, {"encrypt_ok", f.encrypt_ok},
+                      {"decrypt_ok", f.decrypt_ok}};
+        if (!f.error.empty()) {
+            entry["error"] = f.error;
+        }
+        failures.push_back(entry);
+    }
     results["interop_results"] = {
         {"passed", passed},
         {"failed", failed},
-        {"encrypt_mismatches", encrypt_mismatches},
-        {"decrypt_mismatches", decrypt_mismatches},
-        {"success_rate_percent", 100.0 * passed / num_tests}
+        {"encrypt_mismatches", total.encrypt_mismatches},
+        {"decrypt_mismatches", total.decrypt_mismatches},
+        {"success_rate_percent", 100.0 * passed / num_tests},
+        {"first_failures", failures}
     };
     results["timestamp"] = std::chrono::system_clock::now().time_since_epoch().count();
 
@@ -460,12 +793,11 @@ int main(int argc, char* argv[]) {
 
     auto program_end = Clock::now();
     auto total_time = std::chrono::duration_cast<std::chrono::milliseconds>(program_end - program_start);
-    
+
     log(std::string(79, '='));
     log("BENCHMARK COMPLETE");
     log(std::string(79, '='));
-    ss.str(""); ss << std::fixed << std::setprecision(2) << (total_time.count() / 1000.0);
-    log("Total execution time: " + ss.str() + " seconds");
+    log("Total execution time: " + format_fixed(total_time.count() / 1000.0, 2) + " seconds");
     std::cout << "\n";
 
     return failed > 0 ? 1 : 0;
@@ -0,0 +1,128 @@
+/**
+ * Convert JSON test vectors to the binary .rvec format.
+ *
+ * Accepts every JSON layout the harness produces:
+ *   - data/test_vectors_js.json and chunk files: {"test_vectors": [...]}
+ *   - data/test_vectors_100k.ndjson: metadata line, then one vector per line
+ *
+ * Usage: ./convert_vectors <input.json|input.ndjson> <output.rvec>
+ *
+ * Exit codes:
+ *   0 = Success
+ *   2 = Error (file not found, parse error, invalid vector)
+ */
+
+#include "vector_file.hpp"
+
+#include <rescue/rescue.hpp>
+#include <nlohmann/json.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using json = nlohmann::json;
+using namespace rescue;
+
+/**
+ * Convert hex string to byte vector
+ */
+std::vector<uint8_t> hex_to_bytes(const std::string& hex) {
+    std::vector<uint8_t> bytes;
+    bytes.reserve(hex.length() / 2);
+    for (size_t i = 0; i < hex.length(); i += 2) {
+        uint8_t byte = static_cast<uint8_t>(std::stoul(hex.substr(i, 2), nullptr, 16));
+        bytes.push_back(byte);
+    }
+    return bytes;
+}
+
+/**
+ * Decode an array of little-endian hex field elements
+ */
+std::vector<Fp> hex_array_to_fp(const json& arr) {
+    std::vector<Fp> out;
+    out.reserve(arr.size());
+    for (const auto& hex : arr) {
+        std::vector<uint8_t> bytes = hex_to_bytes(hex.get<std::string>());
+        out.push_back(Fp::from_bytes(std::span<const uint8_t>(bytes)));
+    }
+    return out;
+}
+
+/**
+ * Append one JSON test vector to the writer
+ */
+void add_vector(rvec::VectorWriter& writer, const json& tv) {
+    std::vector<uint8_t> shared_secret = hex_to_bytes(tv["shared_secret"]);
+    std::vector<uint8_t> nonce = hex_to_bytes(tv["nonce"]);
+    std::vector<Fp> plaintext = hex_array_to_fp(tv["plaintext"]);
+
+    // test_vectors_js.json stores the field values separately from raw bytes
+    const json& ct = tv.contains("ciphertext_bigints") ? tv["ciphertext_bigints"] : tv["ciphertext"];
+    std::vector<Fp> ciphertext = hex_array_to_fp(ct);
+
+    writer.add(tv["id"].get<uint64_t>(), shared_secret, nonce, plaintext, ciphertext);
+}
+
+int main(int argc, char* argv[]) {
+    if (argc != 3) {
+        std::cerr << "Usage: " << argv[0] << " <input.json|input.ndjson> <output.rvec>\n";
+        return 2;
+    }
+    std::string input_file = argv[1];
+    std::string output_file = argv[2];
+
+    auto start = std::chrono::steady_clock::now();
+    size_t count = 0;
+    uint64_t bytes_written = 0;
+
+    try {
+        std::ifstream ifs(input_file);
+        if (!ifs.is_open()) {
+            std::cerr << "ERROR: Could not open " << input_file << "\n";
+            return 2;
+        }
+
+        rvec::VectorWriter writer(output_file);
+
+        // A whole-document JSON file parses in one go; NDJSON fails on the
+        // second line, so fall back to line-by-line parsing.
+        std::string first_line;
+        std::getline(ifs, first_line);
+        json first = json::parse(first_line, nullptr, false);
+
+        if (!first.is_discarded() && !first.contains("test_vectors")) {
+            // NDJSON: the first line is metadata
+            std::string line;
+            while (std::getline(ifs, line)) {
+                if (line.empty()) {
+                    continue;
+                }
+                add_vector(writer, json::parse(line));
+                ++count;
+            }
+        } else {
+            ifs.clear();
+            ifs.seekg(0, std::ios::beg);
+            json doc = json::parse(ifs);
+            for (const auto& tv : doc["test_vectors"]) {
+                add_vector(writer, tv);
+                ++count;
+            }
+        }
+
+        bytes_written = writer.finish();
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: " << e.what() << "\n";
+        return 2;
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    std::cout << "Converted " << count << " vectors to " << output_file << " (" << bytes_written
+              << " bytes) in " << elapsed.count() << "ms\n";
+    return 0;
+}
@@ -0,0 +1,97 @@
+/**
+ * Generate binary (.rvec) test vectors with the C++ implementation.
+ *
+ * Vectors are deterministic for a given seed, so large benchmark inputs can
+ * be regenerated instead of stored. For cross-implementation checks, convert
+ * the JS-generated vectors with convert_vectors instead.
+ *
+ * Usage: ./generate_vectors_bin <num_tests> <output.rvec> [max_length] [seed]
+ *
+ * Exit codes:
+ *   0 = Success
+ *   2 = Error (bad arguments, write failure)
+ */
+
+#include "vector_file.hpp"
+
+#include <rescue/rescue.hpp>
+
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace rescue;
+
+/**
+ * Fill a byte array from the generator
+ */
+template <size_t N>
+std::array<uint8_t, N> random_array(std::mt19937_64& rng) {
+    std::array<uint8_t, N> out{};
+    for (auto& b : out) {
+        b = static_cast<uint8_t>(rng());
+    }
+    return out;
+}
+
+int main(int argc, char* argv[]) {
+    if (argc < 3 || argc > 5) {
+        std::cerr << "Usage: " << argv[0] << " <num_tests> <output.rvec> [max_length] [seed]\n";
+        return 2;
+    }
+
+    size_t num_tests = 0;
+    size_t max_length = 250;  // Matches js/generate_test_vectors.js
+    uint64_t seed = 1;
+    try {
+        num_tests = std::stoul(argv[1]);
+        if (argc > 3) max_length = std::stoul(argv[3]);
+        if (argc > 4) seed = std::stoull(argv[4]);
+    } catch (const std::exception&) {
+        std::cerr << "ERROR: numeric arguments expected\n";
+        return 2;
+    }
+    if (max_length == 0) {
+        std::cerr << "ERROR: max_length must be positive\n";
+        return 2;
+    }
+
+    std::string output_file = argv[2];
+    std::mt19937_64 rng(seed);
+    std::uniform_int_distribution<size_t> length_dist(1, max_length);
+
+    auto start = std::chrono::steady_clock::now();
+    uint64_t bytes_written = 0;
+    try {
+        rvec::VectorWriter writer(output_file);
+
+        for (size_t id = 0; id < num_tests; ++id) {
+            auto shared_secret = random_array<32>(rng);
+            auto nonce = random_array<16>(rng);
+
+            std::vector<Fp> plaintext(length_dist(rng));
+            for (auto& x : plaintext) {
+                auto bytes = random_array<32>(rng);
+                x = Fp(uint256::from_bytes(bytes));  // Reduced mod p
+            }
+
+            RescueCipher cipher(shared_secret);
+            std::vector<Fp> ciphertext = cipher.encrypt_raw(plaintext, nonce);
+
+            writer.add(id, shared_secret, nonce, plaintext, ciphertext);
+        }
+
+        bytes_written = writer.finish();
+    } catch (const std::exception& e) {
+        std::cerr << "ERROR: " << e.what() << "\n";
+        return 2;
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now() - start);
+    std::cout << "Generated " << num_tests << " vectors in " << output_file << " (" << bytes_written
+              << " bytes) in " << elapsed.count() << "ms\n";
+    return 0;
+}
@@ -0,0 +1,311 @@
+#pragma once
+
+/**
+ * Binary test-vector format (.rvec) for the interop harness.
+ *
+ * Parsing 100k hex-encoded JSON vectors costs far more than encrypting them.
+ * This format stores field elements as 32-byte little-endian values so a
+ * reader can mmap the file and hand out std::span<const Fp> directly.
+ *
+ * Layout (all integers little-endian, version 1):
+ *
+ *   offset 0   FileHeader (64 bytes)
+ *   offset 64  element data: for each vector, plaintext[len] then
+ *              ciphertext[len], 32 bytes per element
+ *   index_offset
+ *              IndexEntry[num_vectors] (72 bytes each)
+ *
+ * The index follows the data so the writer can stream vectors and only keep
+ * the small index in memory. Elements must be canonical (< p); the reader
+ * verifies this once at open time so the spans are valid Fp values.
+ */
+
+#include <rescue/field.hpp>
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace rvec {
+
+constexpr std::array<char, 8> MAGIC = {'R', 'E', 'S', 'C', 'V', 'E', 'C', '\0'};
+constexpr uint32_t VERSION = 1;
+constexpr size_t ELEMENT_SIZE = 32;
+
+struct FileHeader {
+    std::array<char, 8> magic;
+    uint32_t version;
+    uint32_t header_size;
+    uint64_t num_vectors;
+    uint64_t index_offset;
+    uint64_t data_offset;
+    uint64_t num_elements;  // Total elements in the data section
+    uint64_t file_size;
+    uint64_t reserved;
+};
+
+struct IndexEntry {
+    uint64_t id;
+    uint64_t element_offset;  // Element index of plaintext[0] in the data section
+    uint32_t length;          // Elements in plaintext (and in ciphertext)
+    uint32_t reserved;
+    std::array<uint8_t, 32> shared_secret;
+    std::array<uint8_t, 16> nonce;
+};
+
+static_assert(sizeof(FileHeader) == 64);
+static_assert(sizeof(IndexEntry) == 72);
+static_assert(std::is_trivially_copyable_v<FileHeader> && std::is_trivially_copyable_v<IndexEntry>);
+
+// Zero-copy access reinterprets element bytes as Fp, which holds exactly the
+// four little-endian uint256 limbs.
+static_assert(sizeof(rescue::Fp) == ELEMENT_SIZE);
+static_assert(std::is_trivially_copyable_v<rescue::Fp>);
+static_assert(std::endian::native == std::endian::little,
+              "rvec zero-copy reader requires a little-endian host");
+
+/**
+ * A single test vector backed by the mapped file.
+ */
+struct VectorView {
+    uint64_t id;
+    std::span<const uint8_t, 32> shared_secret;
+    std::span<const uint8_t, 16> nonce;
+    std::span<const rescue::Fp> plaintext;
+    std::span<const rescue::Fp> ciphertext;
+};
+
+/**
+ * Read-only memory-mapped .rvec file.
+ */
+class VectorFile {
+public:
+    /**
+     * Map and validate a vector file.
+     * @throws std::runtime_error if the file cannot be mapped or is malformed.
+     */
+    explicit VectorFile(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw std::runtime_error("cannot open " + path);
+        }
+        struct stat st {};
+        if (::fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(sizeof(FileHeader))) {
+            ::close(fd);
+            throw std::runtime_error(path + ": too small for an rvec header");
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        void* base = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        ::close(fd);
+        if (base == MAP_FAILED) {
+            throw std::runtime_error("cannot mmap " + path);
+        }
+        base_ = static_cast<const uint8_t*>(base);
+        ::madvise(base, size_, MADV_SEQUENTIAL);
+
+        try {
+            validate(path);
+        } catch (...) {
+            ::munmap(const_cast<uint8_t*>(base_), size_);
+            throw;
+        }
+    }
+
+    ~VectorFile() {
+        if (base_ != nullptr) {
+            ::munmap(const_cast<uint8_t*>(base_), size_);
+        }
+    }
+
+    VectorFile(const VectorFile&) = delete;
+    VectorFile& operator=(const VectorFile&) = delete;
+
+    [[nodiscard]] size_t size() const { return static_cast<size_t>(header().num_vectors); }
+    [[nodiscard]] size_t file_size() const { return size_; }
+    [[nodiscard]] uint64_t num_elements() const { return header().num_elements; }
+
+    [[nodiscard]] VectorView operator[](size_t i) const {
+        const IndexEntry& e = index()[i];
+        const rescue::Fp* pt = elements() + e.element_offset;
+        return VectorView{
+            e.id,
+            std::span<const uint8_t, 32>(e.shared_secret),
+            std::span<const uint8_t, 16>(e.nonce),
+            std::span<const rescue::Fp>(pt, e.length),
+            std::span<const rescue::Fp>(pt + e.length, e.length),
+        };
+    }
+
+private:
+    const uint8_t* base_ = nullptr;
+    size_t size_ = 0;
+
+    [[nodiscard]] const FileHeader& header() const {
+        return *reinterpret_cast<const FileHeader*>(base_);
+    }
+    [[nodiscard]] const IndexEntry* index() const {
+        return reinterpret_cast<const IndexEntry*>(base_ + header().index_offset);
+    }
+    [[nodiscard]] const rescue::Fp* elements() const {
+        return reinterpret_cast<const rescue::Fp*>(base_ + header().data_offset);
+    }
+
+    void validate(const std::string& path) const {
+        const FileHeader& h = header();
+        if (h.magic != MAGIC) {
+            throw std::runtime_error(path + ": not an rvec file");
+        }
+        if (h.version != VERSION) {
+            throw std::runtime_error(path + ": unsupported rvec version " + std::to_string(h.version));
+        }
+        if (h.num_elements > size_ / ELEMENT_SIZE || h.num_vectors > size_ / sizeof(IndexEntry) ||
+            h.header_size != sizeof(FileHeader) || h.file_size != size_ ||
+            h.data_offset % ELEMENT_SIZE != 0 || h.index_offset % alignof(IndexEntry) != 0 ||
+            // Compared by subtraction: a sum of offsets from the file could wrap
+            h.data_offset > h.index_offset ||
+            h.num_elements > (h.index_offset - h.data_offset) / ELEMENT_SIZE ||
+            h.index_offset > size_ || size_ - h.index_offset != h.num_vectors * sizeof(IndexEntry)) {
+            throw std::runtime_error(path + ": inconsistent rvec header");
+        }
+
+        for (size_t i = 0; i < h.num_vectors; ++i) {
+            const IndexEntry& e = index()[i];
+            if (e.element_offset > h.num_elements ||
+                e.length > (h.num_elements - e.element_offset) / 2) {
+                throw std::runtime_error(path + ": vector " + std::to_string(e.id) + " out of bounds");
+            }
+        }
+
+        // Fp values must be reduced; check once so spans need no per-use checks
+        const auto* data = base_ + h.data_offset;
+        for (uint64_t i = 0; i < h.num_elements; ++i) {
+            auto bytes = std::span<const uint8_t, 32>(data + i * ELEMENT_SIZE, ELEMENT_SIZE);
+            if (!rescue::fp::is_valid_field_element(rescue::uint256::from_bytes(bytes))) {
+                throw std::runtime_error(path + ": element " + std::to_string(i) + " is not reduced");
+            }
+        }
+    }
+};
+
+/**
+ * Streaming .rvec writer: element data is written as vectors are added and
+ * the index is appended by finish().
+ */
+class VectorWriter {
+public:
+    explicit VectorWriter(const std::string& path) : path_(path) {
+        file_ = std::fopen(path.c_str(), "wb");
+        if (file_ == nullptr) {
+            throw std::runtime_error("cannot create " + path);
+        }
+        FileHeader placeholder{};
+        write(&placeholder, sizeof(placeholder));
+    }
+
+    ~VectorWriter() {
+        if (file_ != nullptr) {
+            std::fclose(file_);
+        }
+    }
+
+    VectorWriter(const VectorWriter&) = delete;
+    VectorWriter& operator=(const VectorWriter&) = delete;
+
+    /**
+     * Append one vector.
+     * @throws std::invalid_argument if plaintext and ciphertext lengths differ.
+     */
+    void add(uint64_t id, std::span<const uint8_t> shared_secret, std::span<const uint8_t> nonce,
+             std::span<const rescue::Fp> plaintext, std::span<const rescue::Fp> ciphertext) {
+        if (plaintext.size() != ciphertext.size()) {
+            throw std::invalid_argument("plaintext and ciphertext lengths differ");
+        }
+        IndexEntry entry{};
+        if (shared_secret.size() != entry.shared_secret.size() || nonce.size() != entry.nonce.size()) {
+            throw std::invalid_argument("shared secret must be 32 bytes and nonce 16 bytes");
+        }
+        entry.id = id;
+        entry.element_offset = num_elements_;
+        entry.length = static_cast<uint32_t>(plaintext.size());
+        std::memcpy(entry.shared_secret.data(), shared_secret.data(), entry.shared_secret.size());
+        std::memcpy(entry.nonce.data(), nonce.data(), entry.nonce.size());
+        index_.push_back(entry);
+
+        for (auto elems : {plaintext, ciphertext}) {
+            for (const auto& x : elems) {
+                auto bytes = x.to_bytes();
+                write(bytes.data(), bytes.size());
+            }
+        }
+        num_elements_ += 2 * plaintext.size();
+    }
+
+    /**
+     * Write the index and final header, then close the file.
+     * @return Total file size in bytes.
+     */
+    uint64_t finish() {
+        FileHeader h{};
+        h.magic = MAGIC;
+        h.version = VERSION;
+        h.header_size = sizeof(FileHeader);
+        h.num_vectors = index_.size();
+        h.data_offset = sizeof(FileHeader);
+        h.num_elements = num_elements_;
+        h.index_offset = h.data_offset + num_elements_ * ELEMENT_SIZE;
+        h.file_size = h.index_offset + index_.size() * sizeof(IndexEntry);
+
+        write(index_.data(), index_.size() * sizeof(IndexEntry));
+        if (std::fseek(file_, 0, SEEK_SET) != 0) {
+            throw std::runtime_error("cannot seek in " + path_);
+        }
+        write(&h, sizeof(h));
+        if (std::fclose(file_) != 0) {
+            file_ = nullptr;
+            throw std::runtime_error("cannot close " + path_);
+        }
+        file_ = nullptr;
+        return h.file_size;
+    }
+
+private:
+    std::string path_;
+    std::FILE* file_ = nullptr;
+    std::vector<IndexEntry> index_;
+    uint64_t num_elements_ = 0;
+
+    void write(const void* data, size_t n) {
+        if (n != 0 && std::fwrite(data, 1, n, file_) != n) {
+            throw std::runtime_error("write failed for " + path_);
+        }
+    }
+};
+
+/**
+ * True if the file at path starts with the rvec magic.
+ */
+inline bool is_vector_file(const std::string& path) {
+    std::array<char, 8> magic{};
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (f == nullptr) {
+        return false;
+    }
+    size_t n = std::fread(magic.data(), 1, magic.size(), f);
+    std::fclose(f);
+    return n == magic.size() && magic == MAGIC;
+}
+
+}  // namespace rvec
@@ -0,0 +1,80 @@
+#pragma once
+
+/**
+ * @file client.hpp
+ * @brief Client library for rescue-served.
+ */
+
+#include <rescue/served/protocol.hpp>
+
+#include <span>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace rescue::served {
+
+/**
+ * @brief A request the daemon answered with a non-OK status.
+ */
+class ServedError : public std::runtime_error {
+public:
+    ServedError(Status status, const std::string& what) : std::runtime_error(what), status_(status) {}
+
+    [[nodiscard]] Status status() const { return status_; }
+
+    /// True if the daemon shed the request and it may be retried later.
+    [[nodiscard]] bool overloaded() const { return status_ == Status::OVERLOADED; }
+
+private:
+    Status status_;
+};
+
+/**
+ * @brief One connection to rescue-served, with one request in flight at a time.
+ *
+ * Results are identical to calling RescueCipher::encrypt_raw(),
+ * decrypt_raw() and RescuePrimeHash::digest() in process. Not thread-safe;
+ * use one Client per thread.
+ */
+class Client {
+public:
+    /**
+     * @brief Connect to the daemon.
+     * @throws std::system_error if the socket cannot be connected.
+     */
+    explicit Client(const std::string& socket_path);
+
+    ~Client();
+
+    Client(Client&& other) noexcept;
+    Client& operator=(Client&& other) noexcept;
+    Client(const Client&) = delete;
+    Client& operator=(const Client&) = delete;
+
+    /**
+     * @brief Encrypt with the cipher derived from secret.
+     * @throws ServedError on a non-OK response, std::system_error on I/O failure.
+     */
+    [[nodiscard]] std::vector<Fp> encrypt(const Secret& secret, const Nonce& nonce, std::span<const Fp> plaintext);
+
+    /**
+     * @brief Decrypt with the cipher derived from secret.
+     * @throws ServedError on a non-OK response, std::system_error on I/O failure.
+     */
+    [[nodiscard]] std::vector<Fp> decrypt(const Secret& secret, const Nonce& nonce, std::span<const Fp> ciphertext);
+
+    /**
+     * @brief Rescue-Prime digest of message.
+     * @throws ServedError on a non-OK response, std::system_error on I/O failure.
+     */
+    [[nodiscard]] std::vector<Fp> hash(std::span<const Fp> message);
+
+private:
+    std::vector<Fp> call(const std::vector<uint8_t>& frame, uint32_t id);
+
+    int fd_ = -1;
+    uint32_t next_id_ = 1;
+};
+
+}  // namespace rescue::served
@@ -0,0 +1,107 @@
+#pragma once
+
+/**
+ * @file protocol.hpp
+ * @brief Wire format spoken between rescue-served and its clients.
+ *
+ * Every message is a 12-byte header followed by `length` body bytes. All
+ * integers are little-endian and field elements are 32-byte little-endian
+ * values, as in Fp::to_bytes().
+ *
+ * Header:
+ *   u32 length   body bytes after the header
+ *   u32 id       chosen by the client, echoed in the response
+ *   u8  code     Op in requests, Status in responses
+ *   u8  reserved[3]
+ *
+ * Request bodies:
+ *   ENCRYPT / DECRYPT  secret[32] nonce[16] element[32] * n
+ *   HASH               element[32] * n
+ *
+ * Response bodies are element[32] * n on OK and empty otherwise. A
+ * connection may pipeline requests; responses can arrive out of order.
+ */
+
+#include <rescue/field.hpp>
+#include <rescue/rescue_cipher.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <vector>
+
+namespace rescue::served {
+
+/// Size of the fixed frame header.
+inline constexpr size_t HEADER_SIZE = 12;
+
+/// Largest number of field elements accepted in one request.
+inline constexpr size_t MAX_ELEMENTS = size_t{1} << 16;
+
+/// Bytes preceding the elements in ENCRYPT/DECRYPT bodies.
+inline constexpr size_t CIPHER_PREFIX_SIZE = RESCUE_CIPHER_SECRET_SIZE + RESCUE_CIPHER_NONCE_SIZE;
+
+/**
+ * @brief Request operations.
+ */
+enum class Op : uint8_t {
+    ENCRYPT = 1,  ///< RescueCipher::encrypt_raw
+    DECRYPT = 2,  ///< RescueCipher::decrypt_raw
+    HASH = 3,     ///< RescuePrimeHash::digest
+};
+
+/**
+ * @brief Response status codes.
+ */
+enum class Status : uint8_t {
+    OK = 0,
+    BAD_REQUEST = 1,     ///< Unknown op or malformed body
+    OVERLOADED = 2,      ///< Submission queue full; retry later
+    INTERNAL_ERROR = 3,  ///< The operation threw
+};
+
+/**
+ * @brief Decoded frame header.
+ */
+struct FrameHeader {
+    uint32_t length = 0;
+    uint32_t id = 0;
+    uint8_t code = 0;  ///< Op or Status
+};
+
+using Secret = std::array<uint8_t, RESCUE_CIPHER_SECRET_SIZE>;
+using Nonce = std::array<uint8_t, RESCUE_CIPHER_NONCE_SIZE>;
+
+void encode_header(const FrameHeader& header, std::span<uint8_t, HEADER_SIZE> out);
+
+[[nodiscard]] FrameHeader decode_header(std::span<const uint8_t, HEADER_SIZE> in);
+
+/**
+ * @brief Append elements as 32-byte little-endian values.
+ */
+void append_elements(std::vector<uint8_t>& out, std::span<const Fp> elements);
+
+/**
+ * @brief Decode a run of 32-byte elements.
+ * @throws std::invalid_argument if the size is not a multiple of 32 or exceeds MAX_ELEMENTS.
+ */
+[[nodiscard]] std::vector<Fp> decode_elements(std::span<const uint8_t> bytes);
+
+/**
+ * @brief Build a complete ENCRYPT or DECRYPT request frame.
+ */
+[[nodiscard]] std::vector<uint8_t> encode_cipher_request(uint32_t id, Op op, const Secret& secret,
+                                                         const Nonce& nonce, std::span<const Fp> elements);
+
+/**
+ * @brief Build a complete HASH request frame.
+ */
+[[nodiscard]] std::vector<uint8_t> encode_hash_request(uint32_t id, std::span<const Fp> message);
+
+/**
+ * @brief Build a complete response frame; elements are only sent with Status::OK.
+ */
+[[nodiscard]] std::vector<uint8_t> encode_response(uint32_t id, Status status, std::span<const Fp> elements);
+
+}  // namespace rescue::served
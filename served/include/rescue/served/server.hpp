@@ -0,0 +1,93 @@
+#pragma once
+
+/**
+ * @file server.hpp
+ * @brief rescue-served: a per-host encryption daemon on a Unix domain socket.
+ *
+ * Processes that would each construct their own RescueCipher send requests
+ * to one daemon instead. The daemon keeps an LRU cache of expanded ciphers,
+ * so key derivation and round-constant sampling are paid once per key per
+ * host, and coalesces concurrent requests:
+ *
+ * - One reader thread per connection decodes frames and pushes jobs into a
+ *   bounded lock-free SubmissionQueue. A full queue is answered with
+ *   Status::OVERLOADED immediately rather than buffered.
+ * - Worker threads drain up to max_batch jobs per wakeup, group cipher jobs
+ *   by key and run all of a key's CTR counter blocks through one
+ *   encrypt_blocks() call, then answer each job on its connection.
+ */
+
+#include <rescue/served/protocol.hpp>
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+namespace rescue::served {
+
+/**
+ * @brief Server configuration.
+ */
+struct ServerOptions {
+    std::string socket_path;      ///< Filesystem path of the listening socket
+    size_t workers = 1;           ///< Batching worker threads
+    size_t queue_capacity = 4096; ///< Pending jobs before OVERLOADED (rounded up to a power of two)
+    size_t max_batch = 64;        ///< Jobs coalesced per worker wakeup
+    size_t cache_capacity = 1024; ///< Expanded ciphers kept, least recently used evicted
+};
+
+/**
+ * @brief Counters since the server started.
+ */
+struct ServerStats {
+    uint64_t requests = 0;      ///< Frames received, including rejected ones
+    uint64_t batches = 0;       ///< Worker wakeups that processed at least one job
+    uint64_t jobs = 0;          ///< Jobs processed by workers
+    uint64_t blocks = 0;        ///< Cipher permutations run for CTR counters
+    uint64_t cache_hits = 0;
+    uint64_t cache_misses = 0;  ///< Cipher constructions
+    uint64_t overloaded = 0;    ///< Requests rejected because the queue was full
+    uint64_t bad_requests = 0;
+};
+
+/**
+ * @brief The daemon. Listens on construction and serves until stop().
+ */
+class Server {
+public:
+    /**
+     * @brief Bind the socket and start the acceptor and worker threads.
+     *
+     * An existing file at socket_path is replaced.
+     *
+     * @throws std::invalid_argument if the options are unusable.
+     * @throws std::system_error if the socket cannot be bound.
+     */
+    explicit Server(ServerOptions options);
+
+    /**
+     * @brief Stops the server if still running.
+     */
+    ~Server();
+
+    Server(const Server&) = delete;
+    Server& operator=(const Server&) = delete;
+
+    /**
+     * @brief Close the socket, disconnect clients and join all threads.
+     *
+     * Jobs still queued are dropped unanswered. Idempotent.
+     */
+    void stop();
+
+    [[nodiscard]] ServerStats stats() const;
+
+    [[nodiscard]] const ServerOptions& options() const;
+
+private:
+    struct Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+}  // namespace rescue::served
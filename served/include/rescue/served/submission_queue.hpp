@@ -0,0 +1,108 @@
+#pragma once
+
+/**
+ * @file submission_queue.hpp
+ * @brief Bounded lock-free multi-producer multi-consumer queue.
+ *
+ * Each slot carries a sequence number that says whose turn it is: producers
+ * claim a slot by advancing the enqueue position with a CAS, write the value
+ * and publish it by bumping the slot's sequence; consumers do the mirror
+ * image. No operation blocks, and try_push() fails instead of growing, which
+ * is what gives rescue-served its backpressure.
+ */
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+
+namespace rescue::served {
+
+template <typename T>
+class SubmissionQueue {
+public:
+    /**
+     * @brief Create a queue.
+     * @param capacity Slot count, rounded up to a power of two (at least 2).
+     */
+    explicit SubmissionQueue(size_t capacity)
+        : capacity_(std::bit_ceil(capacity < 2 ? size_t{2} : capacity)),
+          mask_(capacity_ - 1),
+          slots_(std::make_unique<Slot[]>(capacity_)) {
+        for (size_t i = 0; i < capacity_; ++i) {
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    SubmissionQueue(const SubmissionQueue&) = delete;
+    SubmissionQueue& operator=(const SubmissionQueue&) = delete;
+
+    /**
+     * @brief Enqueue a value unless the queue is full.
+     * @return False, leaving value untouched, if every slot is occupied.
+     */
+    [[nodiscard]] bool try_push(T& value) {
+        size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[pos & mask_];
+            size_t seq = slot.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos);
+            if (diff == 0) {
+                if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    slot.value = std::move(value);
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;  // The slot still holds the value from a lap ago
+            } else {
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Dequeue the oldest value if there is one.
+     * @return False if the queue is empty.
+     */
+    [[nodiscard]] bool try_pop(T& out) {
+        size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots_[pos & mask_];
+            size_t seq = slot.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<std::ptrdiff_t>(seq) - static_cast<std::ptrdiff_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    out = std::move(slot.value);
+                    slot.sequence.store(pos + capacity_, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false;
+            } else {
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    [[nodiscard]] size_t capacity() const { return capacity_; }
+
+private:
+    struct Slot {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+    // Producers and consumers each hammer one position; keep them apart
+    static constexpr size_t CACHE_LINE = 64;
+
+    const size_t capacity_;
+    const size_t mask_;
+    std::unique_ptr<Slot[]> slots_;
+    alignas(CACHE_LINE) std::atomic<size_t> enqueue_pos_{0};
+    alignas(CACHE_LINE) std::atomic<size_t> dequeue_pos_{0};
+};
+
+}  // namespace rescue::served
@@ -0,0 +1,142 @@
+#include <rescue/served/client.hpp>
+
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <system_error>
+#include <utility>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace rescue::served {
+
+namespace {
+
+[[noreturn]] void throw_errno(const char* what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+void write_all(int fd, std::span<const uint8_t> data) {
+    while (!data.empty()) {
+        ssize_t n = ::send(fd, data.data(), data.size(), MSG_NOSIGNAL);
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw_errno("rescue-served write");
+        }
+        data = data.subspan(static_cast<size_t>(n));
+    }
+}
+
+void read_all(int fd, std::span<uint8_t> out) {
+    while (!out.empty()) {
+        ssize_t n = ::read(fd, out.data(), out.size());
+        if (n == 0) {
+            throw std::system_error(ECONNRESET, std::generic_category(), "rescue-served closed the connection");
+        }
+        if (n < 0) {
+            if (errno == EINTR) {
+                continue;
+            }
+            throw_errno("rescue-served read");
+        }
+        out = out.subspan(static_cast<size_t>(n));
+    }
+}
+
+const char* status_name(Status status) {
+    switch (status) {
+        case Status::OK:
+            return "ok";
+        case Status::BAD_REQUEST:
+            return "bad request";
+        case Status::OVERLOADED:
+            return "overloaded";
+        case Status::INTERNAL_ERROR:
+            return "internal error";
+    }
+    return "unknown status";
+}
+
+}  // anonymous namespace
+
+Client::Client(const std::string& socket_path) {
+    sockaddr_un addr{};
+    if (socket_path.empty() || socket_path.size() >= sizeof(addr.sun_path)) {
+        throw std::invalid_argument("Invalid socket path " + socket_path);
+    }
+    addr.sun_family = AF_UNIX;
+    std::memcpy(addr.sun_path, socket_path.c_str(), socket_path.size() + 1);
+
+    fd_ = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (fd_ < 0) {
+        throw_errno("socket");
+    }
+    if (::connect(fd_, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0) {
+        int err = errno;
+        ::close(fd_);
+        throw std::system_error(err, std::generic_category(), "connect " + socket_path);
+    }
+}
+
+Client::~Client() {
+    if (fd_ >= 0) {
+        ::close(fd_);
+    }
+}
+
+Client::Client(Client&& other) noexcept
+    : fd_(std::exchange(other.fd_, -1)), next_id_(other.next_id_) {}
+
+Client& Client::operator=(Client&& other) noexcept {
+    if (this != &other) {
+        if (fd_ >= 0) {
+            ::close(fd_);
+        }
+        fd_ = std::exchange(other.fd_, -1);
+        next_id_ = other.next_id_;
+    }
+    return *this;
+}
+
+std::vector<Fp> Client::encrypt(const Secret& secret, const Nonce& nonce, std::span<const Fp> plaintext) {
+    uint32_t id = next_id_++;
+    return call(encode_cipher_request(id, Op::ENCRYPT, secret, nonce, plaintext), id);
+}
+
+std::vector<Fp> Client::decrypt(const Secret& secret, const Nonce& nonce, std::span<const Fp> ciphertext) {
+    uint32_t id = next_id_++;
+    return call(encode_cipher_request(id, Op::DECRYPT, secret, nonce, ciphertext), id);
+}
+
+std::vector<Fp> Client::hash(std::span<const Fp> message) {
+    uint32_t id = next_id_++;
+    return call(encode_hash_request(id, message), id);
+}
+
+std::vector<Fp> Client::call(const std::vector<uint8_t>& frame, uint32_t id) {
+    write_all(fd_, frame);
+
+    std::array<uint8_t, HEADER_SIZE> header_bytes{};
+    read_all(fd_, header_bytes);
+    FrameHeader header = decode_header(header_bytes);
+    if (header.length > MAX_ELEMENTS * Fp::BYTES) {
+        throw std::system_error(EPROTO, std::generic_category(), "rescue-served response too large");
+    }
+    std::vector<uint8_t> body(header.length);
+    read_all(fd_, body);
+
+    if (header.id != id) {
+        throw std::system_error(EPROTO, std::generic_category(), "rescue-served response id mismatch");
+    }
+    auto status = static_cast<Status>(header.code);
+    if (status != Status::OK) {
+        throw ServedError(status, std::string("rescue-served: ") + status_name(status));
+    }
+    return decode_elements(body);
+}
+
+}  // namespace rescue::served
@@ -0,0 +1,104 @@
+/**
+ * @file main.cpp
+ * @brief rescue-served: serve encrypt/decrypt/hash requests on a Unix socket.
+ *
+ * Usage:
+ *   rescue-served [--socket=<path>] [--workers=<n>] [--queue=<n>]
+ *                 [--batch=<n>] [--cache=<n>]
+ *
+ * Runs until SIGINT or SIGTERM, then prints the server counters.
+ */
+
+#include <rescue/served/server.hpp>
+
+#include <csignal>
+#include <cstdio>
+#include <iostream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+
+#include <pthread.h>
+
+using namespace rescue::served;
+
+namespace {
+
+void print_usage() {
+    std::cerr << "usage: rescue-served [--socket=<path>] [--workers=<n>] [--queue=<n>] [--batch=<n>] "
+                 "[--cache=<n>]\n";
+}
+
+ServerOptions parse_args(int argc, char** argv) {
+    ServerOptions opts;
+    opts.socket_path = "/tmp/rescue-served.sock";
+    opts.workers = std::max(1u, std::thread::hardware_concurrency() / 2);
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg(argv[i]);
+        auto value = [&](std::string_view flag) -> std::optional<std::string> {
+            if (arg.starts_with(flag)) {
+                return std::string(arg.substr(flag.size()));
+            }
+            return std::nullopt;
+        };
+        if (auto v = value("--socket=")) {
+            opts.socket_path = *v;
+        } else if (auto v = value("--workers=")) {
+            opts.workers = std::stoul(*v);
+        } else if (auto v = value("--queue=")) {
+            opts.queue_capacity = std::stoul(*v);
+        } else if (auto v = value("--batch=")) {
+            opts.max_batch = std::stoul(*v);
+        } else if (auto v = value("--cache=")) {
+            opts.cache_capacity = std::stoul(*v);
+        } else {
+            throw std::invalid_argument("unknown option " + std::string(arg));
+        }
+    }
+    return opts;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char** argv) {
+    ServerOptions opts;
+    try {
+        opts = parse_args(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << "rescue-served: " << e.what() << "\n";
+        print_usage();
+        return 2;
+    }
+
+    // Block the stop signals in every thread; main collects them with sigwait
+    sigset_t signals;
+    sigemptyset(&signals);
+    sigaddset(&signals, SIGINT);
+    sigaddset(&signals, SIGTERM);
+    pthread_sigmask(SIG_BLOCK, &signals, nullptr);
+
+    try {
+        Server server(opts);
+        std::printf("rescue-served listening on %s (%zu workers, queue %zu, batch %zu, cache %zu)\n",
+                    opts.socket_path.c_str(), opts.workers, opts.queue_capacity, opts.max_batch,
+                    opts.cache_capacity);
+        std::fflush(stdout);
+
+        int sig = 0;
+        sigwait(&signals, &sig);
+        server.stop();
+
+        ServerStats s = server.stats();
+        std::printf("requests %llu, jobs %llu in %llu batches, %llu blocks, cache %llu hits / %llu misses, "
+                    "%llu overloaded, %llu bad\n",
+                    static_cast<unsigned long long>(s.requests), static_cast<unsigned long long>(s.jobs),
+                    static_cast<unsigned long long>(s.batches), static_cast<unsigned long long>(s.blocks),
+                    static_cast<unsigned long long>(s.cache_hits), static_cast<unsigned long long>(s.cache_misses),
+                    static_cast<unsigned long long>(s.overloaded), static_cast<unsigned long long>(s.bad_requests));
+    } catch (const std::exception& e) {
+        std::cerr << "rescue-served: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}
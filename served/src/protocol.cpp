@@ -0,0 +1,100 @@
+#include <rescue/served/protocol.hpp>
+
+#include <stdexcept>
+#include <string>
+
+namespace rescue::served {
+
+namespace {
+
+void put_u32(uint8_t* out, uint32_t v) {
+    for (size_t i = 0; i < 4; ++i) {
+        out[i] = static_cast<uint8_t>(v >> (8 * i));
+    }
+}
+
+uint32_t get_u32(const uint8_t* in) {
+    uint32_t v = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        v |= static_cast<uint32_t>(in[i]) << (8 * i);
+    }
+    return v;
+}
+
+std::vector<uint8_t> start_frame(uint32_t id, uint8_t code, size_t body_size) {
+    std::vector<uint8_t> frame(HEADER_SIZE);
+    frame.reserve(HEADER_SIZE + body_size);
+    encode_header({static_cast<uint32_t>(body_size), id, code}, std::span<uint8_t, HEADER_SIZE>(frame));
+    return frame;
+}
+
+void check_element_count(size_t n) {
+    if (n > MAX_ELEMENTS) {
+        throw std::invalid_argument("Request exceeds " + std::to_string(MAX_ELEMENTS) + " elements");
+    }
+}
+
+}  // anonymous namespace
+
+void encode_header(const FrameHeader& header, std::span<uint8_t, HEADER_SIZE> out) {
+    put_u32(out.data(), header.length);
+    put_u32(out.data() + 4, header.id);
+    out[8] = header.code;
+    out[9] = out[10] = out[11] = 0;
+}
+
+FrameHeader decode_header(std::span<const uint8_t, HEADER_SIZE> in) {
+    return {get_u32(in.data()), get_u32(in.data() + 4), in[8]};
+}
+
+void append_elements(std::vector<uint8_t>& out, std::span<const Fp> elements) {
+    for (const auto& x : elements) {
+        auto bytes = x.to_bytes();
+        out.insert(out.end(), bytes.begin(), bytes.end());
+    }
+}
+
+std::vector<Fp> decode_elements(std::span<const uint8_t> bytes) {
+    if (bytes.size() % Fp::BYTES != 0) {
+        throw std::invalid_argument("Element data must be a multiple of " + std::to_string(Fp::BYTES) + " bytes");
+    }
+    check_element_count(bytes.size() / Fp::BYTES);
+
+    std::vector<Fp> out;
+    out.reserve(bytes.size() / Fp::BYTES);
+    for (size_t i = 0; i < bytes.size(); i += Fp::BYTES) {
+        out.emplace_back(bytes.subspan(i, Fp::BYTES));
+    }
+    return out;
+}
+
+std::vector<uint8_t> encode_cipher_request(uint32_t id, Op op, const Secret& secret, const Nonce& nonce,
+                                           std::span<const Fp> elements) {
+    if (op != Op::ENCRYPT && op != Op::DECRYPT) {
+        throw std::invalid_argument("Cipher requests must be ENCRYPT or DECRYPT");
+    }
+    check_element_count(elements.size());
+    auto frame = start_frame(id, static_cast<uint8_t>(op), CIPHER_PREFIX_SIZE + elements.size() * Fp::BYTES);
+    frame.insert(frame.end(), secret.begin(), secret.end());
+    frame.insert(frame.end(), nonce.begin(), nonce.end());
+    append_elements(frame, elements);
+    return frame;
+}
+
+std::vector<uint8_t> encode_hash_request(uint32_t id, std::span<const Fp> message) {
+    check_element_count(message.size());
+    auto frame = start_frame(id, static_cast<uint8_t>(Op::HASH), message.size() * Fp::BYTES);
+    append_elements(frame, message);
+    return frame;
+}
+
+std::vector<uint8_t> encode_response(uint32_t id, Status status, std::span<const Fp> elements) {
+    if (status != Status::OK) {
+        elements = {};
+    }
+    auto frame = start_frame(id, static_cast<uint8_t>(status), elements.size() * Fp::BYTES);
+    append_elements(frame, elements);
+    return frame;
+}
+
+}  // namespace rescue::served
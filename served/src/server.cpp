@@ -0,0 +1,477 @@
+#include <rescue/served/server.hpp>
+
+#include <rescue/served/submission_queue.hpp>
+
+#include <rescue/rescue_hash.hpp>
+#include <rescue/utils.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <list>
+#include <mutex>
+#include <stdexcept>
+#include <system_error>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+namespace rescue::served {
+
+namespace {
+
+// ============================================================================
+// Socket helpers
+// ============================================================================
+
+/// Read exactly out.size() bytes. False on EOF or error.
+bool read_full(int fd, std::span<uint8_t> out) {
+    size_t done = 0;
+    while (done < out.size()) {
+        ssize_t n = ::read(fd, out.data() + done, out.size() - done);
+        if (n > 0) {
+            done += static_cast<size_t>(n);
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+/// Write all bytes; MSG_NOSIGNAL so a vanished client cannot raise SIGPIPE.
+bool write_full(int fd, std::span<const uint8_t> data) {
+    size_t done = 0;
+    while (done < data.size()) {
+        ssize_t n = ::send(fd, data.data() + done, data.size() - done, MSG_NOSIGNAL);
+        if (n > 0) {
+            done += static_cast<size_t>(n);
+        } else if (n < 0 && errno == EINTR) {
+            continue;
+        } else {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief A client connection, shared by its reader and any worker answering it.
+ *
+ * The last owner closes the descriptor, so a worker can never write to a
+ * recycled fd after the reader has gone.
+ */
+struct Connection {
+    explicit Connection(int socket_fd) : fd(socket_fd) {}
+    ~Connection() { ::close(fd); }
+
+    Connection(const Connection&) = delete;
+    Connection& operator=(const Connection&) = delete;
+
+    void send(std::span<const uint8_t> frame) {
+        std::lock_guard lock(write_mutex);
+        (void)write_full(fd, frame);  // A failed write means the client left
+    }
+
+    const int fd;
+    std::mutex write_mutex;
+};
+
+struct Job {
+    std::shared_ptr<Connection> connection;
+    uint32_t id = 0;
+    Op op = Op::HASH;
+    Secret secret{};
+    Nonce nonce{};
+    std::vector<Fp> elements;
+};
+
+// ============================================================================
+// Cipher cache
+// ============================================================================
+
+struct SecretHash {
+    size_t operator()(const Secret& s) const noexcept {
+        uint64_t h = 0xcbf29ce484222325ULL;  // FNV-1a
+        for (uint8_t b : s) {
+            h = (h ^ b) * 0x100000001b3ULL;
+        }
+        return h;
+    }
+};
+
+/**
+ * @brief LRU map from shared secret to expanded cipher.
+ *
+ * Construction happens outside the lock; two workers missing on the same
+ * key at once both build it and the second insert is discarded.
+ */
+class CipherCache {
+public:
+    explicit CipherCache(size_t capacity) : capacity_(capacity) {}
+
+    std::shared_ptr<const RescueCipher> get(const Secret& secret, bool& hit) {
+        {
+            std::lock_guard lock(mutex_);
+            auto it = index_.find(secret);
+            if (it != index_.end()) {
+                lru_.splice(lru_.begin(), lru_, it->second);
+                hit = true;
+                return it->second->second;
+            }
+        }
+
+        hit = false;
+        auto cipher = std::make_shared<const RescueCipher>(secret);
+
+        std::lock_guard lock(mutex_);
+        auto it = index_.find(secret);
+        if (it != index_.end()) {
+            return it->second->second;
+        }
+        lru_.emplace_front(secret, cipher);
+        index_.emplace(secret, lru_.begin());
+        if (lru_.size() > capacity_) {
+            index_.erase(lru_.back().first);
+            lru_.pop_back();  // In-flight users keep their shared_ptr
+        }
+        return cipher;
+    }
+
+private:
+    using Entry = std::pair<Secret, std::shared_ptr<const RescueCipher>>;
+
+    const size_t capacity_;
+    std::mutex mutex_;
+    std::list<Entry> lru_;
+    std::unordered_map<Secret, std::list<Entry>::iterator, SecretHash> index_;
+};
+
+struct ReaderThread {
+    std::shared_ptr<Connection> connection;
+    std::thread thread;
+    std::atomic<bool> done{false};
+};
+
+}  // anonymous namespace
+
+// ============================================================================
+// Server
+// ============================================================================
+
+struct Server::Impl {
+    explicit Impl(ServerOptions opts)
+        : options(std::move(opts)), queue(options.queue_capacity), cache(options.cache_capacity) {}
+
+    ServerOptions options;
+    int listen_fd = -1;
+    std::atomic<bool> stopping{false};
+
+    SubmissionQueue<std::unique_ptr<Job>> queue;
+    std::atomic<uint32_t> wake{0};  // Bumped on every push; workers wait on it
+
+    CipherCache cache;
+    RescuePrimeHash hasher;
+
+    std::thread acceptor;
+    std::vector<std::thread> workers;
+    std::mutex readers_mutex;
+    std::list<ReaderThread> readers;
+
+    std::atomic<uint64_t> requests{0}, batches{0}, jobs{0}, blocks{0};
+    std::atomic<uint64_t> cache_hits{0}, cache_misses{0}, overloaded{0}, bad_requests{0};
+
+    void accept_loop();
+    void read_loop(ReaderThread& reader);
+    void worker_loop();
+    void process(std::vector<std::unique_ptr<Job>>& batch, std::vector<RescueCipher::Block>& counters);
+    void reap_readers();
+};
+
+void Server::Impl::accept_loop() {
+    while (!stopping.load()) {
+        int fd = ::accept(listen_fd, nullptr, nullptr);
+        if (fd < 0) {
+            if (errno == EINTR || errno == ECONNABORTED) {
+                continue;
+            }
+            return;  // stop() shut the socket down
+        }
+
+        std::lock_guard lock(readers_mutex);
+        reap_readers();
+        if (stopping.load()) {
+            ::close(fd);
+            return;
+        }
+        auto& reader = readers.emplace_back();
+        reader.connection = std::make_shared<Connection>(fd);
+        reader.thread = std::thread([this, &reader] { read_loop(reader); });
+    }
+}
+
+void Server::Impl::reap_readers() {
+    for (auto it = readers.begin(); it != readers.end();) {
+        if (it->done.load()) {
+            it->thread.join();
+            it = readers.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
+void Server::Impl::read_loop(ReaderThread& reader) {
+    const auto& connection = reader.connection;
+    constexpr size_t MAX_BODY = CIPHER_PREFIX_SIZE + MAX_ELEMENTS * Fp::BYTES;
+    std::array<uint8_t, HEADER_SIZE> header_bytes{};
+    std::vector<uint8_t> body;
+
+    while (read_full(connection->fd, header_bytes)) {
+        FrameHeader header = decode_header(header_bytes);
+        requests.fetch_add(1, std::memory_order_relaxed);
+        if (header.length > MAX_BODY) {
+            bad_requests.fetch_add(1, std::memory_order_relaxed);
+            break;  // Cannot resynchronize without reading it; drop the client
+        }
+        body.resize(header.length);
+        if (!read_full(connection->fd, body)) {
+            break;
+        }
+
+        auto job = std::make_unique<Job>();
+        job->connection = connection;
+        job->id = header.id;
+        job->op = static_cast<Op>(header.code);
+        try {
+            std::span<const uint8_t> elements(body);
+            if (job->op == Op::ENCRYPT || job->op == Op::DECRYPT) {
+                if (body.size() < CIPHER_PREFIX_SIZE) {
+                    throw std::invalid_argument("Cipher request too short");
+                }
+                std::copy_n(body.begin(), job->secret.size(), job->secret.begin());
+                std::copy_n(body.begin() + RESCUE_CIPHER_SECRET_SIZE, job->nonce.size(), job->nonce.begin());
+                elements = elements.subspan(CIPHER_PREFIX_SIZE);
+            } else if (job->op != Op::HASH) {
+                throw std::invalid_argument("Unknown op");
+            }
+            job->elements = decode_elements(elements);
+        } catch (const std::invalid_argument&) {
+            bad_requests.fetch_add(1, std::memory_order_relaxed);
+            connection->send(encode_response(header.id, Status::BAD_REQUEST, {}));
+            continue;
+        }
+
+        if (!queue.try_push(job)) {
+            overloaded.fetch_add(1, std::memory_order_relaxed);
+            connection->send(encode_response(header.id, Status::OVERLOADED, {}));
+            continue;
+        }
+        wake.fetch_add(1, std::memory_order_release);
+        wake.notify_one();
+    }
+    // Workers may still hold the connection; make sure the client sees EOF now
+    ::shutdown(connection->fd, SHUT_RDWR);
+    reader.done.store(true);
+}
+
+void Server::Impl::worker_loop() {
+    std::vector<std::unique_ptr<Job>> batch;
+    std::vector<RescueCipher::Block> counters;  // Reused across batches
+    batch.reserve(options.max_batch);
+
+    while (!stopping.load()) {
+        // Read the wake counter before polling so a push between an empty
+        // poll and the wait cannot be missed
+        uint32_t seen = wake.load(std::memory_order_acquire);
+        std::unique_ptr<Job> job;
+        while (batch.size() < options.max_batch && queue.try_pop(job)) {
+            batch.push_back(std::move(job));
+        }
+        if (batch.empty()) {
+            if (stopping.load()) {
+                break;
+            }
+            wake.wait(seen, std::memory_order_acquire);
+            continue;
+        }
+
+        batches.fetch_add(1, std::memory_order_relaxed);
+        jobs.fetch_add(batch.size(), std::memory_order_relaxed);
+        process(batch, counters);
+        batch.clear();
+    }
+}
+
+void Server::Impl::process(std::vector<std::unique_ptr<Job>>& batch, std::vector<RescueCipher::Block>& counters) {
+    constexpr size_t M = RESCUE_CIPHER_BLOCK_SIZE;
+
+    // Every hash job of the batch absorbs in lockstep through one sponge
+    std::vector<Job*> hash_jobs;
+    std::vector<std::vector<Fp>> messages;
+    // Resolve ciphers, then order cipher jobs by key so each key's counter
+    // blocks go through one encrypt_blocks() call
+    std::vector<std::pair<std::shared_ptr<const RescueCipher>, Job*>> cipher_jobs;
+    for (auto& job : batch) {
+        if (job->op == Op::HASH) {
+            hash_jobs.push_back(job.get());
+            messages.push_back(std::move(job->elements));
+            continue;
+        }
+        try {
+            bool hit = false;
+            auto cipher = cache.get(job->secret, hit);
+            (hit ? cache_hits : cache_misses).fetch_add(1, std::memory_order_relaxed);
+            cipher_jobs.emplace_back(std::move(cipher), job.get());
+        } catch (const std::exception&) {
+            job->connection->send(encode_response(job->id, Status::INTERNAL_ERROR, {}));
+        }
+    }
+
+    if (!hash_jobs.empty()) {
+        std::vector<std::vector<Fp>> digests;
+        bool ok = true;
+        try {
+            digests = hasher.digest_batch(messages);
+        } catch (const std::exception&) {
+            ok = false;
+        }
+        for (size_t i = 0; i < hash_jobs.size(); ++i) {
+            const Job& job = *hash_jobs[i];
+            job.connection->send(ok ? encode_response(job.id, Status::OK, digests[i])
+                                    : encode_response(job.id, Status::INTERNAL_ERROR, {}));
+        }
+    }
+
+    std::stable_sort(cipher_jobs.begin(), cipher_jobs.end(),
+                     [](const auto& a, const auto& b) { return a.first < b.first; });
+
+    for (size_t group = 0; group < cipher_jobs.size();) {
+        size_t end = group;
+        while (end < cipher_jobs.size() && cipher_jobs[end].first == cipher_jobs[group].first) {
+            ++end;
+        }
+
+        // CTR counters [nonce, block_index, 0, ...], as in encrypt_raw()
+        bool ok = true;
+        try {
+            counters.clear();
+            for (size_t i = group; i < end; ++i) {
+                const Job& job = *cipher_jobs[i].second;
+                Fp nonce(deserialize_le(job.nonce));
+                size_t n_blocks = (job.elements.size() + M - 1) / M;
+                for (size_t b = 0; b < n_blocks; ++b) {
+                    RescueCipher::Block counter{};
+                    counter[0] = nonce;
+                    counter[1] = Fp(uint64_t{b});
+                    counters.push_back(counter);
+                }
+            }
+            cipher_jobs[group].first->encrypt_blocks(counters, counters);
+            blocks.fetch_add(counters.size(), std::memory_order_relaxed);
+        } catch (const std::exception&) {
+            ok = false;
+        }
+
+        size_t next_block = 0;
+        for (size_t i = group; i < end; ++i) {
+            Job& job = *cipher_jobs[i].second;
+            if (!ok) {
+                job.connection->send(encode_response(job.id, Status::INTERNAL_ERROR, {}));
+                continue;
+            }
+            for (size_t e = 0; e < job.elements.size(); ++e) {
+                const Fp& key_stream = counters[next_block + e / M][e % M];
+                job.elements[e] = job.op == Op::ENCRYPT ? job.elements[e] + key_stream : job.elements[e] - key_stream;
+            }
+            next_block += (job.elements.size() + M - 1) / M;
+            job.connection->send(encode_response(job.id, Status::OK, job.elements));
+        }
+        group = end;
+    }
+}
+
+Server::Server(ServerOptions options) : impl_(std::make_unique<Impl>(std::move(options))) {
+    auto& o = impl_->options;
+    sockaddr_un addr{};
+    if (o.socket_path.empty() || o.socket_path.size() >= sizeof(addr.sun_path)) {
+        throw std::invalid_argument("Socket path must be 1 to " + std::to_string(sizeof(addr.sun_path) - 1) +
+                                    " bytes");
+    }
+    if (o.workers == 0 || o.max_batch == 0 || o.cache_capacity == 0) {
+        throw std::invalid_argument("workers, max_batch and cache_capacity must be positive");
+    }
+
+    addr.sun_family = AF_UNIX;
+    std::memcpy(addr.sun_path, o.socket_path.c_str(), o.socket_path.size() + 1);
+    ::unlink(o.socket_path.c_str());
+
+    impl_->listen_fd = ::socket(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0);
+    if (impl_->listen_fd < 0) {
+        throw std::system_error(errno, std::generic_category(), "socket");
+    }
+    if (::bind(impl_->listen_fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)) != 0 ||
+        ::listen(impl_->listen_fd, SOMAXCONN) != 0) {
+        int err = errno;
+        ::close(impl_->listen_fd);
+        throw std::system_error(err, std::generic_category(), "bind " + o.socket_path);
+    }
+
+    for (size_t i = 0; i < o.workers; ++i) {
+        impl_->workers.emplace_back([impl = impl_.get()] { impl->worker_loop(); });
+    }
+    impl_->acceptor = std::thread([impl = impl_.get()] { impl->accept_loop(); });
+}
+
+Server::~Server() {
+    stop();
+}
+
+void Server::stop() {
+    if (impl_->stopping.exchange(true)) {
+        return;
+    }
+
+    // Wake accept() and every blocked read()
+    ::shutdown(impl_->listen_fd, SHUT_RDWR);
+    impl_->acceptor.join();
+    {
+        std::lock_guard lock(impl_->readers_mutex);
+        for (auto& reader : impl_->readers) {
+            ::shutdown(reader.connection->fd, SHUT_RDWR);
+        }
+    }
+    for (auto& reader : impl_->readers) {
+        reader.thread.join();
+    }
+    impl_->readers.clear();
+
+    impl_->wake.fetch_add(1);
+    impl_->wake.notify_all();
+    for (auto& worker : impl_->workers) {
+        worker.join();
+    }
+
+    std::unique_ptr<Job> job;
+    while (impl_->queue.try_pop(job)) {
+    }
+    ::close(impl_->listen_fd);
+    ::unlink(impl_->options.socket_path.c_str());
+}
+
+ServerStats Server::stats() const {
+    const Impl& i = *impl_;
+    return {i.requests.load(),   i.batches.load(),      i.jobs.load(),       i.blocks.load(),
+            i.cache_hits.load(), i.cache_misses.load(), i.overloaded.load(), i.bad_requests.load()};
+}
+
+const ServerOptions& Server::options() const {
+    return impl_->options;
+}
+
+}  // namespace rescue::served
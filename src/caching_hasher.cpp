@@ -0,0 +1,115 @@
+#include <rescue/caching_hasher.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace rescue {
+
+namespace {
+
+constexpr uint64_t MIX_MULTIPLIER = 0x9E3779B97F4A7C15ULL;
+
+/// Final avalanche (the splitmix64 finalizer)
+constexpr uint64_t avalanche(uint64_t h) {
+    h ^= h >> 30;
+    h *= 0xBF58476D1CE4E5B9ULL;
+    h ^= h >> 27;
+    h *= 0x94D049BB133111EBULL;
+    h ^= h >> 31;
+    return h;
+}
+
+}  // anonymous namespace
+
+// ============================================================================
+// CachingHasher
+// ============================================================================
+
+CachingHasher::CachingHasher(size_t capacity, size_t shards) : CachingHasher(RescuePrimeHash(), capacity, shards) {}
+
+CachingHasher::CachingHasher(RescuePrimeHash hasher, size_t capacity, size_t shards)
+    : hasher_(std::move(hasher)), capacity_(capacity) {
+    if (capacity == 0) {
+        throw std::invalid_argument("Cache capacity must be positive");
+    }
+    if (shards == 0) {
+        throw std::invalid_argument("Shard count must be positive");
+    }
+    n_shards_ = std::min(shards, capacity);
+    // Rounded down, so the total never exceeds the requested capacity
+    shard_capacity_ = capacity / n_shards_;
+    shards_ = std::make_unique<Shard[]>(n_shards_);
+}
+
+CachingHasher::~CachingHasher() = default;
+
+uint64_t CachingHasher::fingerprint(std::span<const Fp> message) {
+    uint64_t h = message.size() * MIX_MULTIPLIER;
+    for (const Fp& x : message) {
+        const uint256& v = x.value();
+        for (size_t i = 0; i < uint256::LIMBS; ++i) {
+            h = (h ^ v.limb(i)) * MIX_MULTIPLIER;
+            h ^= h >> 32;
+        }
+    }
+    return avalanche(h);
+}
+
+std::vector<Fp> CachingHasher::digest(std::span<const Fp> message) const {
+    const uint64_t key = fingerprint(message);
+    Shard& shard = shards_[avalanche(key ^ MIX_MULTIPLIER) % n_shards_];
+
+    {
+        std::lock_guard lock(shard.mutex);
+        auto it = shard.index.find(key);
+        if (it != shard.index.end() && std::ranges::equal(it->second->message, message)) {
+            shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+            hits_.fetch_add(1, std::memory_order_relaxed);
+            return it->second->digest;
+        }
+    }
+
+    misses_.fetch_add(1, std::memory_order_relaxed);
+    std::vector<Fp> digest = hasher_.digest(std::vector<Fp>(message.begin(), message.end()));
+
+    std::lock_guard lock(shard.mutex);
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) {
+        // Another thread inserted this key meanwhile, or a different message
+        // with the same fingerprint is cached: keep the latest
+        shard.lru.erase(it->second);
+        shard.index.erase(it);
+    } else if (shard.lru.size() >= shard_capacity_) {
+        shard.index.erase(shard.lru.back().fingerprint);
+        shard.lru.pop_back();
+        evictions_.fetch_add(1, std::memory_order_relaxed);
+    }
+    shard.lru.push_front(Entry{key, std::vector<Fp>(message.begin(), message.end()), digest});
+    shard.index.emplace(key, shard.lru.begin());
+    return digest;
+}
+
+CacheStats CachingHasher::stats() const {
+    CacheStats s;
+    s.hits = hits_.load(std::memory_order_relaxed);
+    s.misses = misses_.load(std::memory_order_relaxed);
+    s.evictions = evictions_.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < n_shards_; ++i) {
+        std::lock_guard lock(shards_[i].mutex);
+        s.entries += shards_[i].lru.size();
+    }
+    return s;
+}
+
+void CachingHasher::clear() {
+    for (size_t i = 0; i < n_shards_; ++i) {
+        std::lock_guard lock(shards_[i].mutex);
+        shards_[i].lru.clear();
+        shards_[i].index.clear();
+    }
+    hits_.store(0, std::memory_order_relaxed);
+    misses_.store(0, std::memory_order_relaxed);
+    evictions_.store(0, std::memory_order_relaxed);
+}
+
+}  // namespace rescue
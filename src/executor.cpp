@@ -0,0 +1,284 @@
+#include <rescue/executor.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <mutex>
+#include <optional>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace rescue {
+
+// ============================================================================
+// SequentialExecutor
+// ============================================================================
+
+void SequentialExecutor::parallel_for(size_t n, const Task& task) {
+    for (size_t i = 0; i < n; ++i) {
+        task(i);
+    }
+}
+
+// ============================================================================
+// WorkStealingExecutor
+// ============================================================================
+
+/**
+ * @brief One parallel_for call; lives on the caller's stack until every index has run.
+ */
+struct WorkStealingExecutor::Job {
+    const Task* task = nullptr;
+
+    /// Ranges no longer than this are run rather than split
+    size_t grain = 1;
+
+    /// Indices not yet run (or skipped after a failure)
+    std::atomic<size_t> remaining{0};
+
+    std::atomic<bool> failed{false};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+};
+
+struct WorkStealingExecutor::Range {
+    Job* job = nullptr;
+    size_t begin = 0;
+    size_t end = 0;
+};
+
+/**
+ * @brief A worker's deque: the owner pushes and pops at the back, thieves take from the front.
+ */
+struct WorkStealingExecutor::Worker {
+    std::mutex mutex;
+    std::deque<Range> ranges;
+};
+
+struct WorkStealingExecutor::Shared {
+    explicit Shared(size_t n_workers) : workers(n_workers) {}
+
+    std::vector<Worker> workers;
+
+    /// Ranges pushed by threads outside the pool
+    Worker injected;
+
+    // Sleeping threads wait for epoch to change; it changes whenever a range
+    // is pushed, a job finishes or the pool stops
+    std::mutex sleep_mutex;
+    std::condition_variable wake;
+    std::atomic<uint64_t> epoch{0};
+    bool stopping = false;
+
+    void notify() {
+        {
+            std::lock_guard lock(sleep_mutex);
+            epoch.fetch_add(1, std::memory_order_release);
+        }
+        wake.notify_all();
+    }
+
+    static std::optional<Range> pop_back(Worker& w) {
+        std::lock_guard lock(w.mutex);
+        if (w.ranges.empty()) {
+            return std::nullopt;
+        }
+        Range r = w.ranges.back();
+        w.ranges.pop_back();
+        return r;
+    }
+
+    static std::optional<Range> pop_front(Worker& w) {
+        std::lock_guard lock(w.mutex);
+        if (w.ranges.empty()) {
+            return std::nullopt;
+        }
+        Range r = w.ranges.front();
+        w.ranges.pop_front();
+        return r;
+    }
+
+    /// Own deque first (newest, cache-warm work), then injected work, then steal
+    std::optional<Range> find_work(Worker* self, size_t self_index) {
+        if (self != nullptr) {
+            if (auto r = pop_back(*self)) {
+                return r;
+            }
+        }
+        if (auto r = pop_front(injected)) {
+            return r;
+        }
+        const size_t n = workers.size();
+        for (size_t k = 1; k <= n; ++k) {
+            Worker& victim = workers[(self_index + k) % n];
+            if (&victim == self) {
+                continue;
+            }
+            if (auto r = pop_front(victim)) {
+                return r;
+            }
+        }
+        return std::nullopt;
+    }
+
+    /// Split off upper halves onto the current thread's deque, then run the rest
+    void run(Range r, Worker* self) {
+        Job& job = *r.job;
+        bool pushed = false;
+        while (r.end - r.begin > job.grain) {
+            const size_t mid = r.begin + (r.end - r.begin) / 2;
+            Worker& target = self != nullptr ? *self : injected;
+            {
+                std::lock_guard lock(target.mutex);
+                target.ranges.push_back(Range{&job, mid, r.end});
+            }
+            r.end = mid;
+            pushed = true;
+        }
+        if (pushed) {
+            notify();
+        }
+
+        for (size_t i = r.begin; i < r.end; ++i) {
+            if (job.failed.load(std::memory_order_relaxed)) {
+                break;
+            }
+            try {
+                (*job.task)(i);
+            } catch (...) {
+                std::lock_guard lock(job.error_mutex);
+                if (!job.error) {
+                    job.error = std::current_exception();
+                }
+                job.failed.store(true, std::memory_order_relaxed);
+            }
+        }
+
+        // The job may be destroyed as soon as remaining reaches zero
+        const size_t count = r.end - r.begin;
+        if (job.remaining.fetch_sub(count, std::memory_order_acq_rel) == count) {
+            notify();
+        }
+    }
+};
+
+namespace {
+
+// The pool and worker the current thread belongs to, if any
+thread_local const void* tls_pool = nullptr;
+thread_local void* tls_worker = nullptr;
+thread_local size_t tls_worker_index = 0;
+
+void pin_to_cpu([[maybe_unused]] std::thread& thread, [[maybe_unused]] size_t index) {
+#if defined(__linux__)
+    const unsigned cpus = std::max(1u, std::thread::hardware_concurrency());
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(index % cpus, &set);
+    // Best effort: a restricted affinity mask or cgroup may refuse the CPU
+    (void)pthread_setaffinity_np(thread.native_handle(), sizeof(set), &set);
+#endif
+}
+
+}  // anonymous namespace
+
+WorkStealingExecutor::WorkStealingExecutor(Options options) {
+    size_t n = options.threads;
+    if (n == 0) {
+        n = std::max(1u, std::thread::hardware_concurrency());
+    }
+    shared_ = std::make_unique<Shared>(n);
+
+    threads_.reserve(n);
+    for (size_t i = 0; i < n; ++i) {
+        threads_.emplace_back([shared = shared_.get(), i] {
+            Worker* self = &shared->workers[i];
+            tls_pool = shared;
+            tls_worker = self;
+            tls_worker_index = i;
+            while (true) {
+                const uint64_t seen = shared->epoch.load(std::memory_order_acquire);
+                if (auto r = shared->find_work(self, i)) {
+                    shared->run(*r, self);
+                    continue;
+                }
+                std::unique_lock lock(shared->sleep_mutex);
+                if (shared->stopping) {
+                    return;
+                }
+                shared->wake.wait(lock, [&] {
+                    return shared->stopping || shared->epoch.load(std::memory_order_acquire) != seen;
+                });
+            }
+        });
+        if (options.pin_threads) {
+            pin_to_cpu(threads_.back(), i);
+        }
+    }
+}
+
+WorkStealingExecutor::~WorkStealingExecutor() {
+    {
+        std::lock_guard lock(shared_->sleep_mutex);
+        shared_->stopping = true;
+    }
+    shared_->wake.notify_all();
+    for (auto& t : threads_) {
+        t.join();
+    }
+}
+
+size_t WorkStealingExecutor::concurrency() const noexcept {
+    return threads_.size();
+}
+
+void WorkStealingExecutor::parallel_for(size_t n, const Task& task) {
+    if (n == 0) {
+        return;
+    }
+
+    Shared& shared = *shared_;
+    const bool on_worker = tls_pool == &shared;
+    Worker* self = on_worker ? static_cast<Worker*>(tls_worker) : nullptr;
+    const size_t self_index = on_worker ? tls_worker_index : 0;
+
+    Job job;
+    job.task = &task;
+    // About eight pieces per thread: enough to balance uneven tasks without
+    // paying a deque operation for every index
+    job.grain = std::max<size_t>(1, n / (8 * (threads_.size() + 1)));
+    job.remaining.store(n, std::memory_order_relaxed);
+
+    // Run the range here; the halves it splits off are what others steal.
+    // Then help with whatever work is queued until this job is done, which
+    // keeps nested calls from blocking a worker while work waits.
+    shared.run(Range{&job, 0, n}, self);
+    while (job.remaining.load(std::memory_order_acquire) != 0) {
+        const uint64_t seen = shared.epoch.load(std::memory_order_acquire);
+        if (auto r = shared.find_work(self, self_index)) {
+            shared.run(*r, self);
+            continue;
+        }
+        std::unique_lock lock(shared.sleep_mutex);
+        shared.wake.wait(lock, [&] {
+            return job.remaining.load(std::memory_order_acquire) == 0 ||
+                   shared.epoch.load(std::memory_order_acquire) != seen;
+        });
+    }
+
+    if (job.error) {
+        std::rethrow_exception(job.error);
+    }
+}
+
+Executor& default_executor() {
+    static WorkStealingExecutor instance;
+    return instance;
+}
+
+}  // namespace rescue
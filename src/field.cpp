@@ -3,6 +3,7 @@
 #include <random>
 #include <sstream>
 #include <stdexcept>
+#include <tuple>
 
 // For OpenSSL random bytes
 #include <openssl/rand.h>
@@ -72,24 +73,6 @@ Fp Fp::create(const uint256& value) {
     return Fp(value);
 }
 
-Fp Fp::add(const Fp& rhs) const {
-    return Fp(fp::add(value_, rhs.value_));
-}
-
-Fp Fp::sub(const Fp& rhs) const {
-    return Fp(fp::sub(value_, rhs.value_));
-}
-
-Fp Fp::mul(const Fp& rhs) const {
-    return Fp(fp::mul(value_, rhs.value_));
-}
-
-Fp Fp::neg() const {
-    // fp::neg already handles zero correctly via constant-time mask
-    // No branch needed here
-    return Fp(fp::neg(value_));
-}
-
 Fp Fp::inv() const {
     if (is_zero()) {
         throw std::domain_error("Cannot invert zero in field");
@@ -105,26 +88,6 @@ Fp Fp::pow(uint64_t exp) const {
     return Fp(fp::pow(value_, exp));
 }
 
-Fp Fp::square() const {
-    return Fp(fp::sqr(value_));
-}
-
-bool Fp::is_zero() const {
-    return value_.is_zero();
-}
-
-bool Fp::is_one() const {
-    return value_.is_one();
-}
-
-bool Fp::operator==(const Fp& rhs) const {
-    return value_ == rhs.value_;
-}
-
-std::strong_ordering Fp::operator<=>(const Fp& rhs) const {
-    return value_ <=> rhs.value_;
-}
-
 std::array<uint8_t, Fp::BYTES> Fp::to_bytes() const {
     return value_.to_bytes_le();
 }
@@ -149,6 +112,25 @@ std::ostream& operator<<(std::ostream& os, const Fp& fp) {
     return os << fp.to_string();
 }
 
+// These members used to be defined in this file. Taking their addresses in a
+// retained table emits an out-of-line copy of each under the same mangled
+// name, so objects compiled against the old header still link.
+namespace {
+
+[[gnu::used]] constexpr std::tuple INLINE_FP_MEMBERS = {
+    &Fp::add,
+    &Fp::sub,
+    &Fp::mul,
+    &Fp::neg,
+    &Fp::square,
+    &Fp::is_zero,
+    &Fp::is_one,
+    &Fp::operator==,
+    &Fp::operator<=>,
+};
+
+}  // anonymous namespace
+
 uint256 mod_inverse(const uint256& a, const uint256& /*m*/) {
     // We always use the optimized inversion for p = 2^255 - 19
     return fp::inv(a);
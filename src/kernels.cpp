@@ -0,0 +1,325 @@
+#include "kernels.hpp"
+
+#include "rescue_generic.hpp"
+
+#include <array>
+#include <atomic>
+#include <cstdlib>
+#include <optional>
+#include <stdexcept>
+#include <string_view>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#include <cpuid.h>
+#define RESCUE_KERNELS_X86 1
+#else
+#define RESCUE_KERNELS_X86 0
+#endif
+
+namespace rescue {
+
+namespace kernels {
+
+namespace {
+
+// ============================================================================
+// Kernel bodies
+// ============================================================================
+
+// The bodies are instantiated once per variant below. Each variant function
+// is flattened, so the body and the fp kernels it calls are inlined into it
+// and compiled for that variant's target; nothing built for a newer
+// instruction set is emitted out of line where the baseline could call it.
+
+inline void sbox_body(std::span<Fp> state, const uint256& exp) {
+    // The 2-squaring chain when exp = 5
+    if (exp == uint256{5}) {
+        for (auto& x : state) {
+            x = Fp::from_reduced(fp::pow5(x.value()));
+        }
+    } else {
+        for (auto& x : state) {
+            x = Fp::from_reduced(fp::pow(x.value(), exp));
+        }
+    }
+}
+
+inline void mds_body(const Matrix& mat, std::span<const Fp> in, std::span<Fp> out) {
+    detail::mat_vec<Fp>(mat.data().data(), in, out);
+}
+
+inline void permute_body(const Rounds& rounds, std::span<Fp> states, std::span<Fp> tmp) {
+    detail::permute_rounds<Fp>(
+        rounds.m, rounds.round_keys.size(), [&](size_t r) { return rounds.round_keys[r].data().data(); },
+        rounds.mds.data().data(),
+        [&](std::span<Fp> s, size_t r) { sbox_body(s, r % 2 == 0 ? rounds.exp_even : rounds.exp_odd); }, states,
+        tmp);
+}
+
+// ============================================================================
+// Variants
+// ============================================================================
+
+struct VariantTable {
+    PermuteFn permute;
+    SboxFn sbox;
+    MdsFn mds;
+};
+
+#if defined(__GNUC__) || defined(__clang__)
+#define RESCUE_KERNEL_FLATTEN [[gnu::flatten]]
+#else
+#define RESCUE_KERNEL_FLATTEN
+#endif
+
+// Defines the three kernels of one variant with the given attributes
+#define RESCUE_KERNEL_VARIANT(suffix, ...)                                                           \
+    __VA_ARGS__ void permute_##suffix(const Rounds& rounds, std::span<Fp> states, std::span<Fp> tmp) { \
+        permute_body(rounds, states, tmp);                                                           \
+    }                                                                                                \
+    __VA_ARGS__ void sbox_##suffix(std::span<Fp> state, const uint256& exp) { sbox_body(state, exp); } \
+    __VA_ARGS__ void mds_##suffix(const Matrix& mat, std::span<const Fp> in, std::span<Fp> out) {      \
+        mds_body(mat, in, out);                                                                      \
+    }                                                                                                \
+    constexpr VariantTable VARIANT_##suffix = {permute_##suffix, sbox_##suffix, mds_##suffix};
+
+RESCUE_KERNEL_VARIANT(portable, RESCUE_KERNEL_FLATTEN)
+#if RESCUE_KERNELS_X86
+RESCUE_KERNEL_VARIANT(bmi2, [[gnu::flatten, gnu::target("bmi2,adx")]])
+#endif
+
+#undef RESCUE_KERNEL_VARIANT
+#undef RESCUE_KERNEL_FLATTEN
+
+// Indexed by KernelVariant; variants not compiled in are null
+constexpr std::array<const VariantTable*, KERNEL_VARIANT_COUNT> VARIANTS = {
+    &VARIANT_portable,
+#if RESCUE_KERNELS_X86
+    &VARIANT_bmi2,
+#else
+    nullptr,
+#endif
+};
+
+}  // anonymous namespace
+
+}  // namespace kernels
+
+// ============================================================================
+// Registry
+// ============================================================================
+
+namespace {
+
+constexpr std::array<const char*, KERNEL_COUNT> KERNEL_NAMES = {"permutation", "sbox", "mds"};
+constexpr std::array<const char*, KERNEL_VARIANT_COUNT> VARIANT_NAMES = {"portable", "bmi2"};
+
+using Binding = std::array<KernelVariant, KERNEL_COUNT>;
+
+CpuFeatures detect_cpu_features() noexcept {
+    CpuFeatures f;
+#if RESCUE_KERNELS_X86
+    unsigned int eax = 0;
+    unsigned int ebx = 0;
+    unsigned int ecx = 0;
+    unsigned int edx = 0;
+    if (__get_cpuid_count(7, 0, &eax, &ebx, &ecx, &edx) == 0) {
+        return f;
+    }
+    f.bmi2 = (ebx & (1u << 8)) != 0;
+    f.adx = (ebx & (1u << 19)) != 0;
+#endif
+    return f;
+}
+
+bool host_supports(KernelVariant v) noexcept {
+    const CpuFeatures& f = cpu_features();
+    switch (v) {
+        case KernelVariant::PORTABLE:
+            return true;
+        case KernelVariant::BMI2:
+            return f.bmi2 && f.adx;
+        case KernelVariant::COUNT:
+            break;
+    }
+    return false;
+}
+
+std::optional<KernelVariant> parse_variant(std::string_view s) {
+    for (size_t v = 0; v < KERNEL_VARIANT_COUNT; ++v) {
+        if (s == VARIANT_NAMES[v]) {
+            return static_cast<KernelVariant>(v);
+        }
+    }
+    return std::nullopt;
+}
+
+std::optional<Kernel> parse_kernel(std::string_view s) {
+    for (size_t k = 0; k < KERNEL_COUNT; ++k) {
+        if (s == KERNEL_NAMES[k]) {
+            return static_cast<Kernel>(k);
+        }
+    }
+    return std::nullopt;
+}
+
+/**
+ * @brief Apply a RESCUE_FORCE_KERNEL specification to a binding.
+ *
+ * Comma-separated entries, each either "<variant>" for every kernel or
+ * "<kernel>=<variant>"; later entries win.
+ */
+void apply_force(std::string_view spec, Binding& binding) {
+    while (!spec.empty()) {
+        const size_t comma = spec.find(',');
+        const std::string_view entry = spec.substr(0, comma);
+        spec = comma == std::string_view::npos ? std::string_view{} : spec.substr(comma + 1);
+        if (entry.empty()) {
+            continue;
+        }
+
+        const size_t eq = entry.find('=');
+        const std::string_view variant_name = eq == std::string_view::npos ? entry : entry.substr(eq + 1);
+        const auto variant = parse_variant(variant_name);
+        if (!variant) {
+            throw std::runtime_error("RESCUE_FORCE_KERNEL: unknown variant '" + std::string(variant_name) + "'");
+        }
+        if (!kernel_variant_available(*variant)) {
+            throw std::runtime_error("RESCUE_FORCE_KERNEL: variant '" + std::string(variant_name) +
+                                     "' is not available on this host");
+        }
+
+        if (eq == std::string_view::npos) {
+            binding.fill(*variant);
+        } else {
+            const auto kernel = parse_kernel(entry.substr(0, eq));
+            if (!kernel) {
+                throw std::runtime_error("RESCUE_FORCE_KERNEL: unknown kernel '" + std::string(entry.substr(0, eq)) +
+                                         "'");
+            }
+            binding[static_cast<size_t>(*kernel)] = *variant;
+        }
+    }
+}
+
+/// Best available variant (later variants are preferred), then RESCUE_FORCE_KERNEL
+Binding startup_binding() {
+    KernelVariant best = KernelVariant::PORTABLE;
+    for (size_t v = 0; v < KERNEL_VARIANT_COUNT; ++v) {
+        if (kernel_variant_available(static_cast<KernelVariant>(v))) {
+            best = static_cast<KernelVariant>(v);
+        }
+    }
+    Binding binding;
+    binding.fill(best);
+    if (const char* force = std::getenv("RESCUE_FORCE_KERNEL")) {
+        apply_force(force, binding);
+    }
+    return binding;
+}
+
+/**
+ * @brief The startup binding and the current one, which the set/reset API changes.
+ */
+class Registry {
+public:
+    Registry() : startup_(startup_binding()) { reset(); }
+
+    [[nodiscard]] KernelVariant get(Kernel k) const noexcept {
+        return bound_[static_cast<size_t>(k)].load(std::memory_order_relaxed);
+    }
+
+    void set(Kernel k, KernelVariant v) noexcept { bound_[static_cast<size_t>(k)].store(v, std::memory_order_relaxed); }
+
+    void reset() noexcept {
+        for (size_t k = 0; k < KERNEL_COUNT; ++k) {
+            bound_[k].store(startup_[k], std::memory_order_relaxed);
+        }
+    }
+
+private:
+    Binding startup_;
+    std::array<std::atomic<KernelVariant>, KERNEL_COUNT> bound_;
+};
+
+Registry& registry() {
+    // Built on first use; throws (and is retried) if RESCUE_FORCE_KERNEL is invalid
+    static Registry instance;
+    return instance;
+}
+
+const kernels::VariantTable& bound_table(Kernel k) {
+    return *kernels::VARIANTS[static_cast<size_t>(registry().get(k))];
+}
+
+}  // anonymous namespace
+
+const CpuFeatures& cpu_features() noexcept {
+    static const CpuFeatures features = detect_cpu_features();
+    return features;
+}
+
+const char* name(Kernel k) noexcept {
+    return KERNEL_NAMES[static_cast<size_t>(k)];
+}
+
+const char* name(KernelVariant v) noexcept {
+    return VARIANT_NAMES[static_cast<size_t>(v)];
+}
+
+bool kernel_variant_available(KernelVariant v) noexcept {
+    const auto i = static_cast<size_t>(v);
+    return i < KERNEL_VARIANT_COUNT && kernels::VARIANTS[i] != nullptr && host_supports(v);
+}
+
+KernelVariant active_variant(Kernel k) {
+    return registry().get(k);
+}
+
+std::string active_kernels() {
+    std::string out;
+    for (size_t k = 0; k < KERNEL_COUNT; ++k) {
+        if (k > 0) {
+            out += ' ';
+        }
+        out += KERNEL_NAMES[k];
+        out += '=';
+        out += name(active_variant(static_cast<Kernel>(k)));
+    }
+    return out;
+}
+
+void set_kernel_variant(Kernel k, KernelVariant v) {
+    if (!kernel_variant_available(v)) {
+        throw std::invalid_argument(std::string("Kernel variant ") + name(v) + " is not available");
+    }
+    registry().set(k, v);
+}
+
+void set_kernel_variant(KernelVariant v) {
+    for (size_t k = 0; k < KERNEL_COUNT; ++k) {
+        set_kernel_variant(static_cast<Kernel>(k), v);
+    }
+}
+
+void reset_kernel_variants() {
+    registry().reset();
+}
+
+namespace kernels {
+
+PermuteFn permutation() {
+    return bound_table(Kernel::PERMUTATION).permute;
+}
+
+SboxFn sbox() {
+    return bound_table(Kernel::SBOX).sbox;
+}
+
+MdsFn mds() {
+    return bound_table(Kernel::MDS).mds;
+}
+
+}  // namespace kernels
+
+}  // namespace rescue
@@ -0,0 +1,43 @@
+#pragma once
+
+/**
+ * @file kernels.hpp
+ * @brief Dispatched permutation kernels (library internal).
+ *
+ * Each accessor returns the variant currently bound to the kernel (see
+ * <rescue/kernels.hpp>). Callers fetch the pointer once per permutation.
+ */
+
+#include <rescue/field.hpp>
+#include <rescue/kernels.hpp>
+#include <rescue/matrix.hpp>
+
+#include <span>
+
+namespace rescue::kernels {
+
+/**
+ * @brief Round structure of one RescueDesc, as the permutation kernel reads it.
+ */
+struct Rounds {
+    size_t m;
+    std::span<const Matrix> round_keys;
+    const Matrix& mds;
+    const uint256& exp_even;
+    const uint256& exp_odd;
+};
+
+/// Forward permutation of states.size() / m lanes; tmp holds m elements
+using PermuteFn = void (*)(const Rounds& rounds, std::span<Fp> states, std::span<Fp> tmp);
+
+/// Raise every element of state to exp
+using SboxFn = void (*)(std::span<Fp> state, const uint256& exp);
+
+/// out = mat * in, for a square row-major matrix of size in.size()
+using MdsFn = void (*)(const Matrix& mat, std::span<const Fp> in, std::span<Fp> out);
+
+[[nodiscard]] PermuteFn permutation();
+[[nodiscard]] SboxFn sbox();
+[[nodiscard]] MdsFn mds();
+
+}  // namespace rescue::kernels
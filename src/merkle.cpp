@@ -0,0 +1,151 @@
+#include <rescue/merkle.hpp>
+
+#include <algorithm>
+
+namespace rescue {
+
+namespace {
+
+constexpr size_t DIGEST_LENGTH = RESCUE_HASH_DIGEST_LENGTH;
+constexpr size_t STATE_SIZE = RESCUE_HASH_STATE_SIZE;
+constexpr size_t RATE = RESCUE_HASH_RATE;
+
+// left || right plus the padding 1 fills exactly two blocks
+static_assert(RATE < 2 * DIGEST_LENGTH && 2 * DIGEST_LENGTH < 2 * RATE, "A node pair must span two blocks");
+
+/// Element i of left || right
+const Fp& pair_element(const MerkleDigest& left, const MerkleDigest& right, size_t i) {
+    return i < DIGEST_LENGTH ? left[i] : right[i - DIGEST_LENGTH];
+}
+
+/// The state after absorbing the first block into the all-zero state
+void load_first_block(const MerkleDigest& left, const MerkleDigest& right, std::span<Fp> state) {
+    std::fill(state.begin(), state.end(), Fp::ZERO);
+    for (size_t i = 0; i < RATE; ++i) {
+        state[i] = pair_element(left, right, i);
+    }
+}
+
+/// Add the second block: the rest of the pair, then the padding 1 and zeros
+void add_second_block(const MerkleDigest& left, const MerkleDigest& right, std::span<Fp> state) {
+    for (size_t i = RATE; i < 2 * DIGEST_LENGTH; ++i) {
+        state[i - RATE] += pair_element(left, right, i);
+    }
+    state[2 * DIGEST_LENGTH - RATE] += Fp::ONE;
+}
+
+void store_digest(std::span<const Fp> state, MerkleDigest& out) {
+    std::copy_n(state.begin(), DIGEST_LENGTH, out.begin());
+}
+
+/// Whether index addresses a leaf of a tree with the given number of levels
+bool index_fits(uint64_t index, size_t depth) { return depth >= 64 || (index >> depth) == 0; }
+
+}  // anonymous namespace
+
+// ============================================================================
+// MerkleVerifier
+// ============================================================================
+
+MerkleVerifier::MerkleVerifier() : desc_(RESCUE_HASH_STATE_SIZE, RESCUE_HASH_CAPACITY) {}
+
+MerkleDigest MerkleVerifier::hash_pair(const MerkleDigest& left, const MerkleDigest& right) const {
+    std::array<Fp, STATE_SIZE> state;
+    load_first_block(left, right, state);
+    desc_.permute_in_place(state);
+    add_second_block(left, right, state);
+    desc_.permute_in_place(state);
+
+    MerkleDigest out;
+    store_digest(state, out);
+    return out;
+}
+
+bool MerkleVerifier::verify_path(const MerklePath& path, const MerkleDigest& root) const {
+    if (!index_fits(path.index, path.siblings.size())) {
+        return false;
+    }
+    MerkleDigest node = path.leaf;
+    for (size_t level = 0; level < path.siblings.size(); ++level) {
+        node = ((path.index >> level) & 1) != 0 ? hash_pair(path.siblings[level], node)
+                                                : hash_pair(node, path.siblings[level]);
+    }
+    return node == root;
+}
+
+std::vector<bool> MerkleVerifier::verify_paths(std::span<const MerklePath> paths, const MerkleDigest& root) const {
+    const size_t n = paths.size();
+    std::vector<MerkleDigest> nodes(n);
+    std::vector<bool> valid(n);
+    size_t max_depth = 0;
+    for (size_t i = 0; i < n; ++i) {
+        nodes[i] = paths[i].leaf;
+        valid[i] = index_fits(paths[i].index, paths[i].siblings.size());
+        max_depth = std::max(max_depth, paths[i].siblings.size());
+    }
+
+    struct Task {
+        MerkleDigest left;
+        MerkleDigest right;
+        size_t path;
+    };
+    std::vector<Task> tasks;
+    std::vector<size_t> slot;       // task -> unique pair
+    std::vector<size_t> first_task;  // unique pair -> a task that defines it
+    std::vector<Fp> states;
+
+    for (size_t level = 0; level < max_depth; ++level) {
+        tasks.clear();
+        for (size_t i = 0; i < n; ++i) {
+            const MerklePath& path = paths[i];
+            if (!valid[i] || level >= path.siblings.size()) {
+                continue;
+            }
+            if (((path.index >> level) & 1) != 0) {
+                tasks.push_back({path.siblings[level], nodes[i], i});
+            } else {
+                tasks.push_back({nodes[i], path.siblings[level], i});
+            }
+        }
+        if (tasks.empty()) {
+            continue;
+        }
+
+        // Paths that overlap above this level hash the same pair: sort so
+        // equal pairs are adjacent, then compute each distinct pair once
+        std::sort(tasks.begin(), tasks.end(), [](const Task& a, const Task& b) {
+            return a.left != b.left ? a.left < b.left : a.right < b.right;
+        });
+        slot.resize(tasks.size());
+        first_task.clear();
+        for (size_t t = 0; t < tasks.size(); ++t) {
+            if (t == 0 || tasks[t].left != tasks[t - 1].left || tasks[t].right != tasks[t - 1].right) {
+                first_task.push_back(t);
+            }
+            slot[t] = first_task.size() - 1;
+        }
+
+        // Two permutations per pair, every distinct pair of the level per pass
+        states.resize(first_task.size() * STATE_SIZE);
+        auto lane = [&](size_t u) { return std::span<Fp>(states).subspan(u * STATE_SIZE, STATE_SIZE); };
+        for (size_t u = 0; u < first_task.size(); ++u) {
+            load_first_block(tasks[first_task[u]].left, tasks[first_task[u]].right, lane(u));
+        }
+        desc_.permute_many(states);
+        for (size_t u = 0; u < first_task.size(); ++u) {
+            add_second_block(tasks[first_task[u]].left, tasks[first_task[u]].right, lane(u));
+        }
+        desc_.permute_many(states);
+
+        for (size_t t = 0; t < tasks.size(); ++t) {
+            store_digest(lane(slot[t]), nodes[tasks[t].path]);
+        }
+    }
+
+    for (size_t i = 0; i < n; ++i) {
+        valid[i] = valid[i] && nodes[i] == root;
+    }
+    return valid;
+}
+
+}  // namespace rescue
@@ -0,0 +1,226 @@
+#include <rescue/metrics.hpp>
+
+#include <cstdio>
+#include <new>
+
+namespace rescue::metrics {
+
+namespace {
+
+// ============================================================================
+// Per-thread shards
+// ============================================================================
+
+struct PhaseShard {
+    std::atomic<uint64_t> count{0};
+    std::atomic<uint64_t> total_ns{0};
+    std::array<std::atomic<uint64_t>, HISTOGRAM_BUCKETS> buckets{};
+};
+
+// Each shard has a single writer (its owning thread), so updates are a relaxed
+// load and store rather than an atomic read-modify-write. Shards are linked
+// into a push-only list and never freed; when a thread exits its shard is
+// released for reuse by the next new thread, so totals are never lost and
+// memory is bounded by the peak number of concurrent threads.
+struct Shard {
+    std::array<std::atomic<uint64_t>, COUNTER_COUNT> counters{};
+    std::array<PhaseShard, PHASE_COUNT> phases{};
+    std::atomic<bool> in_use{false};
+    Shard* next = nullptr;
+};
+
+std::atomic<Shard*> g_shards{nullptr};
+
+/// A free shard, or a new one; null if allocation fails
+Shard* acquire_shard() noexcept {
+    for (Shard* s = g_shards.load(std::memory_order_acquire); s != nullptr; s = s->next) {
+        bool expected = false;
+        if (s->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)) {
+            return s;
+        }
+    }
+
+    // Reached from noexcept recording, so a failed allocation must not throw
+    auto* shard = new (std::nothrow) Shard;
+    if (shard == nullptr) {
+        return nullptr;
+    }
+    shard->in_use.store(true, std::memory_order_relaxed);
+    shard->next = g_shards.load(std::memory_order_relaxed);
+    while (!g_shards.compare_exchange_weak(shard->next, shard, std::memory_order_release,
+                                           std::memory_order_relaxed)) {
+    }
+    return shard;
+}
+
+struct ShardHandle {
+    Shard* shard = nullptr;
+    ~ShardHandle() {
+        if (shard != nullptr) {
+            shard->in_use.store(false, std::memory_order_release);
+        }
+    }
+};
+
+/// This thread's shard; null (and retried on the next sample) if none could be allocated
+Shard* local_shard() noexcept {
+    thread_local ShardHandle handle;
+    if (handle.shard == nullptr) {
+        handle.shard = acquire_shard();
+    }
+    return handle.shard;
+}
+
+void bump(std::atomic<uint64_t>& value, uint64_t n) noexcept {
+    value.store(value.load(std::memory_order_relaxed) + n, std::memory_order_relaxed);
+}
+
+size_t bucket_index(uint64_t ns) noexcept {
+    // Smallest i with ns <= 1000 * 2^i, clamped to the +Inf bucket
+    size_t i = 0;
+    while (i + 1 < HISTOGRAM_BUCKETS && ns > bucket_upper_bound_ns(i)) {
+        ++i;
+    }
+    return i;
+}
+
+constexpr std::array<const char*, COUNTER_COUNT> COUNTER_NAMES = {
+    "permutations", "elements_encrypted", "elements_decrypted", "hash_blocks_absorbed",
+    "cipher_constructions"};
+
+constexpr std::array<const char*, COUNTER_COUNT> COUNTER_HELP = {
+    "Rescue permutations (forward or inverse) executed.",
+    "Field elements encrypted in CTR mode.",
+    "Field elements decrypted in CTR mode.",
+    "Rate-sized blocks absorbed by RescuePrimeHash.",
+    "Rescue cipher instances constructed."};
+
+constexpr std::array<const char*, PHASE_COUNT> PHASE_NAMES = {
+    "key_derivation", "round_parameters", "mds_setup", "constant_sampling", "key_schedule",
+    "encryption",     "decryption"};
+
+}  // anonymous namespace
+
+// ============================================================================
+// Recording
+// ============================================================================
+
+namespace detail {
+
+// Samples are dropped when the thread has no shard
+void add_counter(Counter c, uint64_t n) noexcept {
+    if (Shard* shard = local_shard()) {
+        bump(shard->counters[static_cast<size_t>(c)], n);
+    }
+}
+
+void record_phase(Phase p, uint64_t ns) noexcept {
+    Shard* shard = local_shard();
+    if (shard == nullptr) {
+        return;
+    }
+    PhaseShard& phase = shard->phases[static_cast<size_t>(p)];
+    bump(phase.count, 1);
+    bump(phase.total_ns, ns);
+    bump(phase.buckets[bucket_index(ns)], 1);
+}
+
+}  // namespace detail
+
+void set_enabled(bool enabled) noexcept {
+    detail::metrics_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+// ============================================================================
+// Reading
+// ============================================================================
+
+Snapshot snapshot() {
+    Snapshot snap;
+    for (Shard* s = g_shards.load(std::memory_order_acquire); s != nullptr; s = s->next) {
+        for (size_t i = 0; i < COUNTER_COUNT; ++i) {
+            snap.counters[i] += s->counters[i].load(std::memory_order_relaxed);
+        }
+        for (size_t p = 0; p < PHASE_COUNT; ++p) {
+            const PhaseShard& src = s->phases[p];
+            PhaseStats& dst = snap.phases[p];
+            dst.count += src.count.load(std::memory_order_relaxed);
+            dst.total_ns += src.total_ns.load(std::memory_order_relaxed);
+            for (size_t b = 0; b < HISTOGRAM_BUCKETS; ++b) {
+                dst.buckets[b] += src.buckets[b].load(std::memory_order_relaxed);
+            }
+        }
+    }
+    return snap;
+}
+
+void reset() noexcept {
+    for (Shard* s = g_shards.load(std::memory_order_acquire); s != nullptr; s = s->next) {
+        for (auto& c : s->counters) {
+            c.store(0, std::memory_order_relaxed);
+        }
+        for (auto& phase : s->phases) {
+            phase.count.store(0, std::memory_order_relaxed);
+            phase.total_ns.store(0, std::memory_order_relaxed);
+            for (auto& b : phase.buckets) {
+                b.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+}
+
+const char* name(Counter c) noexcept {
+    return COUNTER_NAMES[static_cast<size_t>(c)];
+}
+
+const char* name(Phase p) noexcept {
+    return PHASE_NAMES[static_cast<size_t>(p)];
+}
+
+std::string to_prometheus(const Snapshot& snap) {
+    std::string out;
+    char line[160];
+
+    for (size_t i = 0; i < COUNTER_COUNT; ++i) {
+        std::snprintf(line, sizeof(line), "# HELP rescue_%s_total %s\n", COUNTER_NAMES[i],
+                      COUNTER_HELP[i]);
+        out += line;
+        std::snprintf(line, sizeof(line), "# TYPE rescue_%s_total counter\n", COUNTER_NAMES[i]);
+        out += line;
+        std::snprintf(line, sizeof(line), "rescue_%s_total %llu\n", COUNTER_NAMES[i],
+                      static_cast<unsigned long long>(snap.counters[i]));
+        out += line;
+    }
+
+    out += "# HELP rescue_phase_duration_seconds Time spent in library phases.\n";
+    out += "# TYPE rescue_phase_duration_seconds histogram\n";
+    for (size_t p = 0; p < PHASE_COUNT; ++p) {
+        const PhaseStats& stats = snap.phases[p];
+        uint64_t cumulative = 0;
+        for (size_t b = 0; b < HISTOGRAM_BUCKETS; ++b) {
+            cumulative += stats.buckets[b];
+            uint64_t bound = bucket_upper_bound_ns(b);
+            if (bound != 0) {
+                std::snprintf(line, sizeof(line),
+                              "rescue_phase_duration_seconds_bucket{phase=\"%s\",le=\"%g\"} %llu\n",
+                              PHASE_NAMES[p], static_cast<double>(bound) * 1e-9,
+                              static_cast<unsigned long long>(cumulative));
+            } else {
+                std::snprintf(line, sizeof(line),
+                              "rescue_phase_duration_seconds_bucket{phase=\"%s\",le=\"+Inf\"} %llu\n",
+                              PHASE_NAMES[p], static_cast<unsigned long long>(cumulative));
+            }
+            out += line;
+        }
+        std::snprintf(line, sizeof(line), "rescue_phase_duration_seconds_sum{phase=\"%s\"} %.9f\n",
+                      PHASE_NAMES[p], static_cast<double>(stats.total_ns) * 1e-9);
+        out += line;
+        std::snprintf(line, sizeof(line), "rescue_phase_duration_seconds_count{phase=\"%s\"} %llu\n",
+                      PHASE_NAMES[p], static_cast<unsigned long long>(stats.count));
+        out += line;
+    }
+
+    return out;
+}
+
+}  // namespace rescue::metrics
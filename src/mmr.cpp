@@ -0,0 +1,253 @@
+#include <rescue/mmr.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace rescue {
+
+namespace {
+
+/// Domain tags in the compression state, after the two children
+constexpr uint64_t DOMAIN_NODE = 1;
+constexpr uint64_t DOMAIN_BAG = 2;
+
+constexpr size_t DIGEST_LENGTH = RESCUE_HASH_DIGEST_LENGTH;
+static_assert(2 * DIGEST_LENGTH + 2 <= RESCUE_HASH_STATE_SIZE, "Compression input must fit the state");
+
+constexpr uint64_t pow2(size_t h) { return uint64_t{1} << h; }
+
+/// Nodes in a perfect tree of height h
+constexpr uint64_t tree_size(size_t h) { return 2 * pow2(h) - 1; }
+
+/**
+ * @brief Location of a leaf's peak: its index among the peaks, its height,
+ *        its first post-order position, and the leaf's index within it.
+ */
+struct PeakLocation {
+    size_t peak = 0;
+    size_t height = 0;
+    uint64_t first_position = 0;
+    uint64_t local_index = 0;
+};
+
+PeakLocation locate_peak(uint64_t leaf_index, uint64_t leaf_count) {
+    PeakLocation loc;
+    uint64_t leaves_before = 0;
+    // Peaks follow the set bits of leaf_count, tallest first
+    for (size_t h = 64; h-- > 0;) {
+        if ((leaf_count & pow2(h)) == 0) {
+            continue;
+        }
+        if (leaf_index < leaves_before + pow2(h)) {
+            loc.height = h;
+            loc.local_index = leaf_index - leaves_before;
+            return loc;
+        }
+        leaves_before += pow2(h);
+        loc.first_position += tree_size(h);
+        ++loc.peak;
+    }
+    throw std::out_of_range("Leaf index " + std::to_string(leaf_index) + " out of range");
+}
+
+}  // anonymous namespace
+
+// ============================================================================
+// MerkleMountainRange
+// ============================================================================
+
+MerkleMountainRange::MerkleMountainRange() : desc_(RESCUE_HASH_STATE_SIZE, RESCUE_HASH_CAPACITY) {}
+
+MerkleMountainRange::MerkleMountainRange(const std::filesystem::path& journal) : MerkleMountainRange() {
+    const uint64_t file_size = std::filesystem::exists(journal) ? std::filesystem::file_size(journal) : 0;
+    const uint64_t records = file_size / MMR_DIGEST_BYTES;
+
+    // The largest complete MMR that fits the records on disk; n leaves take
+    // 2n - popcount(n) nodes, so n is at most records / 2 + 32
+    uint64_t leaves = std::min(records, records / 2 + 32);
+    while (leaves > 0 && node_count_for(leaves) > records) {
+        --leaves;
+    }
+    const uint64_t kept = node_count_for(leaves);
+
+    if (kept > 0) {
+        std::ifstream in(journal, std::ios::binary);
+        if (!in) {
+            throw std::runtime_error("Cannot open MMR journal " + journal.string());
+        }
+        nodes_.resize(kept);
+        std::array<uint8_t, MMR_DIGEST_BYTES> buf;
+        for (auto& node : nodes_) {
+            if (!in.read(reinterpret_cast<char*>(buf.data()), buf.size())) {
+                throw std::runtime_error("Cannot read MMR journal " + journal.string());
+            }
+            for (size_t i = 0; i < DIGEST_LENGTH; ++i) {
+                node[i] = Fp::from_bytes(std::span<const uint8_t>(buf).subspan(i * Fp::BYTES, Fp::BYTES));
+            }
+        }
+    }
+    if (kept * MMR_DIGEST_BYTES != file_size) {
+        std::error_code ec;
+        std::filesystem::resize_file(journal, kept * MMR_DIGEST_BYTES, ec);
+        if (ec) {
+            throw std::runtime_error("Cannot truncate MMR journal " + journal.string() + ": " + ec.message());
+        }
+    }
+
+    leaf_count_ = leaves;
+    rebuild_peaks();
+
+    journal_.emplace(journal, std::ios::binary | std::ios::app);
+    if (!*journal_) {
+        throw std::runtime_error("Cannot open MMR journal " + journal.string());
+    }
+}
+
+uint64_t MerkleMountainRange::append(const MmrDigest& leaf) {
+    const uint64_t index = leaf_count_;
+
+    // The leaf, then one node per merge: each trailing one bit of the old
+    // count is a peak of equal height. Compute them all before touching any state.
+    std::array<MmrDigest, MAX_APPEND_NODES> created;
+    created[0] = leaf;
+    size_t n_created = 1;
+    for (uint64_t bits = index; (bits & 1) != 0; bits >>= 1) {
+        const MmrDigest& left = nodes_[peaks_[peaks_.size() - n_created]];
+        created[n_created] = hash_children(left, created[n_created - 1]);
+        ++n_created;
+    }
+    const std::span<const MmrDigest> new_nodes(created.data(), n_created);
+
+    // Reserve first so nothing below can throw once the journal has the nodes
+    nodes_.reserve(nodes_.size() + n_created);
+    peaks_.reserve(peaks_.size() + 1);
+    write_journal(new_nodes);
+
+    nodes_.insert(nodes_.end(), new_nodes.begin(), new_nodes.end());
+    peaks_.resize(peaks_.size() - (n_created - 1));
+    peaks_.push_back(nodes_.size() - 1);
+    ++leaf_count_;
+    return index;
+}
+
+template <typename PeakFn>
+MmrDigest MerkleMountainRange::bag(size_t n_peaks, PeakFn&& peak, uint64_t leaf_count) const {
+    // Right to left from zero, committing to the leaf count
+    MmrDigest acc{};
+    for (size_t i = n_peaks; i-- > 0;) {
+        acc = compress(peak(i), acc, DOMAIN_BAG, leaf_count);
+    }
+    return acc;
+}
+
+MmrDigest MerkleMountainRange::root() const {
+    return bag(peaks_.size(), [&](size_t i) -> const MmrDigest& { return nodes_[peaks_[i]]; }, leaf_count_);
+}
+
+MmrProof MerkleMountainRange::prove(uint64_t leaf_index) const {
+    PeakLocation loc = locate_peak(leaf_index, leaf_count_);
+
+    MmrProof proof;
+    proof.leaf_index = leaf_index;
+    proof.leaf_count = leaf_count_;
+    proof.siblings.resize(loc.height);
+    proof.peaks.reserve(peaks_.size());
+    for (size_t pos : peaks_) {
+        proof.peaks.push_back(nodes_[pos]);
+    }
+
+    // Descend from the peak; in post-order a node's left subtree comes first
+    uint64_t start = loc.first_position;
+    uint64_t local = loc.local_index;
+    for (size_t h = loc.height; h > 0; --h) {
+        const uint64_t child_size = tree_size(h - 1);
+        const uint64_t left_root = start + child_size - 1;
+        const uint64_t right_root = start + 2 * child_size - 1;
+        if (local < pow2(h - 1)) {
+            proof.siblings[h - 1] = nodes_[right_root];
+        } else {
+            proof.siblings[h - 1] = nodes_[left_root];
+            start += child_size;
+            local -= pow2(h - 1);
+        }
+    }
+    return proof;
+}
+
+bool MerkleMountainRange::verify(const MmrDigest& root, const MmrDigest& leaf, const MmrProof& proof) const {
+    if (proof.leaf_index >= proof.leaf_count ||
+        proof.peaks.size() != static_cast<size_t>(std::popcount(proof.leaf_count))) {
+        return false;
+    }
+    PeakLocation loc = locate_peak(proof.leaf_index, proof.leaf_count);
+    if (proof.siblings.size() != loc.height) {
+        return false;
+    }
+
+    MmrDigest current = leaf;
+    for (size_t k = 0; k < loc.height; ++k) {
+        current = ((loc.local_index >> k) & 1) != 0 ? hash_children(proof.siblings[k], current)
+                                                    : hash_children(current, proof.siblings[k]);
+    }
+    if (current != proof.peaks[loc.peak]) {
+        return false;
+    }
+    auto peak = [&](size_t i) -> const MmrDigest& { return proof.peaks[i]; };
+    return bag(proof.peaks.size(), peak, proof.leaf_count) == root;
+}
+
+MmrDigest MerkleMountainRange::hash_children(const MmrDigest& left, const MmrDigest& right) const {
+    return compress(left, right, DOMAIN_NODE, 0);
+}
+
+void MerkleMountainRange::flush() {
+    if (journal_ && !journal_->flush()) {
+        throw std::runtime_error("Cannot write MMR journal");
+    }
+}
+
+MmrDigest MerkleMountainRange::compress(const MmrDigest& left, const MmrDigest& right, uint64_t domain,
+                                        uint64_t length) const {
+    std::array<Fp, RESCUE_HASH_STATE_SIZE> state{};
+    std::copy(left.begin(), left.end(), state.begin());
+    std::copy(right.begin(), right.end(), state.begin() + DIGEST_LENGTH);
+    state[2 * DIGEST_LENGTH] = Fp(domain);
+    state[2 * DIGEST_LENGTH + 1] = Fp(length);
+    desc_.permute_in_place(state);
+
+    MmrDigest out;
+    std::copy_n(state.begin(), DIGEST_LENGTH, out.begin());
+    return out;
+}
+
+
+void MerkleMountainRange::write_journal(std::span<const MmrDigest> nodes) {
+    if (!journal_) {
+        return;
+    }
+    std::array<uint8_t, MAX_APPEND_NODES * MMR_DIGEST_BYTES> buf;
+    for (size_t n = 0; n < nodes.size(); ++n) {
+        for (size_t i = 0; i < DIGEST_LENGTH; ++i) {
+            nodes[n][i].to_bytes(
+                std::span<uint8_t, Fp::BYTES>(buf.data() + n * MMR_DIGEST_BYTES + i * Fp::BYTES, Fp::BYTES));
+        }
+    }
+    if (!journal_->write(reinterpret_cast<const char*>(buf.data()),
+                         static_cast<std::streamsize>(nodes.size() * MMR_DIGEST_BYTES))) {
+        throw std::runtime_error("Cannot write MMR journal");
+    }
+}
+
+void MerkleMountainRange::rebuild_peaks() {
+    peaks_.clear();
+    uint64_t position = 0;
+    for (size_t h = 64; h-- > 0;) {
+        if ((leaf_count_ & pow2(h)) != 0) {
+            position += tree_size(h);
+            peaks_.push_back(position - 1);
+        }
+    }
+}
+
+}  // namespace rescue
@@ -0,0 +1,27 @@
+#pragma once
+
+/**
+ * @file probes.hpp
+ * @brief USDT (statically defined tracing) probes for the library internals.
+ *
+ * With -DRESCUE_USDT=ON every RESCUE_PROBE site becomes a <sys/sdt.h> probe
+ * in provider "rescue". A probe compiles to a single nop plus an ELF note
+ * that bpftrace, perf and SystemTap read; nothing runs until a tracer
+ * attaches. Without the option the macros expand to nothing.
+ *
+ * Probe names use a double underscore, which tracers display as a dash:
+ * cipher__construct__start is attached as usdt:...:rescue:cipher__construct__start.
+ * Arguments are plain integers. tools/rescue_latency.bt lists every probe.
+ */
+
+#if defined(RESCUE_USDT) && RESCUE_USDT
+#include <sys/sdt.h>
+
+#define RESCUE_PROBE(name) DTRACE_PROBE(rescue, name)
+#define RESCUE_PROBE1(name, a) DTRACE_PROBE1(rescue, name, a)
+#define RESCUE_PROBE2(name, a, b) DTRACE_PROBE2(rescue, name, a, b)
+#else
+#define RESCUE_PROBE(name) ((void)0)
+#define RESCUE_PROBE1(name, a) ((void)0)
+#define RESCUE_PROBE2(name, a, b) ((void)0)
+#endif
@@ -0,0 +1,293 @@
+/**
+ * @file rescue_c.cpp
+ * @brief C ABI over the cipher and hash.
+ */
+
+#include <rescue/rescue_c.h>
+
+#include <rescue/detail/any_cipher.hpp>
+#include <rescue/rescue_cipher.hpp>
+#include <rescue/rescue_hash.hpp>
+#include <rescue/utils.hpp>
+
+#include <limits>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <variant>
+#include <vector>
+
+using namespace rescue;
+
+struct rescue_cipher {
+    detail::AnyCipher cipher;
+    uint32_t width;
+};
+
+struct rescue_hasher {
+    RescuePrimeHash hash;
+};
+
+namespace {
+
+static_assert(RESCUE_C_ELEMENT_SIZE == Fp::BYTES);
+static_assert(RESCUE_C_NONCE_SIZE == RESCUE_CIPHER_NONCE_SIZE);
+static_assert(RESCUE_C_SECRET_SIZE == RESCUE_CIPHER_SECRET_SIZE);
+static_assert(RESCUE_C_DIGEST_ELEMENTS == RESCUE_HASH_DIGEST_LENGTH);
+
+/// Thrown internally for non-canonical input; mapped to RESCUE_ERR_NON_CANONICAL.
+struct NonCanonical {};
+
+/**
+ * @brief Run `f` and translate any exception into a status code.
+ */
+template <typename F>
+rescue_status guarded(F&& f) noexcept {
+    try {
+        return f();
+    } catch (const NonCanonical&) {
+        return RESCUE_ERR_NON_CANONICAL;
+    } catch (const std::bad_alloc&) {
+        return RESCUE_ERR_OUT_OF_MEMORY;
+    } catch (const std::invalid_argument&) {
+        return RESCUE_ERR_INVALID_ARGUMENT;
+    } catch (...) {
+        return RESCUE_ERR_INTERNAL;
+    }
+}
+
+rescue_cipher* make_cipher(uint32_t width, const uint8_t* secret) {
+    std::span<const uint8_t, RESCUE_CIPHER_SECRET_SIZE> s(secret, RESCUE_CIPHER_SECRET_SIZE);
+    return new rescue_cipher{detail::make_any_cipher(width, s), width};
+}
+
+/**
+ * @brief Total element count of a batch, or throw on size_t overflow.
+ */
+size_t total_elements(size_t count, const size_t* lengths) {
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i) {
+        if (lengths[i] > std::numeric_limits<size_t>::max() / RESCUE_C_ELEMENT_SIZE - total) {
+            throw std::invalid_argument("Batch size overflows size_t");
+        }
+        total += lengths[i];
+    }
+    return total;
+}
+
+Fp read_element(const uint8_t* in) {
+    uint256 raw(std::span<const uint8_t>(in, RESCUE_C_ELEMENT_SIZE));
+    return Fp(raw);
+}
+
+void write_element(const Fp& x, uint8_t* out) {
+    x.to_bytes(std::span<uint8_t, Fp::BYTES>(out, Fp::BYTES));
+}
+
+void require_canonical(const uint8_t* in, size_t n_elements) {
+    for (size_t i = 0; i < n_elements; ++i) {
+        if (uint256(std::span<const uint8_t>(in + i * RESCUE_C_ELEMENT_SIZE, RESCUE_C_ELEMENT_SIZE)) >= Fp::P) {
+            throw NonCanonical{};
+        }
+    }
+}
+
+/**
+ * @brief CTR over a batch: one encrypt_blocks() call for every counter block.
+ *
+ * Matches encrypt_raw(): element e of a message is offset by
+ * E([nonce, e / M, 0, ...])[e % M].
+ */
+template <size_t M>
+void ctr_batch(const BasicRescueCipher<M>& cipher, size_t count, const uint8_t* nonces, const size_t* lengths,
+               const uint8_t* in, uint8_t* out, bool decrypt) {
+    using Block = typename BasicRescueCipher<M>::Block;
+
+    size_t n_blocks = 0;
+    for (size_t i = 0; i < count; ++i) {
+        n_blocks += (lengths[i] + M - 1) / M;
+    }
+    std::vector<Block> key_stream(n_blocks);
+    size_t b = 0;
+    for (size_t i = 0; i < count; ++i) {
+        Fp nonce(deserialize_le(std::span<const uint8_t>(nonces + i * RESCUE_C_NONCE_SIZE, RESCUE_C_NONCE_SIZE)));
+        for (size_t j = 0; j < (lengths[i] + M - 1) / M; ++j, ++b) {
+            key_stream[b][0] = nonce;
+            key_stream[b][1] = Fp(uint64_t{j});
+        }
+    }
+    cipher.encrypt_blocks(key_stream, key_stream);
+
+    b = 0;
+    size_t offset = 0;
+    for (size_t i = 0; i < count; ++i) {
+        for (size_t e = 0; e < lengths[i]; ++e, offset += RESCUE_C_ELEMENT_SIZE) {
+            Fp x = read_element(in + offset);
+            const Fp& k = key_stream[b + e / M][e % M];
+            write_element(decrypt ? x - k : x + k, out + offset);
+        }
+        b += (lengths[i] + M - 1) / M;
+    }
+}
+
+rescue_status cipher_batch(const rescue_cipher* cipher, size_t count, const uint8_t* nonces, const size_t* lengths,
+                           const uint8_t* in, uint8_t* out, bool decrypt) {
+    if (cipher == nullptr || (count > 0 && (nonces == nullptr || lengths == nullptr))) {
+        return RESCUE_ERR_NULL_POINTER;
+    }
+    return guarded([&] {
+        size_t total = total_elements(count, lengths);
+        if (total == 0) {
+            return RESCUE_OK;
+        }
+        if (in == nullptr || out == nullptr) {
+            return RESCUE_ERR_NULL_POINTER;
+        }
+        require_canonical(in, total);
+        std::visit([&](const auto& c) { ctr_batch(c, count, nonces, lengths, in, out, decrypt); }, cipher->cipher);
+        return RESCUE_OK;
+    });
+}
+
+}  // anonymous namespace
+
+extern "C" {
+
+uint32_t rescue_abi_version(void) {
+    return RESCUE_C_ABI_VERSION;
+}
+
+const char* rescue_status_string(rescue_status status) {
+    switch (status) {
+        case RESCUE_OK:
+            return "ok";
+        case RESCUE_ERR_NULL_POINTER:
+            return "null pointer";
+        case RESCUE_ERR_INVALID_ARGUMENT:
+            return "invalid argument";
+        case RESCUE_ERR_NON_CANONICAL:
+            return "non-canonical field element";
+        case RESCUE_ERR_OUT_OF_MEMORY:
+            return "out of memory";
+        case RESCUE_ERR_INTERNAL:
+            return "internal error";
+    }
+    return "unknown status";
+}
+
+// ============================================================================
+// Cipher
+// ============================================================================
+
+rescue_status rescue_cipher_new(uint32_t width, const uint8_t* secret, rescue_cipher** out) {
+    return rescue_cipher_new_batch(width, secret, 1, out);
+}
+
+rescue_status rescue_cipher_new_batch(uint32_t width, const uint8_t* secrets, size_t count, rescue_cipher** out) {
+    if (out == nullptr || (count > 0 && secrets == nullptr)) {
+        return RESCUE_ERR_NULL_POINTER;
+    }
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = nullptr;
+    }
+    if (!is_supported_cipher_width(width)) {
+        return RESCUE_ERR_INVALID_ARGUMENT;
+    }
+    rescue_status status = guarded([&] {
+        for (size_t i = 0; i < count; ++i) {
+            out[i] = make_cipher(width, secrets + i * RESCUE_C_SECRET_SIZE);
+        }
+        return RESCUE_OK;
+    });
+    if (status != RESCUE_OK) {
+        for (size_t i = 0; i < count; ++i) {
+            delete out[i];
+            out[i] = nullptr;
+        }
+    }
+    return status;
+}
+
+void rescue_cipher_free(rescue_cipher* cipher) {
+    delete cipher;
+}
+
+uint32_t rescue_cipher_width(const rescue_cipher* cipher) {
+    return cipher != nullptr ? cipher->width : 0;
+}
+
+rescue_status rescue_cipher_encrypt(const rescue_cipher* cipher, const uint8_t* nonce, const uint8_t* in,
+                                    size_t n_elements, uint8_t* out) {
+    return cipher_batch(cipher, 1, nonce, &n_elements, in, out, false);
+}
+
+rescue_status rescue_cipher_decrypt(const rescue_cipher* cipher, const uint8_t* nonce, const uint8_t* in,
+                                    size_t n_elements, uint8_t* out) {
+    return cipher_batch(cipher, 1, nonce, &n_elements, in, out, true);
+}
+
+rescue_status rescue_cipher_encrypt_batch(const rescue_cipher* cipher, size_t count, const uint8_t* nonces,
+                                          const size_t* lengths, const uint8_t* in, uint8_t* out) {
+    return cipher_batch(cipher, count, nonces, lengths, in, out, false);
+}
+
+rescue_status rescue_cipher_decrypt_batch(const rescue_cipher* cipher, size_t count, const uint8_t* nonces,
+                                          const size_t* lengths, const uint8_t* in, uint8_t* out) {
+    return cipher_batch(cipher, count, nonces, lengths, in, out, true);
+}
+
+// ============================================================================
+// Hash
+// ============================================================================
+
+rescue_status rescue_hasher_new(rescue_hasher** out) {
+    if (out == nullptr) {
+        return RESCUE_ERR_NULL_POINTER;
+    }
+    *out = nullptr;
+    return guarded([&] {
+        *out = new rescue_hasher{RescuePrimeHash()};
+        return RESCUE_OK;
+    });
+}
+
+void rescue_hasher_free(rescue_hasher* hasher) {
+    delete hasher;
+}
+
+rescue_status rescue_hash(const rescue_hasher* hasher, const uint8_t* in, size_t n_elements, uint8_t* out) {
+    return rescue_hash_batch(hasher, 1, &n_elements, in, out);
+}
+
+rescue_status rescue_hash_batch(const rescue_hasher* hasher, size_t count, const size_t* lengths,
+                                const uint8_t* in, uint8_t* out) {
+    if (hasher == nullptr || (count > 0 && (lengths == nullptr || out == nullptr))) {
+        return RESCUE_ERR_NULL_POINTER;
+    }
+    return guarded([&] {
+        size_t total = total_elements(count, lengths);
+        if (total > 0 && in == nullptr) {
+            return RESCUE_ERR_NULL_POINTER;
+        }
+        require_canonical(in, total);
+
+        // Decode every message, then absorb them all in lockstep
+        std::vector<std::vector<Fp>> messages(count);
+        size_t offset = 0;
+        for (size_t i = 0; i < count; ++i) {
+            messages[i].reserve(lengths[i]);
+            for (size_t e = 0; e < lengths[i]; ++e, offset += RESCUE_C_ELEMENT_SIZE) {
+                messages[i].push_back(read_element(in + offset));
+            }
+        }
+        const auto digests = hasher->hash.digest_batch(messages);
+        for (size_t i = 0; i < count; ++i) {
+            for (size_t d = 0; d < RESCUE_C_DIGEST_ELEMENTS; ++d) {
+                write_element(digests[i][d], out + (i * RESCUE_C_DIGEST_ELEMENTS + d) * RESCUE_C_ELEMENT_SIZE);
+            }
+        }
+        return RESCUE_OK;
+    });
+}
+
+}  // extern "C"
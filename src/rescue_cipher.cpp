@@ -1,6 +1,9 @@
 #include <rescue/rescue_cipher.hpp>
 
+#include "probes.hpp"
+
 #include <rescue/matrix.hpp>
+#include <rescue/metrics.hpp>
 #include <rescue/utils.hpp>
 
 #include <algorithm>
@@ -8,46 +11,71 @@
 
 namespace rescue {
 
-RescueCipher::RescueCipher(std::span<const uint8_t, RESCUE_CIPHER_SECRET_SIZE> shared_secret)
-    : desc_(derive_key(shared_secret)) {}
+template <size_t M>
+BasicRescueCipher<M>::BasicRescueCipher(std::span<const uint8_t, RESCUE_CIPHER_SECRET_SIZE> shared_secret)
+    : desc_(derive_key(shared_secret)) {
+    metrics::add(metrics::Counter::CIPHER_CONSTRUCTIONS);
+    RESCUE_PROBE1(cipher__construct__done, M);
+}
 
-RescueCipher::RescueCipher(const std::vector<uint8_t>& shared_secret)
+template <size_t M>
+BasicRescueCipher<M>::BasicRescueCipher(const std::vector<uint8_t>& shared_secret)
     : desc_(derive_key(shared_secret)) {
     if (shared_secret.size() != RESCUE_CIPHER_SECRET_SIZE) {
         throw std::invalid_argument("Shared secret must be " +
                                     std::to_string(RESCUE_CIPHER_SECRET_SIZE) + " bytes");
     }
+    metrics::add(metrics::Counter::CIPHER_CONSTRUCTIONS);
+    RESCUE_PROBE1(cipher__construct__done, M);
 }
 
-RescueCipher::RescueCipher(const std::array<uint8_t, RESCUE_CIPHER_SECRET_SIZE>& shared_secret)
-    : desc_(derive_key(std::span<const uint8_t>(shared_secret.data(), shared_secret.size()))) {}
+template <size_t M>
+BasicRescueCipher<M>::BasicRescueCipher(const std::array<uint8_t, RESCUE_CIPHER_SECRET_SIZE>& shared_secret)
+    : desc_(derive_key(std::span<const uint8_t>(shared_secret.data(), shared_secret.size()))) {
+    metrics::add(metrics::Counter::CIPHER_CONSTRUCTIONS);
+    RESCUE_PROBE1(cipher__construct__done, M);
+}
 
-std::vector<Fp> RescueCipher::derive_key(std::span<const uint8_t> shared_secret) {
+template <size_t M>
+std::vector<Fp> BasicRescueCipher<M>::derive_key(std::span<const uint8_t> shared_secret) {
+    // Every constructor derives the key first, so construction starts here
+    RESCUE_PROBE1(cipher__construct__start, M);
     if (shared_secret.size() != RESCUE_CIPHER_SECRET_SIZE) {
         throw std::invalid_argument("Shared secret must be " +
                                     std::to_string(RESCUE_CIPHER_SECRET_SIZE) + " bytes");
     }
 
+    metrics::ScopedTimer timer(metrics::Phase::KEY_DERIVATION);
     RescuePrimeHash hasher;
 
     // Convert shared secret to field element
     // For Curve25519 base field, we can fit 32 bytes in one field element
     uint256 secret_value = deserialize_le(shared_secret);
 
-    // Build the counter || Z || FixedInfo vector per NIST SP 800-56C Option 1
-    // counter = 1 (we only need one iteration since reps = 1)
-    // Z = shared_secret
-    // FixedInfo = L = RESCUE_CIPHER_BLOCK_SIZE
-    std::vector<Fp> kdf_input;
-    kdf_input.emplace_back(uint64_t{1});  // counter
-    kdf_input.emplace_back(secret_value);  // Z (shared secret)
-    kdf_input.emplace_back(uint64_t{RESCUE_CIPHER_BLOCK_SIZE});  // FixedInfo (L)
-
-    // Hash to derive key
-    return hasher.digest(kdf_input);
+    // Per NIST SP 800-56C Option 1, hash counter || Z || FixedInfo for
+    // counter = 1..reps and concatenate the outputs until L = M elements.
+    // Z = shared_secret, FixedInfo = L. For M = 5 a single repetition is used.
+    const size_t reps = (M + hasher.digest_length() - 1) / hasher.digest_length();
+
+    std::vector<Fp> key;
+    key.reserve(reps * hasher.digest_length());
+
+    for (size_t counter = 1; counter <= reps; ++counter) {
+        std::vector<Fp> kdf_input;
+        kdf_input.emplace_back(uint64_t{counter});  // counter
+        kdf_input.emplace_back(secret_value);       // Z (shared secret)
+        kdf_input.emplace_back(uint64_t{M});        // FixedInfo (L)
+
+        auto block = hasher.digest(kdf_input);
+        key.insert(key.end(), block.begin(), block.end());
+    }
+
+    key.resize(M);
+    return key;
 }
 
-std::vector<std::vector<uint8_t>> RescueCipher::encrypt(
+template <size_t M>
+std::vector<std::vector<uint8_t>> BasicRescueCipher<M>::encrypt(
     const std::vector<Fp>& plaintext,
     std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE> nonce) const {
 
@@ -64,7 +92,8 @@ std::vector<std::vector<uint8_t>> RescueCipher::encrypt(
     return result;
 }
 
-std::vector<Fp> RescueCipher::decrypt(
+template <size_t M>
+std::vector<Fp> BasicRescueCipher<M>::decrypt(
     const std::vector<std::vector<uint8_t>>& ciphertext,
     std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE> nonce) const {
 
@@ -82,7 +111,8 @@ std::vector<Fp> RescueCipher::decrypt(
     return decrypt_raw(raw_ciphertext, nonce);
 }
 
-std::vector<Fp> RescueCipher::encrypt_raw(
+template <size_t M>
+std::vector<Fp> BasicRescueCipher<M>::encrypt_raw(
     const std::vector<Fp>& plaintext,
     std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE> nonce) const {
 
@@ -90,9 +120,12 @@ std::vector<Fp> RescueCipher::encrypt_raw(
         return {};
     }
 
+    metrics::ScopedTimer timer(metrics::Phase::ENCRYPTION);
+    metrics::add(metrics::Counter::ELEMENTS_ENCRYPTED, plaintext.size());
+    RESCUE_PROBE2(encrypt__start, M, plaintext.size());
+
     // Calculate number of blocks needed
-    size_t n_blocks =
-        (plaintext.size() + RESCUE_CIPHER_BLOCK_SIZE - 1) / RESCUE_CIPHER_BLOCK_SIZE;
+    size_t n_blocks = (plaintext.size() + M - 1) / M;
 
     // Generate counter values
     uint256 nonce_value = deserialize_le(nonce);
@@ -103,21 +136,17 @@ std::vector<Fp> RescueCipher::encrypt_raw(
 
     for (size_t block = 0; block < n_blocks; ++block) {
         // Extract counter for this block
-        std::vector<Fp> block_counter;
-        block_counter.reserve(RESCUE_CIPHER_BLOCK_SIZE);
-        size_t counter_offset = block * RESCUE_CIPHER_BLOCK_SIZE;
-        for (size_t i = 0; i < RESCUE_CIPHER_BLOCK_SIZE; ++i) {
-            block_counter.push_back(counter[counter_offset + i]);
-        }
+        Block encrypted_counter_data;
+        size_t counter_offset = block * M;
+        std::copy_n(counter.begin() + static_cast<std::ptrdiff_t>(counter_offset), M,
+                    encrypted_counter_data.begin());
 
         // Encrypt the counter
-        Matrix counter_vec(block_counter);
-        Matrix encrypted_counter = desc_.permute(counter_vec);
-        auto encrypted_counter_data = encrypted_counter.to_vector();
+        desc_.permute_in_place(encrypted_counter_data);
 
         // XOR (field addition) with plaintext
-        size_t block_start = block * RESCUE_CIPHER_BLOCK_SIZE;
-        size_t block_end = std::min(block_start + RESCUE_CIPHER_BLOCK_SIZE, plaintext.size());
+        size_t block_start = block * M;
+        size_t block_end = std::min(block_start + M, plaintext.size());
 
         for (size_t i = block_start; i < block_end; ++i) {
             size_t idx = i - block_start;
@@ -126,10 +155,12 @@ std::vector<Fp> RescueCipher::encrypt_raw(
         }
     }
 
+    RESCUE_PROBE2(encrypt__done, M, plaintext.size());
     return ciphertext;
 }
 
-std::vector<Fp> RescueCipher::decrypt_raw(
+template <size_t M>
+std::vector<Fp> BasicRescueCipher<M>::decrypt_raw(
     const std::vector<Fp>& ciphertext,
     std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE> nonce) const {
 
@@ -137,9 +168,12 @@ std::vector<Fp> RescueCipher::decrypt_raw(
         return {};
     }
 
+    metrics::ScopedTimer timer(metrics::Phase::DECRYPTION);
+    metrics::add(metrics::Counter::ELEMENTS_DECRYPTED, ciphertext.size());
+    RESCUE_PROBE2(decrypt__start, M, ciphertext.size());
+
     // Calculate number of blocks needed
-    size_t n_blocks =
-        (ciphertext.size() + RESCUE_CIPHER_BLOCK_SIZE - 1) / RESCUE_CIPHER_BLOCK_SIZE;
+    size_t n_blocks = (ciphertext.size() + M - 1) / M;
 
     // Generate counter values
     uint256 nonce_value = deserialize_le(nonce);
@@ -150,21 +184,17 @@ std::vector<Fp> RescueCipher::decrypt_raw(
 
     for (size_t block = 0; block < n_blocks; ++block) {
         // Extract counter for this block
-        std::vector<Fp> block_counter;
-        block_counter.reserve(RESCUE_CIPHER_BLOCK_SIZE);
-        size_t counter_offset = block * RESCUE_CIPHER_BLOCK_SIZE;
-        for (size_t i = 0; i < RESCUE_CIPHER_BLOCK_SIZE; ++i) {
-            block_counter.push_back(counter[counter_offset + i]);
-        }
+        Block encrypted_counter_data;
+        size_t counter_offset = block * M;
+        std::copy_n(counter.begin() + static_cast<std::ptrdiff_t>(counter_offset), M,
+                    encrypted_counter_data.begin());
 
         // Encrypt the counter (same as encryption - CTR mode is symmetric)
-        Matrix counter_vec(block_counter);
-        Matrix encrypted_counter = desc_.permute(counter_vec);
-        auto encrypted_counter_data = encrypted_counter.to_vector();
+        desc_.permute_in_place(encrypted_counter_data);
 
         // XOR (field subtraction) with ciphertext
-        size_t block_start = block * RESCUE_CIPHER_BLOCK_SIZE;
-        size_t block_end = std::min(block_start + RESCUE_CIPHER_BLOCK_SIZE, ciphertext.size());
+        size_t block_start = block * M;
+        size_t block_end = std::min(block_start + M, ciphertext.size());
 
         for (size_t i = block_start; i < block_end; ++i) {
             size_t idx = i - block_start;
@@ -173,12 +203,133 @@ std::vector<Fp> RescueCipher::decrypt_raw(
         }
     }
 
+    RESCUE_PROBE2(decrypt__done, M, ciphertext.size());
     return plaintext;
 }
 
-std::vector<Fp> RescueCipher::generate_counter(const uint256& nonce, size_t n_blocks) const {
+template <size_t M>
+std::vector<Fp> BasicRescueCipher<M>::encrypt_raw(
+    const std::vector<Fp>& plaintext,
+    std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE> nonce,
+    Executor& executor) const {
+
+    if (plaintext.empty()) {
+        return {};
+    }
+
+    metrics::ScopedTimer timer(metrics::Phase::ENCRYPTION);
+    metrics::add(metrics::Counter::ELEMENTS_ENCRYPTED, plaintext.size());
+    RESCUE_PROBE2(encrypt__start, M, plaintext.size());
+    auto ciphertext = apply_keystream(plaintext, nonce, false, executor);
+    RESCUE_PROBE2(encrypt__done, M, plaintext.size());
+    return ciphertext;
+}
+
+template <size_t M>
+std::vector<Fp> BasicRescueCipher<M>::decrypt_raw(
+    const std::vector<Fp>& ciphertext,
+    std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE> nonce,
+    Executor& executor) const {
+
+    if (ciphertext.empty()) {
+        return {};
+    }
+
+    metrics::ScopedTimer timer(metrics::Phase::DECRYPTION);
+    metrics::add(metrics::Counter::ELEMENTS_DECRYPTED, ciphertext.size());
+    RESCUE_PROBE2(decrypt__start, M, ciphertext.size());
+    auto plaintext = apply_keystream(ciphertext, nonce, true, executor);
+    RESCUE_PROBE2(decrypt__done, M, ciphertext.size());
+    return plaintext;
+}
+
+template <size_t M>
+std::vector<Fp> BasicRescueCipher<M>::apply_keystream(
+    const std::vector<Fp>& data,
+    std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE> nonce,
+    bool subtract,
+    Executor& executor) const {
+
+    const size_t n_blocks = (data.size() + M - 1) / M;
+    const auto counter = generate_counter(deserialize_le(nonce), n_blocks);
+
+    // Every block writes its own slice of the presized output
+    std::vector<Fp> out(data.size());
+    executor.parallel_for(n_blocks, [&](size_t block) {
+        Block keystream;
+        const size_t block_start = block * M;
+        std::copy_n(counter.begin() + static_cast<std::ptrdiff_t>(block_start), M, keystream.begin());
+        desc_.permute_in_place(keystream);
+
+        const size_t block_end = std::min(block_start + M, data.size());
+        for (size_t i = block_start; i < block_end; ++i) {
+            out[i] = subtract ? data[i] - keystream[i - block_start] : data[i] + keystream[i - block_start];
+        }
+    });
+    return out;
+}
+
+template <size_t M>
+typename BasicRescueCipher<M>::Block BasicRescueCipher<M>::encrypt_block(const Block& block) const {
+    Block result = block;
+    desc_.permute_in_place(result);
+    return result;
+}
+
+template <size_t M>
+typename BasicRescueCipher<M>::Block BasicRescueCipher<M>::decrypt_block(const Block& block) const {
+    Block result = block;
+    desc_.permute_inverse_in_place(result);
+    return result;
+}
+
+template <size_t M>
+void BasicRescueCipher<M>::encrypt_blocks(std::span<const Block> in, std::span<Block> out) const {
+    if (in.size() != out.size()) {
+        throw std::invalid_argument("Input and output block counts must match");
+    }
+    static_assert(sizeof(Block) == M * sizeof(Fp), "Blocks must be contiguous field elements");
+    if (in.empty()) {
+        return;
+    }
+    if (in.data() != out.data()) {
+        std::copy(in.begin(), in.end(), out.begin());
+    }
+    // Every block is one lane of a single lockstep pass
+    desc_.permute_many(std::span<Fp>(out.front().data(), out.size() * M));
+}
+
+template <size_t M>
+void BasicRescueCipher<M>::decrypt_blocks(std::span<const Block> in, std::span<Block> out) const {
+    if (in.size() != out.size()) {
+        throw std::invalid_argument("Input and output block counts must match");
+    }
+    for (size_t i = 0; i < in.size(); ++i) {
+        out[i] = in[i];
+        desc_.permute_inverse_in_place(out[i]);
+    }
+}
+
+template <size_t M>
+std::vector<typename BasicRescueCipher<M>::Block> BasicRescueCipher<M>::encrypt_blocks(
+    std::span<const Block> in) const {
+    std::vector<Block> out(in.size());
+    encrypt_blocks(in, out);
+    return out;
+}
+
+template <size_t M>
+std::vector<typename BasicRescueCipher<M>::Block> BasicRescueCipher<M>::decrypt_blocks(
+    std::span<const Block> in) const {
+    std::vector<Block> out(in.size());
+    decrypt_blocks(in, out);
+    return out;
+}
+
+template <size_t M>
+std::vector<Fp> BasicRescueCipher<M>::generate_counter(const uint256& nonce, size_t n_blocks) const {
     std::vector<Fp> counter;
-    counter.reserve(n_blocks * RESCUE_CIPHER_BLOCK_SIZE);
+    counter.reserve(n_blocks * M);
 
     for (size_t block = 0; block < n_blocks; ++block) {
         // Counter format: [nonce, block_index, 0, 0, ...]
@@ -186,7 +337,7 @@ std::vector<Fp> RescueCipher::generate_counter(const uint256& nonce, size_t n_bl
         counter.emplace_back(uint64_t{block});
 
         // Pad to block size
-        for (size_t j = 2; j < RESCUE_CIPHER_BLOCK_SIZE; ++j) {
+        for (size_t j = 2; j < M; ++j) {
             counter.push_back(Fp::ZERO);
         }
     }
@@ -194,11 +345,12 @@ std::vector<Fp> RescueCipher::generate_counter(const uint256& nonce, size_t n_bl
     return counter;
 }
 
-std::vector<Fp> RescueCipher::process_block(const std::vector<Fp>& data,
+template <size_t M>
+std::vector<Fp> BasicRescueCipher<M>::process_block(const std::vector<Fp>& data,
                                              const std::vector<Fp>& counter) const {
-    if (counter.size() != RESCUE_CIPHER_BLOCK_SIZE) {
+    if (counter.size() != M) {
         throw std::invalid_argument("Counter must have " +
-                                    std::to_string(RESCUE_CIPHER_BLOCK_SIZE) + " elements");
+                                    std::to_string(M) + " elements");
     }
 
     Matrix counter_vec(counter);
@@ -217,7 +369,8 @@ std::vector<Fp> RescueCipher::process_block(const std::vector<Fp>& data,
 
 // Convenience overloads
 
-std::vector<std::vector<uint8_t>> RescueCipher::encrypt(
+template <size_t M>
+std::vector<std::vector<uint8_t>> BasicRescueCipher<M>::encrypt(
     const std::vector<Fp>& plaintext,
     const std::vector<uint8_t>& nonce) const {
     if (nonce.size() != RESCUE_CIPHER_NONCE_SIZE) {
@@ -229,7 +382,8 @@ std::vector<std::vector<uint8_t>> RescueCipher::encrypt(
     return encrypt(plaintext, std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE>(nonce_arr));
 }
 
-std::vector<Fp> RescueCipher::decrypt(
+template <size_t M>
+std::vector<Fp> BasicRescueCipher<M>::decrypt(
     const std::vector<std::vector<uint8_t>>& ciphertext,
     const std::vector<uint8_t>& nonce) const {
     if (nonce.size() != RESCUE_CIPHER_NONCE_SIZE) {
@@ -241,7 +395,8 @@ std::vector<Fp> RescueCipher::decrypt(
     return decrypt(ciphertext, std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE>(nonce_arr));
 }
 
-std::vector<Fp> RescueCipher::encrypt_raw(
+template <size_t M>
+std::vector<Fp> BasicRescueCipher<M>::encrypt_raw(
     const std::vector<Fp>& plaintext,
     const std::vector<uint8_t>& nonce) const {
     if (nonce.size() != RESCUE_CIPHER_NONCE_SIZE) {
@@ -253,7 +408,8 @@ std::vector<Fp> RescueCipher::encrypt_raw(
     return encrypt_raw(plaintext, std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE>(nonce_arr));
 }
 
-std::vector<Fp> RescueCipher::decrypt_raw(
+template <size_t M>
+std::vector<Fp> BasicRescueCipher<M>::decrypt_raw(
     const std::vector<Fp>& ciphertext,
     const std::vector<uint8_t>& nonce) const {
     if (nonce.size() != RESCUE_CIPHER_NONCE_SIZE) {
@@ -265,6 +421,11 @@ std::vector<Fp> RescueCipher::decrypt_raw(
     return decrypt_raw(ciphertext, std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE>(nonce_arr));
 }
 
+template class BasicRescueCipher<5>;
+template class BasicRescueCipher<8>;
+template class BasicRescueCipher<12>;
+template class BasicRescueCipher<16>;
+
 std::array<uint8_t, RESCUE_CIPHER_NONCE_SIZE> generate_nonce() {
     return random_bytes<RESCUE_CIPHER_NONCE_SIZE>();
 }
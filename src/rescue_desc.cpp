@@ -1,10 +1,16 @@
 #include <rescue/rescue_desc.hpp>
 
+#include "kernels.hpp"
+#include "probes.hpp"
+#include "rescue_generic.hpp"
+
 #include <rescue/detail/mds_precomputed.hpp>
+#include <rescue/metrics.hpp>
 #include <rescue/utils.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
-#include <sstream>
 #include <stdexcept>
 
 namespace rescue {
@@ -191,6 +197,24 @@ namespace {
     return old_s;
 }
 
+/**
+ * @brief Convert a precomputed MDS table into a Matrix.
+ */
+template <size_t N>
+[[nodiscard]] Matrix precomputed_mds_matrix(const std::array<std::array<uint256, N>, N>& table) {
+    std::vector<std::vector<Fp>> mds_data;
+    mds_data.reserve(N);
+    for (size_t i = 0; i < N; ++i) {
+        std::vector<Fp> row;
+        row.reserve(N);
+        for (size_t j = 0; j < N; ++j) {
+            row.emplace_back(table[i][j]);
+        }
+        mds_data.push_back(std::move(row));
+    }
+    return Matrix(mds_data);
+}
+
 }  // anonymous namespace
 
 // ============================================================================
@@ -212,107 +236,71 @@ RescueDesc::RescueDesc(size_t m, size_t capacity) : mode_(HashMode{m, capacity})
 }
 
 void RescueDesc::init_common() {
-    // Get alpha and alpha_inverse
-    auto [a, a_inv] = get_alpha_and_inverse(Fp::P);
-    alpha_ = a;
-    alpha_inverse_ = a_inv;
-
-    // Get number of rounds
-    n_rounds_ = get_n_rounds(mode_, alpha_, m_);
-
-    // Build MDS matrices - use precomputed if available
-    if (m_ == 5 && mds::HAS_PRECOMPUTED_MDS_5) {
-        // Use precomputed 5x5 MDS matrix for cipher mode
-        std::vector<std::vector<Fp>> mds_data;
-        mds_data.reserve(5);
-        for (size_t i = 0; i < 5; ++i) {
-            std::vector<Fp> row;
-            row.reserve(5);
-            for (size_t j = 0; j < 5; ++j) {
-                row.emplace_back(mds::MDS_5x5[i][j]);
-            }
-            mds_data.push_back(std::move(row));
-        }
-        mds_mat_ = Matrix(mds_data);
-        mds_mat_inverse_ = build_inverse_cauchy_matrix(m_);
-    } else if (m_ == 12 && mds::HAS_PRECOMPUTED_MDS_12) {
-        // Use precomputed 12x12 MDS matrix for hash mode
-        std::vector<std::vector<Fp>> mds_data;
-        mds_data.reserve(12);
-        for (size_t i = 0; i < 12; ++i) {
-            std::vector<Fp> row;
-            row.reserve(12);
-            for (size_t j = 0; j < 12; ++j) {
-                row.emplace_back(mds::MDS_12x12[i][j]);
-            }
-            mds_data.push_back(std::move(row));
+    {
+        metrics::ScopedTimer timer(metrics::Phase::ROUND_PARAMETERS);
+
+        // Get alpha and alpha_inverse
+        auto [a, a_inv] = get_alpha_and_inverse(Fp::P);
+        alpha_ = a;
+        alpha_inverse_ = a_inv;
+
+        // Get number of rounds
+        n_rounds_ = get_n_rounds(mode_, alpha_, m_);
+    }
+
+    {
+        metrics::ScopedTimer timer(metrics::Phase::MDS_SETUP);
+
+        // Build MDS matrices - use precomputed if available
+        if (m_ == 5 && mds::HAS_PRECOMPUTED_MDS_5) {
+            // Use precomputed 5x5 MDS matrix for cipher mode
+            mds_mat_ = precomputed_mds_matrix(mds::MDS_5x5);
+        } else if (m_ == 8 && mds::HAS_PRECOMPUTED_MDS_8) {
+            // Use precomputed 8x8 MDS matrix for wide cipher mode
+            mds_mat_ = precomputed_mds_matrix(mds::MDS_8x8);
+        } else if (m_ == 12 && mds::HAS_PRECOMPUTED_MDS_12) {
+            // Use precomputed 12x12 MDS matrix for hash mode
+            mds_mat_ = precomputed_mds_matrix(mds::MDS_12x12);
+        } else if (m_ == 16 && mds::HAS_PRECOMPUTED_MDS_16) {
+            // Use precomputed 16x16 MDS matrix for wide cipher mode
+            mds_mat_ = precomputed_mds_matrix(mds::MDS_16x16);
+        } else {
+            // Compute dynamically for non-standard sizes
+            mds_mat_ = build_cauchy_matrix(m_);
         }
-        mds_mat_ = Matrix(mds_data);
-        mds_mat_inverse_ = build_inverse_cauchy_matrix(m_);
-    } else {
-        // Compute dynamically for non-standard sizes
-        mds_mat_ = build_cauchy_matrix(m_);
         mds_mat_inverse_ = build_inverse_cauchy_matrix(m_);
     }
 
     // Sample round constants
-    auto round_constants = sample_constants();
+    std::vector<Matrix> round_constants;
+    {
+        metrics::ScopedTimer timer(metrics::Phase::CONSTANT_SAMPLING);
+        RESCUE_PROBE2(constants__sample__start, m_, n_rounds_);
+        round_constants = sample_constants();
+        RESCUE_PROBE2(constants__sample__done, m_, n_rounds_);
+    }
 
     // Compute round keys based on mode
     if (is_cipher()) {
+        metrics::ScopedTimer timer(metrics::Phase::KEY_SCHEDULE);
         const auto& cipher_mode = std::get<CipherMode>(mode_);
         Matrix key_vec(cipher_mode.key);
+        RESCUE_PROBE2(key__schedule__start, m_, n_rounds_);
         round_keys_ = compute_key_schedule(round_constants, key_vec);
+        RESCUE_PROBE2(key__schedule__done, m_, n_rounds_);
     } else {
         round_keys_ = std::move(round_constants);
     }
-}
 
-/**
- * @brief Convert a wide byte array (e.g., 48 bytes) to a field element.
- * 
- * This reads all bytes as a little-endian integer and reduces mod p.
- * This is necessary for proper interoperability with the JS library
- * which uses arbitrary-precision integers.
- */
-static Fp wide_bytes_to_fp(std::span<const uint8_t> bytes) {
-    // For 48 bytes = 384 bits, we need to reduce a value that could be up to 2^384
-    // We use the property: 2^255 ≡ 19 (mod p)
-    // 
-    // Split the input into: low 255 bits + high 129 bits
-    // result = low + high * 2^255 ≡ low + high * 19 (mod p)
-    
-    if (bytes.size() <= 32) {
-        // Short path: fits in uint256
-        return Fp(deserialize_le(bytes));
-    }
-    
-    // Read all bytes into limbs (up to 6 limbs for 48 bytes)
-    std::array<uint64_t, 8> wide_limbs = {0};
-    size_t n_limbs = (bytes.size() + 7) / 8;
-    if (n_limbs > 8) n_limbs = 8;
-    
-    for (size_t i = 0; i < bytes.size() && i < 64; ++i) {
-        wide_limbs[i / 8] |= static_cast<uint64_t>(bytes[i]) << ((i % 8) * 8);
-    }
-    
-    // Extract low 256 bits (4 limbs)
-    uint256 low{wide_limbs[0], wide_limbs[1], wide_limbs[2], wide_limbs[3]};
-    
-    // Extract high bits (remaining limbs)
-    uint256 high{wide_limbs[4], wide_limbs[5], 0, 0};
-    
-    // Reduce: low + high * 2^256
-    // Since 2^256 = 2 * 2^255 = 2 * 19 = 38 (mod p)
-    // result = low + high * 38 (mod p)
-    Fp result = Fp(low) + Fp(high) * Fp(uint64_t{38});
-    
-    return result;
+    // Transform round keys for the inverse permutation: M^(-1) * k
+    inverse_round_keys_.reserve(round_keys_.size());
+    for (const auto& key : round_keys_) {
+        inverse_round_keys_.push_back(mds_mat_inverse_.mat_mul(key));
+    }
 }
 
 std::vector<Matrix> RescueDesc::sample_constants() {
-    // Buffer length for field elements (add 16 bytes for uniform distribution)
-    size_t buffer_len = (Fp::BITS + 7) / 8 + 16;  // = 32 + 16 = 48 bytes
+    const size_t buffer_len = detail::sample_bytes<Fp>();  // 48 bytes
 
     if (is_cipher()) {
         // Cipher mode: sample matrix + vectors
@@ -329,8 +317,7 @@ std::vector<Matrix> RescueDesc::sample_constants() {
 
         for (size_t i = 0; i < n_elements; ++i) {
             std::span<const uint8_t> chunk(randomness.data() + i * buffer_len, buffer_len);
-            // Use wide_bytes_to_fp to properly handle 48-byte values
-            r_field_array.push_back(wide_bytes_to_fp(chunk));
+            r_field_array.push_back(detail::wide_bytes_to_field<Fp>(chunk));
         }
 
         // Create matrix and vectors
@@ -373,8 +360,7 @@ std::vector<Matrix> RescueDesc::sample_constants() {
                 for (size_t j = 0; j < m_; ++j) {
                     size_t offset = (i * m_ + j) * buffer_len;
                     std::span<const uint8_t> chunk(new_random.data() + offset, buffer_len);
-                    // Use wide_bytes_to_fp for consistency
-                    row.push_back(wide_bytes_to_fp(chunk));
+                    row.push_back(detail::wide_bytes_to_field<Fp>(chunk));
                 }
                 mat_data.push_back(std::move(row));
             }
@@ -394,36 +380,18 @@ std::vector<Matrix> RescueDesc::sample_constants() {
         return round_constants;
 
     } else {
-        // Hash mode
+        // Hash mode: a zero vector first (Algorithm 3 from the paper), then
+        // the sampled constants
         const auto& hash_mode = std::get<HashMode>(mode_);
+        const auto sampled =
+            detail::sample_hash_constants<Fp>(m_, hash_mode.capacity, SECURITY_LEVEL_HASH_FUNCTION, n_rounds_);
 
-        std::ostringstream seed_str;
-        seed_str << "Rescue-XLIX(" << Fp::P.to_string() << "," << m_ << ","
-                 << hash_mode.capacity << "," << SECURITY_LEVEL_HASH_FUNCTION << ")";
-
-        Shake256 hasher;
-        hasher.update(seed_str.str());
-
-        // Prepend a zero matrix (for Algorithm 3 from the paper)
         std::vector<Matrix> round_constants;
         round_constants.reserve(2 * n_rounds_ + 1);
-
-        std::vector<Fp> zeros(m_, Fp::ZERO);
-        round_constants.emplace_back(zeros);
-
-        size_t n_elements = 2 * m_ * n_rounds_;
-        auto randomness = hasher.finalize(n_elements * buffer_len);
-
+        round_constants.emplace_back(std::vector<Fp>(m_, Fp::ZERO));
         for (size_t r = 0; r < 2 * n_rounds_; ++r) {
-            std::vector<Fp> data;
-            data.reserve(m_);
-            for (size_t i = 0; i < m_; ++i) {
-                size_t offset = (r * m_ + i) * buffer_len;
-                std::span<const uint8_t> chunk(randomness.data() + offset, buffer_len);
-                // Use wide_bytes_to_fp to properly handle 48-byte values
-                data.push_back(wide_bytes_to_fp(chunk));
-            }
-            round_constants.emplace_back(std::move(data));
+            const auto first = sampled.begin() + static_cast<std::ptrdiff_t>(r * m_);
+            round_constants.emplace_back(std::vector<Fp>(first, first + static_cast<std::ptrdiff_t>(m_)));
         }
 
         return round_constants;
@@ -436,14 +404,21 @@ std::vector<Matrix> RescueDesc::compute_key_schedule(const std::vector<Matrix>&
 }
 
 Matrix RescueDesc::permute(const Matrix& state) const {
-    auto states = rescue_permutation(mode_, alpha_, alpha_inverse_, mds_mat_, round_keys_, state);
-    return states[2 * n_rounds_];
+    if (state.rows() != m_ || state.cols() != 1) {
+        throw std::invalid_argument("State must be a column vector of size m");
+    }
+    std::vector<Fp> data = state.data();
+    permute_in_place(data);
+    return Matrix(data);
 }
 
 Matrix RescueDesc::permute_inverse(const Matrix& state) const {
-    auto states = rescue_permutation_inverse(mode_, alpha_, alpha_inverse_, mds_mat_inverse_,
-                                             round_keys_, state);
-    return states[2 * n_rounds_];
+    if (state.rows() != m_ || state.cols() != 1) {
+        throw std::invalid_argument("State must be a column vector of size m");
+    }
+    std::vector<Fp> data = state.data();
+    permute_inverse_in_place(data);
+    return Matrix(data);
 }
 
 // ============================================================================
@@ -475,22 +450,28 @@ std::pair<uint256, uint256> get_alpha_and_inverse(const uint256& p) {
 }
 
 size_t get_n_rounds(const RescueMode& mode, const uint256& alpha, size_t m) {
-    double log2_p = static_cast<double>(Fp::P.bit_length());
+    const bool cipher = std::holds_alternative<CipherMode>(mode);
+    return get_n_rounds(mode, alpha, m, Fp::P.bit_length(),
+                        cipher ? SECURITY_LEVEL_BLOCK_CIPHER : SECURITY_LEVEL_HASH_FUNCTION);
+}
+
+size_t get_n_rounds(const RescueMode& mode, const uint256& alpha, size_t m, size_t field_bits,
+                    size_t security_level) {
+    double log2_p = static_cast<double>(field_bits);
     double alpha_d = static_cast<double>(alpha.limb(0));  // Alpha is small, fits in one limb
+    double security_d = static_cast<double>(security_level);
 
     if (std::holds_alternative<CipherMode>(mode)) {
         // Block cipher rounds calculation
-        double l0_d = (2.0 * SECURITY_LEVEL_BLOCK_CIPHER) /
+        double l0_d = (2.0 * security_d) /
                       ((static_cast<double>(m) + 1.0) * (log2_p - std::log2(alpha_d - 1.0)));
         size_t l0 = static_cast<size_t>(std::ceil(l0_d));
 
         size_t l1;
         if (alpha.limb(0) == 3) {
-            l1 = static_cast<size_t>(
-                std::ceil((SECURITY_LEVEL_BLOCK_CIPHER + 2.0) / (4.0 * static_cast<double>(m))));
+            l1 = static_cast<size_t>(std::ceil((security_d + 2.0) / (4.0 * static_cast<double>(m))));
         } else {
-            l1 = static_cast<size_t>(
-                std::ceil((SECURITY_LEVEL_BLOCK_CIPHER + 3.0) / (5.5 * static_cast<double>(m))));
+            l1 = static_cast<size_t>(std::ceil((security_d + 3.0) / (5.5 * static_cast<double>(m))));
         }
 
         return 2 * std::max({l0, l1, size_t{5}});
@@ -508,7 +489,9 @@ size_t get_n_rounds(const RescueMode& mode, const uint256& alpha, size_t m) {
 
         auto v_func = [&](size_t n) -> size_t { return m * (n - 1) + rate; };
 
-        uint256 target = uint256::one() << SECURITY_LEVEL_HASH_FUNCTION;
+        // 2^256 does not fit a uint256 and the shift yields 0, so 256-bit
+        // instances stop at the 5-round floor. Existing digests depend on it.
+        uint256 target = uint256::one() << security_level;
 
         size_t l1 = 1;
         uint256 tmp = binomial(v_func(l1) + dcon(l1), v_func(l1));
@@ -673,6 +656,8 @@ std::vector<Matrix> rescue_permutation(const RescueMode& mode,
                                        const Matrix& mds_mat,
                                        const std::vector<Matrix>& subkeys,
                                        const Matrix& state) {
+    metrics::add(metrics::Counter::PERMUTATIONS);
+
     uint256 exp_even = exponent_for_even(mode, alpha, alpha_inverse);
     uint256 exp_odd = exponent_for_odd(mode, alpha, alpha_inverse);
 
@@ -705,6 +690,8 @@ std::vector<Matrix> rescue_permutation_inverse(const RescueMode& mode,
                                                 const Matrix& mds_mat_inverse,
                                                 const std::vector<Matrix>& subkeys,
                                                 const Matrix& state) {
+    metrics::add(metrics::Counter::PERMUTATIONS);
+
     uint256 exp_even = exponent_for_even(mode, alpha, alpha_inverse);
     uint256 exp_odd = exponent_for_odd(mode, alpha, alpha_inverse);
 
@@ -735,4 +722,126 @@ std::vector<Matrix> rescue_permutation_inverse(const RescueMode& mode,
     return states;
 }
 
+void RescueDesc::permute_in_place(std::span<Fp> state) const {
+    if (state.size() != m_) {
+        throw std::invalid_argument("State must have " + std::to_string(m_) + " elements");
+    }
+    metrics::add(metrics::Counter::PERMUTATIONS);
+
+    uint256 exp_even = exponent_for_even(mode_, alpha_, alpha_inverse_);
+    uint256 exp_odd = exponent_for_odd(mode_, alpha_, alpha_inverse_);
+
+    std::array<Fp, detail::INLINE_STATE_SIZE> inline_buf;
+    std::vector<Fp> heap_buf;
+    std::span<Fp> tmp;
+    if (m_ <= detail::INLINE_STATE_SIZE) {
+        tmp = std::span<Fp>(inline_buf.data(), m_);
+    } else {
+        heap_buf.resize(m_);
+        tmp = heap_buf;
+    }
+
+    // One lane of the dispatched round loop (see kernels.cpp)
+    kernels::permutation()({m_, round_keys_, mds_mat_, exp_even, exp_odd}, state, tmp);
+}
+
+void RescueDesc::permute_many(std::span<Fp> states) const {
+    if (states.size() % m_ != 0) {
+        throw std::invalid_argument("States must be a multiple of " + std::to_string(m_) + " elements");
+    }
+    const size_t lanes = states.size() / m_;
+    metrics::add(metrics::Counter::PERMUTATIONS, lanes);
+
+    uint256 exp_even = exponent_for_even(mode_, alpha_, alpha_inverse_);
+    uint256 exp_odd = exponent_for_odd(mode_, alpha_, alpha_inverse_);
+
+    std::array<Fp, detail::INLINE_STATE_SIZE> inline_buf;
+    std::vector<Fp> heap_buf;
+    std::span<Fp> tmp;
+    if (m_ <= detail::INLINE_STATE_SIZE) {
+        tmp = std::span<Fp>(inline_buf.data(), m_);
+    } else {
+        heap_buf.resize(m_);
+        tmp = heap_buf;
+    }
+
+    // Lockstep over all lanes, one S-box call per round for every lane
+    kernels::permutation()({m_, round_keys_, mds_mat_, exp_even, exp_odd}, states, tmp);
+}
+
+void RescueDesc::permute_inverse_in_place(std::span<Fp> state) const {
+    if (state.size() != m_) {
+        throw std::invalid_argument("State must have " + std::to_string(m_) + " elements");
+    }
+    metrics::add(metrics::Counter::PERMUTATIONS);
+
+    uint256 exp_even = exponent_for_even(mode_, alpha_, alpha_inverse_);
+    uint256 exp_odd = exponent_for_odd(mode_, alpha_, alpha_inverse_);
+
+    std::array<Fp, detail::INLINE_STATE_SIZE> inline_buf;
+    std::vector<Fp> heap_buf;
+    std::span<Fp> tmp;
+    if (m_ <= detail::INLINE_STATE_SIZE) {
+        tmp = std::span<Fp>(inline_buf.data(), m_);
+    } else {
+        heap_buf.resize(m_);
+        tmp = heap_buf;
+    }
+
+    const kernels::SboxFn apply_sbox = kernels::sbox();
+    const kernels::MdsFn mat_vec = kernels::mds();
+    const size_t last = inverse_round_keys_.size() - 1;
+    for (size_t r = 0; r < last; ++r) {
+        // M^(-1) * (s - k) = M^(-1) * s - (M^(-1) * k)
+        mat_vec(mds_mat_inverse_, state, tmp);
+        const auto& key = inverse_round_keys_[last - r].data();
+        for (size_t i = 0; i < m_; ++i) {
+            state[i] = tmp[i] - key[i];
+        }
+
+        apply_sbox(state, r % 2 == 0 ? exp_even : exp_odd);
+    }
+
+    // Final step: subtract first round key
+    const auto& k0 = round_keys_[0].data();
+    for (size_t i = 0; i < m_; ++i) {
+        state[i] -= k0[i];
+    }
+}
+
+void RescueDesc::permute_traced(std::span<Fp> state, std::span<Fp> trace) const {
+    if (state.size() != m_ || trace.size() != trace_rows() * m_) {
+        throw std::invalid_argument("State must have " + std::to_string(m_) + " elements and trace " +
+                                    std::to_string(trace_rows() * m_));
+    }
+    metrics::add(metrics::Counter::PERMUTATIONS);
+
+    uint256 exp_even = exponent_for_even(mode_, alpha_, alpha_inverse_);
+    uint256 exp_odd = exponent_for_odd(mode_, alpha_, alpha_inverse_);
+    auto row = [&](size_t r) { return trace.subspan(r * m_, m_); };
+    const kernels::SboxFn apply_sbox = kernels::sbox();
+    const kernels::MdsFn mat_vec = kernels::mds();
+
+    std::copy(state.begin(), state.end(), row(0).begin());
+
+    const auto& k0 = round_keys_[0].data();
+    for (size_t i = 0; i < m_; ++i) {
+        state[i] += k0[i];
+    }
+    std::copy(state.begin(), state.end(), row(1).begin());
+
+    for (size_t r = 0; r + 1 < round_keys_.size(); ++r) {
+        std::span<Fp> sbox = row(2 * r + 2);
+        std::copy(state.begin(), state.end(), sbox.begin());
+        apply_sbox(sbox, r % 2 == 0 ? exp_even : exp_odd);
+
+        mat_vec(mds_mat_, sbox, state);
+        const auto& key = round_keys_[r + 1].data();
+        for (size_t i = 0; i < m_; ++i) {
+            state[i] += key[i];
+        }
+        std::copy(state.begin(), state.end(), row(2 * r + 3).begin());
+    }
+}
+
 }  // namespace rescue
@@ -0,0 +1,208 @@
+#pragma once
+
+/**
+ * @file rescue_generic.hpp
+ * @brief Field-generic Rescue building blocks (library internal).
+ *
+ * The round loop, hash-mode constant sampling and sponge padding, shared by
+ * RescueDesc and RescuePrimeHash over Fp and by BasicRescuePrime over any
+ * field. F needs the operations listed in <rescue/rescue_prime.hpp>.
+ */
+
+#include <rescue/field.hpp>
+#include <rescue/utils.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <sstream>
+#include <vector>
+
+namespace rescue::detail {
+
+/// States up to this size use a stack buffer for the mat-vec temporary
+constexpr size_t INLINE_STATE_SIZE = 16;
+
+// ============================================================================
+// Round loop
+// ============================================================================
+
+/**
+ * @brief out = mat * in, for a square row-major matrix of size in.size().
+ */
+template <typename F>
+inline void mat_vec(const F* mat, std::span<const F> in, std::span<F> out) {
+    const size_t m = in.size();
+    for (size_t i = 0; i < m; ++i) {
+        const F* row = mat + i * m;
+        F acc(uint64_t{0});
+        for (size_t j = 0; j < m; ++j) {
+            acc = acc + row[j] * in[j];
+        }
+        out[i] = acc;
+    }
+}
+
+/**
+ * @brief Forward Rescue rounds over states.size() / m lanes in lockstep.
+ *
+ * Adds round key 0, then for each later key r applies sbox(states, r - 1),
+ * the MDS product and key r. round_key(r) returns a pointer to m elements;
+ * the S-box is element-wise, so one call covers every lane. tmp holds m
+ * elements.
+ */
+template <typename F, typename RoundKey, typename Sbox>
+inline void permute_rounds(size_t m, size_t n_keys, RoundKey&& round_key, const F* mds, Sbox&& sbox,
+                           std::span<F> states, std::span<F> tmp) {
+    const size_t lanes = states.size() / m;
+
+    const F* k0 = round_key(size_t{0});
+    for (size_t lane = 0; lane < lanes; ++lane) {
+        for (size_t i = 0; i < m; ++i) {
+            states[lane * m + i] = states[lane * m + i] + k0[i];
+        }
+    }
+
+    for (size_t r = 0; r + 1 < n_keys; ++r) {
+        sbox(states, r);
+
+        const F* key = round_key(r + 1);
+        for (size_t lane = 0; lane < lanes; ++lane) {
+            std::span<F> state = states.subspan(lane * m, m);
+            mat_vec<F>(mds, state, tmp);
+            for (size_t i = 0; i < m; ++i) {
+                state[i] = tmp[i] + key[i];
+            }
+        }
+    }
+}
+
+// ============================================================================
+// Constant sampling
+// ============================================================================
+
+/**
+ * @brief Reduce a little-endian byte string of any length modulo p.
+ *
+ * Horner over 64-bit limbs, most significant first.
+ */
+template <typename F>
+F wide_bytes_to_field(std::span<const uint8_t> bytes) {
+    const F two_64(uint256(0, 1, 0, 0));
+    F acc(uint64_t{0});
+    const size_t n_limbs = (bytes.size() + 7) / 8;
+    for (size_t l = n_limbs; l-- > 0;) {
+        uint64_t limb = 0;
+        for (size_t b = 0; b < 8 && l * 8 + b < bytes.size(); ++b) {
+            limb |= static_cast<uint64_t>(bytes[l * 8 + b]) << (8 * b);
+        }
+        acc = acc * two_64 + F(limb);
+    }
+    return acc;
+}
+
+/**
+ * @brief 2^255 - 19, up to 64 bytes: low + high * 2^256, where 2^256 = 38 (mod p).
+ *
+ * Reads the bytes as one little-endian integer, as the JS library's
+ * arbitrary-precision reduction does.
+ */
+template <>
+inline Fp wide_bytes_to_field<Fp>(std::span<const uint8_t> bytes) {
+    if (bytes.size() <= 32) {
+        return Fp(deserialize_le(bytes));
+    }
+
+    std::array<uint64_t, 8> wide_limbs = {0};
+    for (size_t i = 0; i < bytes.size() && i < 64; ++i) {
+        wide_limbs[i / 8] |= static_cast<uint64_t>(bytes[i]) << ((i % 8) * 8);
+    }
+    uint256 low{wide_limbs[0], wide_limbs[1], wide_limbs[2], wide_limbs[3]};
+    uint256 high{wide_limbs[4], wide_limbs[5], 0, 0};
+    return Fp(low) + Fp(high) * Fp(uint64_t{38});
+}
+
+/**
+ * @brief Bytes of SHAKE256 output per sampled element.
+ *
+ * 16 bytes beyond the field size keep the reduction close to uniform.
+ */
+template <typename F>
+constexpr size_t sample_bytes() {
+    return (F::BITS + 7) / 8 + 16;
+}
+
+/**
+ * @brief Hash-mode round constants, sampled with SHAKE256 from "Rescue-XLIX(p,m,c,s)".
+ * @return 2 * n_rounds vectors of m elements, concatenated.
+ */
+template <typename F>
+std::vector<F> sample_hash_constants(size_t m, size_t capacity, size_t security_level, size_t n_rounds) {
+    const size_t buffer_len = sample_bytes<F>();
+
+    std::ostringstream seed_str;
+    seed_str << "Rescue-XLIX(" << F::P.to_string() << "," << m << "," << capacity << "," << security_level << ")";
+
+    Shake256 hasher;
+    hasher.update(seed_str.str());
+    const size_t n_elements = 2 * m * n_rounds;
+    auto randomness = hasher.finalize(n_elements * buffer_len);
+
+    std::vector<F> constants;
+    constants.reserve(n_elements);
+    for (size_t i = 0; i < n_elements; ++i) {
+        std::span<const uint8_t> chunk(randomness.data() + i * buffer_len, buffer_len);
+        constants.push_back(wide_bytes_to_field<F>(chunk));
+    }
+    return constants;
+}
+
+// ============================================================================
+// Sponge
+// ============================================================================
+
+/**
+ * @brief Blocks absorbed for a message of n elements.
+ *
+ * Padding appends a one, then zeros to a multiple of the rate.
+ */
+[[nodiscard]] constexpr size_t sponge_blocks(size_t n, size_t rate) {
+    return n / rate + 1;
+}
+
+/**
+ * @brief Add padded block `block` of message to the first rate elements of state.
+ */
+template <typename F>
+inline void absorb_block(std::span<const F> message, size_t block, size_t rate, std::span<F> state) {
+    for (size_t i = 0; i < rate; ++i) {
+        const size_t pos = block * rate + i;
+        if (pos < message.size()) {
+            state[i] = state[i] + message[pos];
+        } else if (pos == message.size()) {
+            state[i] = state[i] + F(uint64_t{1});
+        }
+    }
+}
+
+/**
+ * @brief Sponge digest: absorb every padded block, permuting after each.
+ *
+ * permute(state) permutes a state of m elements in place.
+ * @return The first digest_length state elements.
+ */
+template <typename F, typename Permute>
+std::vector<F> sponge_digest(std::span<const F> message, size_t rate, size_t m, size_t digest_length,
+                             Permute&& permute) {
+    std::vector<F> state(m, F(uint64_t{0}));
+    const size_t n_blocks = sponge_blocks(message.size(), rate);
+    for (size_t block = 0; block < n_blocks; ++block) {
+        absorb_block<F>(message, block, rate, state);
+        permute(std::span<F>(state));
+    }
+    state.resize(digest_length);
+    return state;
+}
+
+}  // namespace rescue::detail
@@ -1,7 +1,12 @@
 #include <rescue/rescue_hash.hpp>
 
-#include <rescue/matrix.hpp>
+#include "probes.hpp"
+#include "rescue_generic.hpp"
 
+#include <rescue/metrics.hpp>
+
+#include <algorithm>
+#include <numeric>
 #include <stdexcept>
 
 namespace rescue {
@@ -32,47 +37,14 @@ RescuePrimeHash::RescuePrimeHash(size_t rate, size_t capacity, size_t digest_len
 }
 
 std::vector<Fp> RescuePrimeHash::digest(const std::vector<Fp>& message) const {
-    // Apply padding: append 1, then zeros until length is multiple of rate
-    std::vector<Fp> padded_message = message;
-    padded_message.push_back(Fp::ONE);
-
-    while (padded_message.size() % rate_ != 0) {
-        padded_message.push_back(Fp::ZERO);
-    }
-
-    // Initialize state to all zeros
-    size_t m = desc_.m();
-    std::vector<Fp> state_vec(m, Fp::ZERO);
-    Matrix state(state_vec);
-
-    // Absorb phase: process message in rate-sized chunks
-    size_t n_blocks = padded_message.size() / rate_;
-    for (size_t block = 0; block < n_blocks; ++block) {
-        // Create absorption vector (rate elements + capacity zeros)
-        std::vector<Fp> absorb_vec;
-        absorb_vec.reserve(m);
-
-        for (size_t i = 0; i < rate_; ++i) {
-            absorb_vec.push_back(padded_message[block * rate_ + i]);
-        }
-        for (size_t i = rate_; i < m; ++i) {
-            absorb_vec.push_back(Fp::ZERO);
-        }
-
-        Matrix absorb(absorb_vec);
+    const size_t n_blocks = detail::sponge_blocks(message.size(), rate_);
+    metrics::add(metrics::Counter::HASH_BLOCKS_ABSORBED, n_blocks);
+    RESCUE_PROBE2(hash__digest__start, message.size(), n_blocks);
 
-        // Add to state and permute (using constant-time addition)
-        state = desc_.permute(state.add(absorb, true));
-    }
-
-    // Extract digest from state
-    auto state_data = state.to_vector();
-    std::vector<Fp> result;
-    result.reserve(digest_length_);
-    for (size_t i = 0; i < digest_length_; ++i) {
-        result.push_back(state_data[i]);
-    }
+    auto result = detail::sponge_digest<Fp>(message, rate_, desc_.m(), digest_length_,
+                                            [&](std::span<Fp> state) { desc_.permute_in_place(state); });
 
+    RESCUE_PROBE2(hash__digest__done, message.size(), n_blocks);
     return result;
 }
 
@@ -85,4 +57,51 @@ std::vector<Fp> RescuePrimeHash::digest(const std::vector<uint256>& message) con
     return digest(fp_message);
 }
 
+std::vector<std::vector<Fp>> RescuePrimeHash::digest_many(std::span<const std::vector<Fp>> messages,
+                                                          Executor& executor) const {
+    std::vector<std::vector<Fp>> digests(messages.size());
+    executor.parallel_for(messages.size(), [&](size_t i) { digests[i] = digest(messages[i]); });
+    return digests;
+}
+
+std::vector<std::vector<Fp>> RescuePrimeHash::digest_batch(std::span<const std::vector<Fp>> messages) const {
+    const size_t m = desc_.m();
+    auto n_blocks = [&](size_t lane) { return detail::sponge_blocks(messages[lane].size(), rate_); };
+
+    // Longest first, so the lanes still absorbing at any step are a prefix
+    std::vector<size_t> order(messages.size());
+    std::iota(order.begin(), order.end(), size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return n_blocks(a) > n_blocks(b); });
+
+    size_t total_blocks = 0;
+    for (size_t lane = 0; lane < messages.size(); ++lane) {
+        total_blocks += n_blocks(lane);
+    }
+    metrics::add(metrics::Counter::HASH_BLOCKS_ABSORBED, total_blocks);
+
+    std::vector<Fp> states(messages.size() * m, Fp::ZERO);
+    size_t active = order.size();
+    for (size_t block = 0;; ++block) {
+        while (active > 0 && n_blocks(order[active - 1]) <= block) {
+            --active;
+        }
+        if (active == 0) {
+            break;
+        }
+
+        for (size_t lane = 0; lane < active; ++lane) {
+            detail::absorb_block<Fp>(messages[order[lane]], block, rate_,
+                                     std::span<Fp>(states).subspan(lane * m, m));
+        }
+        desc_.permute_many(std::span<Fp>(states).first(active * m));
+    }
+
+    std::vector<std::vector<Fp>> digests(messages.size());
+    for (size_t lane = 0; lane < order.size(); ++lane) {
+        const auto first = states.begin() + static_cast<std::ptrdiff_t>(lane * m);
+        digests[order[lane]].assign(first, first + static_cast<std::ptrdiff_t>(digest_length_));
+    }
+    return digests;
+}
+
 }  // namespace rescue
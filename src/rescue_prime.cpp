@@ -0,0 +1,113 @@
+#include <rescue/rescue_prime.hpp>
+
+#include "rescue_generic.hpp"
+
+#include <rescue/metrics.hpp>
+#include <rescue/rescue_desc.hpp>
+
+#include <array>
+#include <stdexcept>
+#include <string>
+
+namespace rescue {
+
+// ============================================================================
+// BasicRescuePrime
+// ============================================================================
+
+template <typename F>
+BasicRescuePrime<F>::BasicRescuePrime(size_t m, size_t capacity, size_t security_level)
+    : m_(m), capacity_(capacity), security_level_(security_level) {
+    if (capacity == 0 || m <= capacity) {
+        throw std::invalid_argument("Capacity must be positive and less than the state size");
+    }
+
+    auto [a, a_inv] = get_alpha_and_inverse(F::P);
+    alpha_ = a.limb(0);
+    alpha_inverse_ = a_inv;
+    n_rounds_ = get_n_rounds(HashMode{m_, capacity_}, a, m_, F::P.bit_length(), security_level_);
+
+    // Cauchy matrix M[i][j] = 1 / (i + j), 1-based
+    mds_.reserve(m_ * m_);
+    for (size_t i = 1; i <= m_; ++i) {
+        for (size_t j = 1; j <= m_; ++j) {
+            mds_.push_back(F(uint64_t{i + j}).inv());
+        }
+    }
+
+    sample_round_constants();
+}
+
+template <typename F>
+void BasicRescuePrime<F>::sample_round_constants() {
+    // Same sampling as RescueDesc in hash mode, with this field's modulus
+    round_constants_.assign(m_, F(uint64_t{0}));
+    const auto sampled = detail::sample_hash_constants<F>(m_, capacity_, security_level_, n_rounds_);
+    round_constants_.insert(round_constants_.end(), sampled.begin(), sampled.end());
+}
+
+template <typename F>
+void BasicRescuePrime<F>::permute_in_place(std::span<F> state) const {
+    if (state.size() != m_) {
+        throw std::invalid_argument("State must have " + std::to_string(m_) + " elements");
+    }
+    metrics::add(metrics::Counter::PERMUTATIONS);
+
+    std::array<F, detail::INLINE_STATE_SIZE> inline_buf;
+    std::vector<F> heap_buf;
+    std::span<F> tmp;
+    if (m_ <= detail::INLINE_STATE_SIZE) {
+        tmp = std::span<F>(inline_buf.data(), m_);
+    } else {
+        heap_buf.resize(m_);
+        tmp = heap_buf;
+    }
+
+    // Hash mode: alpha on even steps, alpha^-1 on odd steps
+    detail::permute_rounds<F>(
+        m_, 2 * n_rounds_ + 1, [&](size_t r) { return round_constants_.data() + r * m_; }, mds_.data(),
+        [&](std::span<F> s, size_t r) {
+            for (auto& x : s) {
+                x = r % 2 == 0 ? x.pow(alpha_) : x.pow(alpha_inverse_);
+            }
+        },
+        state, tmp);
+}
+
+// ============================================================================
+// BasicRescuePrimeHash
+// ============================================================================
+
+template <typename F>
+BasicRescuePrimeHash<F>::BasicRescuePrimeHash()
+    : BasicRescuePrimeHash(RescuePrimeParameters<F>::RATE, RescuePrimeParameters<F>::CAPACITY,
+                           RescuePrimeParameters<F>::DIGEST_LENGTH, RescuePrimeParameters<F>::SECURITY_LEVEL) {}
+
+template <typename F>
+BasicRescuePrimeHash<F>::BasicRescuePrimeHash(size_t rate, size_t capacity, size_t digest_length,
+                                              size_t security_level)
+    : rate_(rate), digest_length_(digest_length), permutation_(rate + capacity, capacity, security_level) {
+    if (rate == 0) {
+        throw std::invalid_argument("Rate must be positive");
+    }
+    if (digest_length == 0) {
+        throw std::invalid_argument("Digest length must be positive");
+    }
+    if (digest_length > rate + capacity) {
+        throw std::invalid_argument("Digest length cannot exceed state size");
+    }
+}
+
+template <typename F>
+std::vector<F> BasicRescuePrimeHash<F>::digest(std::span<const F> message) const {
+    metrics::add(metrics::Counter::HASH_BLOCKS_ABSORBED, detail::sponge_blocks(message.size(), rate_));
+    return detail::sponge_digest<F>(message, rate_, permutation_.m(), digest_length_,
+                                    [&](std::span<F> state) { permutation_.permute_in_place(state); });
+}
+
+template class BasicRescuePrime<Fp>;
+template class BasicRescuePrime<Goldilocks>;
+template class BasicRescuePrimeHash<Fp>;
+template class BasicRescuePrimeHash<Goldilocks>;
+
+}  // namespace rescue
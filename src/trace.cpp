@@ -0,0 +1,62 @@
+#include <rescue/trace.hpp>
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace rescue {
+
+namespace {
+
+/// Permutations per executor task; the scratch buffers are allocated once per task.
+constexpr size_t CHUNK_PERMUTATIONS = 16;
+
+}  // anonymous namespace
+
+TraceLayout TraceLayout::for_desc(const RescueDesc& desc, size_t n_permutations) {
+    return TraceLayout{desc.m(), desc.trace_rows(), n_permutations};
+}
+
+void generate_trace(const RescueDesc& desc, std::span<const Fp> inputs, const TraceLayout& layout,
+                    size_t first_permutation, std::span<uint8_t> out, Executor& executor) {
+    const size_t m = desc.m();
+    if (layout.columns != m || layout.rows_per_permutation != desc.trace_rows()) {
+        throw std::invalid_argument("Trace layout does not match the permutation");
+    }
+    if (inputs.size() % m != 0) {
+        throw std::invalid_argument("Inputs must be a whole number of states");
+    }
+    const size_t n = inputs.size() / m;
+    if (first_permutation > layout.n_permutations || n > layout.n_permutations - first_permutation) {
+        throw std::invalid_argument("Permutations exceed the trace layout");
+    }
+    if (out.size() != layout.bytes()) {
+        throw std::invalid_argument("Trace buffer must be " + std::to_string(layout.bytes()) + " bytes");
+    }
+    if (n == 0) {
+        return;
+    }
+
+    const size_t rows = layout.rows_per_permutation;
+    executor.parallel_for((n + CHUNK_PERMUTATIONS - 1) / CHUNK_PERMUTATIONS, [&](size_t c) {
+        // Row-major scratch for one permutation, transposed into the columns
+        std::vector<Fp> trace(rows * m);
+        std::vector<Fp> state(m);
+        const size_t end = std::min(n, (c + 1) * CHUNK_PERMUTATIONS);
+        for (size_t p = c * CHUNK_PERMUTATIONS; p < end; ++p) {
+            std::copy_n(inputs.begin() + static_cast<std::ptrdiff_t>(p * m), m, state.begin());
+            desc.permute_traced(state, trace);
+
+            const size_t row0 = (first_permutation + p) * rows;
+            for (size_t col = 0; col < m; ++col) {
+                uint8_t* cell = out.data() + layout.offset(col, row0);
+                for (size_t r = 0; r < rows; ++r, cell += TraceLayout::CELL_SIZE) {
+                    trace[r * m + col].to_bytes(std::span<uint8_t, Fp::BYTES>(cell, Fp::BYTES));
+                }
+            }
+        }
+    });
+}
+
+}  // namespace rescue
@@ -0,0 +1,368 @@
+#pragma once
+
+/**
+ * @file rescue_reference.hpp
+ * @brief Slow, independent reference model of the field and the permutation.
+ *
+ * This is a frozen copy of the library's semantics, written to be obviously
+ * correct rather than fast: plain schoolbook arithmetic on little-endian limb
+ * arrays, generic reductions, Gauss-Jordan matrix inversion and a permutation
+ * that follows the round structure literally. It shares no code with
+ * fp_impl.hpp, Matrix or rescue_permutation, so test_differential can swap
+ * or tune those freely and still compare against the semantics they had.
+ *
+ * Do not optimize this file. A change here is a change of the reference
+ * semantics and needs the same review as a change to the test vectors.
+ */
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+namespace rescue::reference {
+
+// ============================================================================
+// Multi-limb integers
+// ============================================================================
+
+/// 256-bit value, 4 x 64-bit limbs, little-endian.
+using Limbs = std::array<uint64_t, 4>;
+
+/// 512-bit value, wide enough for any product of two Limbs.
+using Wide = std::array<uint64_t, 8>;
+
+/// p = 2^255 - 19
+inline constexpr Limbs P = {0xffffffffffffffedULL, 0xffffffffffffffffULL, 0xffffffffffffffffULL,
+                            0x7fffffffffffffffULL};
+
+template <size_t N>
+[[nodiscard]] constexpr bool geq(const std::array<uint64_t, N>& a, const std::array<uint64_t, N>& b) {
+    for (size_t i = N; i-- > 0;) {
+        if (a[i] != b[i]) {
+            return a[i] > b[i];
+        }
+    }
+    return true;
+}
+
+/// a - b, requires a >= b.
+template <size_t N>
+[[nodiscard]] constexpr std::array<uint64_t, N> sub_limbs(const std::array<uint64_t, N>& a,
+                                                          const std::array<uint64_t, N>& b) {
+    std::array<uint64_t, N> out{};
+    uint64_t borrow = 0;
+    for (size_t i = 0; i < N; ++i) {
+        unsigned __int128 d = static_cast<unsigned __int128>(a[i]) - b[i] - borrow;
+        out[i] = static_cast<uint64_t>(d);
+        borrow = static_cast<uint64_t>(d >> 64) & 1;
+    }
+    return out;
+}
+
+template <size_t To, size_t From>
+[[nodiscard]] constexpr std::array<uint64_t, To> widen(const std::array<uint64_t, From>& a) {
+    static_assert(To >= From);
+    std::array<uint64_t, To> out{};
+    for (size_t i = 0; i < From; ++i) {
+        out[i] = a[i];
+    }
+    return out;
+}
+
+/// Schoolbook a * b.
+[[nodiscard]] constexpr Wide mul_wide(const Limbs& a, const Limbs& b) {
+    Wide out{};
+    for (size_t i = 0; i < 4; ++i) {
+        uint64_t carry = 0;
+        for (size_t j = 0; j < 4; ++j) {
+            unsigned __int128 t = static_cast<unsigned __int128>(a[i]) * b[j] + out[i + j] + carry;
+            out[i + j] = static_cast<uint64_t>(t);
+            carry = static_cast<uint64_t>(t >> 64);
+        }
+        out[i + 4] = carry;
+    }
+    return out;
+}
+
+/**
+ * @brief x mod m by binary long division, for an arbitrary modulus m < 2^255.
+ */
+[[nodiscard]] constexpr Limbs mod_generic(const Wide& x, const Limbs& m) {
+    Limbs r{};
+    for (size_t bit = 512; bit-- > 0;) {
+        // r < m < 2^255, so 2r + 1 still fits in 256 bits
+        for (size_t i = 3; i > 0; --i) {
+            r[i] = (r[i] << 1) | (r[i - 1] >> 63);
+        }
+        r[0] = (r[0] << 1) | ((x[bit / 64] >> (bit % 64)) & 1);
+        if (geq(r, m)) {
+            r = sub_limbs(r, m);
+        }
+    }
+    return r;
+}
+
+/**
+ * @brief x mod p by folding the bits above 2^255 back in, x = hi*2^255 + lo ≡ lo + 19*hi.
+ */
+[[nodiscard]] constexpr Limbs mod_p(Wide x) {
+    constexpr uint64_t LOW_MASK = 0x7fffffffffffffffULL;
+    for (;;) {
+        Wide hi{};
+        for (size_t i = 0; i < 8; ++i) {
+            // Bit 255 + 64i of x starts limb i of hi
+            uint64_t lo_part = (i + 3 < 8) ? (x[i + 3] >> 63) : 0;
+            uint64_t hi_part = (i + 4 < 8) ? (x[i + 4] << 1) : 0;
+            hi[i] = lo_part | hi_part;
+        }
+        bool has_high = false;
+        for (uint64_t limb : hi) {
+            has_high |= limb != 0;
+        }
+        if (!has_high) {
+            break;
+        }
+
+        Wide folded{x[0], x[1], x[2], x[3] & LOW_MASK, 0, 0, 0, 0};
+        uint64_t carry = 0;
+        for (size_t i = 0; i < 8; ++i) {
+            unsigned __int128 t = static_cast<unsigned __int128>(hi[i]) * 19 + folded[i] + carry;
+            folded[i] = static_cast<uint64_t>(t);
+            carry = static_cast<uint64_t>(t >> 64);
+        }
+        x = folded;
+    }
+
+    Limbs r{x[0], x[1], x[2], x[3]};
+    while (geq(r, P)) {
+        r = sub_limbs(r, P);
+    }
+    return r;
+}
+
+// ============================================================================
+// Field elements
+// ============================================================================
+
+/**
+ * @brief Element of F_p, always held in canonical form [0, p).
+ */
+struct Element {
+    Limbs v{};
+
+    /// Reduce any 256-bit value.
+    [[nodiscard]] static constexpr Element reduce(const Limbs& raw) { return {mod_p(widen<8>(raw))}; }
+
+    [[nodiscard]] static constexpr Element from_u64(uint64_t x) { return {{x, 0, 0, 0}}; }
+
+    [[nodiscard]] constexpr bool is_zero() const { return (v[0] | v[1] | v[2] | v[3]) == 0; }
+
+    friend constexpr bool operator==(const Element&, const Element&) = default;
+};
+
+[[nodiscard]] constexpr Element add(const Element& a, const Element& b) {
+    Wide s = widen<8>(a.v);
+    uint64_t carry = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        unsigned __int128 t = static_cast<unsigned __int128>(s[i]) + b.v[i] + carry;
+        s[i] = static_cast<uint64_t>(t);
+        carry = static_cast<uint64_t>(t >> 64);
+    }
+    s[4] = carry;
+    return {mod_p(s)};
+}
+
+[[nodiscard]] constexpr Element neg(const Element& a) {
+    return a.is_zero() ? a : Element{sub_limbs(P, a.v)};
+}
+
+[[nodiscard]] constexpr Element sub(const Element& a, const Element& b) {
+    return add(a, neg(b));
+}
+
+[[nodiscard]] constexpr Element mul(const Element& a, const Element& b) {
+    return {mod_p(mul_wide(a.v, b.v))};
+}
+
+/// Left-to-right square-and-multiply over all 256 exponent bits.
+[[nodiscard]] constexpr Element pow(const Element& base, const Limbs& exp) {
+    Element r = Element::from_u64(1);
+    for (size_t bit = 256; bit-- > 0;) {
+        r = mul(r, r);
+        if ((exp[bit / 64] >> (bit % 64)) & 1) {
+            r = mul(r, base);
+        }
+    }
+    return r;
+}
+
+/// a^(p-2); throws on zero like Fp::inv.
+[[nodiscard]] constexpr Element inv(const Element& a) {
+    if (a.is_zero()) {
+        throw std::domain_error("reference: inverse of zero");
+    }
+    return pow(a, sub_limbs(P, Limbs{2, 0, 0, 0}));
+}
+
+// ============================================================================
+// Matrices
+// ============================================================================
+
+using Vec = std::vector<Element>;
+using Mat = std::vector<Vec>;
+
+[[nodiscard]] inline Vec mat_vec(const Mat& m, const Vec& x) {
+    Vec out(m.size());
+    for (size_t i = 0; i < m.size(); ++i) {
+        for (size_t j = 0; j < x.size(); ++j) {
+            out[i] = add(out[i], mul(m[i][j], x[j]));
+        }
+    }
+    return out;
+}
+
+[[nodiscard]] inline Mat mat_mul(const Mat& a, const Mat& b) {
+    Mat out(a.size(), Vec(b.empty() ? 0 : b[0].size()));
+    for (size_t i = 0; i < a.size(); ++i) {
+        for (size_t j = 0; j < out[i].size(); ++j) {
+            for (size_t k = 0; k < b.size(); ++k) {
+                out[i][j] = add(out[i][j], mul(a[i][k], b[k][j]));
+            }
+        }
+    }
+    return out;
+}
+
+/// Cauchy matrix M[i][j] = 1 / (i + j) for i, j in 1..size.
+[[nodiscard]] inline Mat cauchy(size_t size) {
+    Mat out(size, Vec(size));
+    for (size_t i = 0; i < size; ++i) {
+        for (size_t j = 0; j < size; ++j) {
+            out[i][j] = inv(Element::from_u64(i + j + 2));
+        }
+    }
+    return out;
+}
+
+/// Gauss-Jordan elimination; throws if m is singular.
+[[nodiscard]] inline Mat invert(Mat m) {
+    const size_t n = m.size();
+    Mat out(n, Vec(n));
+    for (size_t i = 0; i < n; ++i) {
+        out[i][i] = Element::from_u64(1);
+    }
+    for (size_t col = 0; col < n; ++col) {
+        size_t pivot = col;
+        while (pivot < n && m[pivot][col].is_zero()) {
+            ++pivot;
+        }
+        if (pivot == n) {
+            throw std::domain_error("reference: singular matrix");
+        }
+        std::swap(m[col], m[pivot]);
+        std::swap(out[col], out[pivot]);
+
+        Element scale = inv(m[col][col]);
+        for (size_t j = 0; j < n; ++j) {
+            m[col][j] = mul(m[col][j], scale);
+            out[col][j] = mul(out[col][j], scale);
+        }
+        for (size_t row = 0; row < n; ++row) {
+            if (row == col || m[row][col].is_zero()) {
+                continue;
+            }
+            Element f = m[row][col];
+            for (size_t j = 0; j < n; ++j) {
+                m[row][j] = sub(m[row][j], mul(f, m[col][j]));
+                out[row][j] = sub(out[row][j], mul(f, out[col][j]));
+            }
+        }
+    }
+    return out;
+}
+
+// ============================================================================
+// Permutation
+// ============================================================================
+
+/**
+ * @brief Everything the permutation depends on, in reference form.
+ *
+ * Round keys are inputs: their derivation (SHAKE256 sampling and the cipher
+ * key schedule) is pinned by the known-answer tests instead.
+ */
+struct Params {
+    bool cipher = true;
+    Limbs alpha{};
+    Limbs alpha_inverse{};
+    Mat mds;
+    Mat mds_inverse;
+    std::vector<Vec> round_keys;  ///< 2 * n_rounds + 1 keys of m elements
+};
+
+/// S-box exponent for round r. Cipher mode starts with alpha^-1, hash mode with alpha.
+[[nodiscard]] inline const Limbs& sbox_exponent(const Params& params, size_t r) {
+    bool even = r % 2 == 0;
+    return even == params.cipher ? params.alpha_inverse : params.alpha;
+}
+
+/**
+ * @brief Forward permutation, returning the state after every round key.
+ *
+ * trace[0] = state + k_0 and trace[r + 1] = M * sbox_r(trace[r]) + k_{r+1};
+ * the last entry is the output.
+ */
+[[nodiscard]] inline std::vector<Vec> permute_trace(const Params& params, const Vec& state) {
+    std::vector<Vec> trace;
+    Vec s(state.size());
+    for (size_t i = 0; i < s.size(); ++i) {
+        s[i] = add(state[i], params.round_keys[0][i]);
+    }
+    trace.push_back(s);
+
+    for (size_t r = 0; r + 1 < params.round_keys.size(); ++r) {
+        for (auto& x : s) {
+            x = pow(x, sbox_exponent(params, r));
+        }
+        s = mat_vec(params.mds, s);
+        for (size_t i = 0; i < s.size(); ++i) {
+            s[i] = add(s[i], params.round_keys[r + 1][i]);
+        }
+        trace.push_back(s);
+    }
+    return trace;
+}
+
+[[nodiscard]] inline Vec permute(const Params& params, const Vec& state) {
+    return permute_trace(params, state).back();
+}
+
+/**
+ * @brief Inverse permutation, undoing permute() round by round.
+ *
+ * Each round subtracts the key before applying M^-1, i.e. the untransformed
+ * round keys, so it also checks the library's inverse_round_keys().
+ */
+[[nodiscard]] inline Vec permute_inverse(const Params& params, const Vec& state) {
+    const size_t rounds = params.round_keys.size() - 1;
+    Vec s = state;
+    for (size_t step = 0; step < rounds; ++step) {
+        size_t r = rounds - 1 - step;  // Forward round being undone
+        for (size_t i = 0; i < s.size(); ++i) {
+            s[i] = sub(s[i], params.round_keys[r + 1][i]);
+        }
+        s = mat_vec(params.mds_inverse, s);
+        // Exponents alternate, so round r + 1's exponent inverts round r's S-box
+        for (auto& x : s) {
+            x = pow(x, sbox_exponent(params, r + 1));
+        }
+    }
+    for (size_t i = 0; i < s.size(); ++i) {
+        s[i] = sub(s[i], params.round_keys[0][i]);
+    }
+    return s;
+}
+
+}  // namespace rescue::reference
@@ -0,0 +1,172 @@
+/**
+ * @file test_allocations.cpp
+ * @brief Checks that APIs documented as allocation-free stay that way.
+ *
+ * This executable replaces the global operator new/delete with versions that
+ * count calls per thread, and measures the calls made by each API.
+ */
+
+#include <rescue/rescue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <new>
+
+using namespace rescue;
+
+// ============================================================================
+// Counting allocator
+// ============================================================================
+
+namespace {
+
+constinit thread_local uint64_t t_allocations = 0;
+
+void* counted_alloc(std::size_t size, std::size_t alignment) {
+    ++t_allocations;
+    if (size == 0) {
+        size = 1;
+    }
+    void* p = alignment <= alignof(std::max_align_t)
+                  ? std::malloc(size)
+                  : std::aligned_alloc(alignment, (size + alignment - 1) / alignment * alignment);
+    if (p == nullptr) {
+        throw std::bad_alloc();
+    }
+    return p;
+}
+
+/**
+ * Number of operator new calls made by f on this thread.
+ */
+template <typename F>
+uint64_t allocations_during(F&& f) {
+    uint64_t before = t_allocations;
+    f();
+    return t_allocations - before;
+}
+
+std::vector<Fp> test_key(size_t m) {
+    std::vector<Fp> key;
+    for (size_t i = 0; i < m; ++i) {
+        key.push_back(Fp(uint64_t{i * 7 + 3}));
+    }
+    return key;
+}
+
+}  // anonymous namespace
+
+// Array, nothrow and sized forms forward to these by default
+void* operator new(std::size_t size) {
+    return counted_alloc(size, alignof(std::max_align_t));
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return counted_alloc(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* p) noexcept {
+    std::free(p);
+}
+
+void operator delete(void* p, std::align_val_t) noexcept {
+    std::free(p);
+}
+
+// ============================================================================
+// Tests
+// ============================================================================
+
+TEST(AllocationTest, CounterSeesHeapAllocations) {
+    uint64_t n = allocations_during([] {
+        std::vector<Fp> v(4);
+        ASSERT_EQ(v.size(), 4u);
+    });
+    EXPECT_EQ(n, 1u);
+}
+
+TEST(AllocationTest, FieldArithmeticDoesNotAllocate) {
+    Fp a(uint64_t{123456789});
+    Fp b(uint64_t{987654321});
+
+    uint64_t n = allocations_during([&] {
+        Fp c = a + b;
+        c = c - a;
+        c = c * b;
+        c = c.square();
+        c = c.pow(uint64_t{5});
+        c = c.inv();
+        c = c.pow(uint256(uint64_t{65537}));
+        auto bytes = c.to_bytes();
+        c = Fp::from_bytes(bytes);
+        a = c;
+    });
+    EXPECT_EQ(n, 0u);
+}
+
+TEST(AllocationTest, CipherPermutationDoesNotAllocate) {
+    RescueDesc desc(test_key(5));
+    std::vector<Fp> state = test_key(5);
+
+    uint64_t n = allocations_during([&] {
+        desc.permute_in_place(state);
+        desc.permute_inverse_in_place(state);
+    });
+    EXPECT_EQ(n, 0u);
+    EXPECT_EQ(state, test_key(5));
+}
+
+TEST(AllocationTest, HashPermutationDoesNotAllocate) {
+    RescueDesc desc(RESCUE_HASH_STATE_SIZE, RESCUE_HASH_CAPACITY);
+    std::vector<Fp> state = test_key(RESCUE_HASH_STATE_SIZE);
+
+    uint64_t n = allocations_during([&] {
+        desc.permute_in_place(state);
+        desc.permute_inverse_in_place(state);
+    });
+    EXPECT_EQ(n, 0u);
+
+    std::vector<Fp> trace(desc.trace_rows() * desc.m());
+    EXPECT_EQ(allocations_during([&] { desc.permute_traced(state, trace); }), 0u);
+}
+
+TEST(AllocationTest, MmrCompressionDoesNotAllocate) {
+    MerkleMountainRange mmr;
+    MmrDigest left{}, right{};
+    left[0] = Fp(uint64_t{1});
+    (void)mmr.hash_children(left, right);
+
+    EXPECT_EQ(allocations_during([&] { right = mmr.hash_children(left, right); }), 0u);
+}
+
+TEST(AllocationTest, BlockCipherDoesNotAllocate) {
+    std::array<uint8_t, 32> secret{};
+    secret[0] = 42;
+    BasicRescueCipher<16> cipher(secret);
+
+    BasicRescueCipher<16>::Block block{};
+    block[0] = Fp(uint64_t{1});
+    std::array<BasicRescueCipher<16>::Block, 4> blocks{block, block, block, block};
+
+    uint64_t n = allocations_during([&] {
+        block = cipher.encrypt_block(block);
+        block = cipher.decrypt_block(block);
+        cipher.encrypt_blocks(blocks, blocks);
+        cipher.decrypt_blocks(blocks, blocks);
+    });
+    EXPECT_EQ(n, 0u);
+    EXPECT_EQ(block, blocks[0]);
+}
+
+TEST(AllocationTest, EnabledMetricsDoNotAllocateAfterFirstUpdate) {
+    RescueDesc desc(test_key(5));
+    std::vector<Fp> state = test_key(5);
+
+    metrics::set_enabled(true);
+    desc.permute_in_place(state);  // Acquires this thread's shard
+
+    uint64_t n = allocations_during([&] { desc.permute_in_place(state); });
+    metrics::set_enabled(false);
+    EXPECT_EQ(n, 0u);
+}
@@ -0,0 +1,220 @@
+/**
+ * @file test_c_api.cpp
+ * @brief Tests for the rescue_c.h C ABI.
+ */
+
+#include <rescue/rescue.hpp>
+#include <rescue/rescue_c.h>
+
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <vector>
+
+using namespace rescue;
+
+namespace {
+
+std::array<uint8_t, RESCUE_C_SECRET_SIZE> make_secret(uint8_t seed) {
+    std::array<uint8_t, RESCUE_C_SECRET_SIZE> s{};
+    for (size_t i = 0; i < s.size(); ++i) {
+        s[i] = static_cast<uint8_t>(seed + i * 11);
+    }
+    return s;
+}
+
+std::array<uint8_t, RESCUE_C_NONCE_SIZE> make_nonce(uint8_t seed) {
+    std::array<uint8_t, RESCUE_C_NONCE_SIZE> n{};
+    for (size_t i = 0; i < n.size(); ++i) {
+        n[i] = static_cast<uint8_t>(seed * 3 + i);
+    }
+    return n;
+}
+
+std::vector<Fp> make_message(size_t n, uint64_t seed) {
+    std::vector<Fp> msg;
+    for (size_t i = 0; i < n; ++i) {
+        msg.push_back(Fp(uint64_t{seed * 7919 + i}));
+    }
+    return msg;
+}
+
+std::vector<uint8_t> serialize(const std::vector<Fp>& elements) {
+    std::vector<uint8_t> out;
+    for (const Fp& x : elements) {
+        auto bytes = x.to_bytes();
+        out.insert(out.end(), bytes.begin(), bytes.end());
+    }
+    return out;
+}
+
+/// Owning wrapper so failed assertions do not leak handles.
+struct CipherHandle {
+    rescue_cipher* ptr = nullptr;
+    ~CipherHandle() { rescue_cipher_free(ptr); }
+};
+
+struct HasherHandle {
+    rescue_hasher* ptr = nullptr;
+    ~HasherHandle() { rescue_hasher_free(ptr); }
+};
+
+}  // anonymous namespace
+
+// ============================================================================
+// Cipher
+// ============================================================================
+
+TEST(CApiTest, VersionAndStatusStrings) {
+    EXPECT_EQ(rescue_abi_version(), static_cast<uint32_t>(RESCUE_C_ABI_VERSION));
+    EXPECT_STREQ(rescue_status_string(RESCUE_OK), "ok");
+    EXPECT_STREQ(rescue_status_string(RESCUE_ERR_NON_CANONICAL), "non-canonical field element");
+}
+
+TEST(CApiTest, EncryptMatchesEncryptRaw) {
+    auto secret = make_secret(1);
+    auto nonce = make_nonce(2);
+    RescueCipher reference(secret);
+    CipherHandle cipher;
+    ASSERT_EQ(rescue_cipher_new(5, secret.data(), &cipher.ptr), RESCUE_OK);
+    EXPECT_EQ(rescue_cipher_width(cipher.ptr), 5u);
+
+    for (size_t n : {size_t{1}, size_t{5}, size_t{6}, size_t{23}}) {
+        auto msg = make_message(n, n);
+        auto plain = serialize(msg);
+        std::vector<uint8_t> ct(plain.size());
+        ASSERT_EQ(rescue_cipher_encrypt(cipher.ptr, nonce.data(), plain.data(), n, ct.data()), RESCUE_OK);
+        EXPECT_EQ(ct, serialize(reference.encrypt_raw(msg, nonce))) << "n=" << n;
+
+        // In place
+        ASSERT_EQ(rescue_cipher_decrypt(cipher.ptr, nonce.data(), ct.data(), n, ct.data()), RESCUE_OK);
+        EXPECT_EQ(ct, plain) << "n=" << n;
+    }
+}
+
+TEST(CApiTest, WideCipher) {
+    auto secret = make_secret(4);
+    auto nonce = make_nonce(5);
+    auto msg = make_message(40, 1);
+    auto plain = serialize(msg);
+    CipherHandle cipher;
+    ASSERT_EQ(rescue_cipher_new(16, secret.data(), &cipher.ptr), RESCUE_OK);
+
+    std::vector<uint8_t> ct(plain.size());
+    ASSERT_EQ(rescue_cipher_encrypt(cipher.ptr, nonce.data(), plain.data(), msg.size(), ct.data()), RESCUE_OK);
+    EXPECT_EQ(ct, serialize(BasicRescueCipher<16>(secret).encrypt_raw(msg, nonce)));
+}
+
+TEST(CApiTest, BatchMatchesPerMessageCalls) {
+    auto secret = make_secret(7);
+    CipherHandle cipher;
+    ASSERT_EQ(rescue_cipher_new(5, secret.data(), &cipher.ptr), RESCUE_OK);
+
+    std::vector<size_t> lengths = {3, 0, 5, 11, 1};
+    std::vector<uint8_t> nonces;
+    std::vector<uint8_t> plain;
+    std::vector<uint8_t> expected;
+    RescueCipher reference(secret);
+    for (size_t i = 0; i < lengths.size(); ++i) {
+        auto nonce = make_nonce(static_cast<uint8_t>(i));
+        auto msg = make_message(lengths[i], i);
+        nonces.insert(nonces.end(), nonce.begin(), nonce.end());
+        auto bytes = serialize(msg);
+        plain.insert(plain.end(), bytes.begin(), bytes.end());
+        auto ct = serialize(reference.encrypt_raw(msg, nonce));
+        expected.insert(expected.end(), ct.begin(), ct.end());
+    }
+
+    std::vector<uint8_t> ct(plain.size());
+    ASSERT_EQ(rescue_cipher_encrypt_batch(cipher.ptr, lengths.size(), nonces.data(), lengths.data(), plain.data(),
+                                          ct.data()),
+              RESCUE_OK);
+    EXPECT_EQ(ct, expected);
+
+    std::vector<uint8_t> back(ct.size());
+    ASSERT_EQ(rescue_cipher_decrypt_batch(cipher.ptr, lengths.size(), nonces.data(), lengths.data(), ct.data(),
+                                          back.data()),
+              RESCUE_OK);
+    EXPECT_EQ(back, plain);
+}
+
+TEST(CApiTest, CreatesManyCiphers) {
+    constexpr size_t N = 4;
+    std::vector<uint8_t> secrets;
+    secrets.reserve(N * RESCUE_C_SECRET_SIZE);
+    for (size_t i = 0; i < N; ++i) {
+        auto s = make_secret(static_cast<uint8_t>(i));
+        secrets.insert(secrets.end(), s.begin(), s.end());
+    }
+    std::array<rescue_cipher*, N> handles{};
+    ASSERT_EQ(rescue_cipher_new_batch(8, secrets.data(), N, handles.data()), RESCUE_OK);
+
+    auto nonce = make_nonce(0);
+    auto msg = make_message(9, 3);
+    auto plain = serialize(msg);
+    for (size_t i = 0; i < N; ++i) {
+        std::vector<uint8_t> ct(plain.size());
+        EXPECT_EQ(rescue_cipher_encrypt(handles[i], nonce.data(), plain.data(), msg.size(), ct.data()), RESCUE_OK);
+        EXPECT_EQ(ct, serialize(BasicRescueCipher<8>(make_secret(static_cast<uint8_t>(i))).encrypt_raw(msg, nonce)));
+        rescue_cipher_free(handles[i]);
+    }
+}
+
+TEST(CApiTest, ReportsErrors) {
+    auto secret = make_secret(1);
+    auto nonce = make_nonce(1);
+    rescue_cipher* bad = reinterpret_cast<rescue_cipher*>(&secret);
+    EXPECT_EQ(rescue_cipher_new(7, secret.data(), &bad), RESCUE_ERR_INVALID_ARGUMENT);
+    EXPECT_EQ(bad, nullptr);
+    EXPECT_EQ(rescue_cipher_new(5, nullptr, &bad), RESCUE_ERR_NULL_POINTER);
+    EXPECT_EQ(rescue_cipher_width(nullptr), 0u);
+
+    CipherHandle cipher;
+    ASSERT_EQ(rescue_cipher_new(5, secret.data(), &cipher.ptr), RESCUE_OK);
+    std::vector<uint8_t> buf(3 * RESCUE_C_ELEMENT_SIZE);
+    EXPECT_EQ(rescue_cipher_encrypt(cipher.ptr, nonce.data(), nullptr, 3, buf.data()), RESCUE_ERR_NULL_POINTER);
+    EXPECT_EQ(rescue_cipher_encrypt(cipher.ptr, nonce.data(), nullptr, 0, nullptr), RESCUE_OK);
+
+    // p itself in the last element: rejected, and nothing is written
+    auto p = Fp::P.to_bytes_le();
+    std::memcpy(buf.data() + 2 * RESCUE_C_ELEMENT_SIZE, p.data(), p.size());
+    std::vector<uint8_t> out(buf.size(), 0xaa);
+    EXPECT_EQ(rescue_cipher_encrypt(cipher.ptr, nonce.data(), buf.data(), 3, out.data()), RESCUE_ERR_NON_CANONICAL);
+    EXPECT_EQ(out, std::vector<uint8_t>(buf.size(), 0xaa));
+
+    size_t huge[2] = {SIZE_MAX / RESCUE_C_ELEMENT_SIZE, 1};  // Byte size overflows size_t
+    std::vector<uint8_t> nonces(2 * RESCUE_C_NONCE_SIZE);
+    EXPECT_EQ(rescue_cipher_encrypt_batch(cipher.ptr, 2, nonces.data(), huge, buf.data(), out.data()),
+              RESCUE_ERR_INVALID_ARGUMENT);
+}
+
+// ============================================================================
+// Hash
+// ============================================================================
+
+TEST(CApiTest, HashAndHashBatch) {
+    HasherHandle hasher;
+    ASSERT_EQ(rescue_hasher_new(&hasher.ptr), RESCUE_OK);
+    RescuePrimeHash reference;
+
+    std::vector<size_t> lengths = {1, 7, 0, 20};
+    std::vector<uint8_t> in;
+    std::vector<uint8_t> expected;
+    for (size_t i = 0; i < lengths.size(); ++i) {
+        auto msg = make_message(lengths[i], i + 1);
+        auto bytes = serialize(msg);
+        in.insert(in.end(), bytes.begin(), bytes.end());
+        auto d = serialize(reference.digest(msg));
+        expected.insert(expected.end(), d.begin(), d.end());
+    }
+
+    std::vector<uint8_t> out(lengths.size() * RESCUE_C_DIGEST_ELEMENTS * RESCUE_C_ELEMENT_SIZE);
+    ASSERT_EQ(rescue_hash_batch(hasher.ptr, lengths.size(), lengths.data(), in.data(), out.data()), RESCUE_OK);
+    EXPECT_EQ(out, expected);
+
+    std::vector<uint8_t> single(RESCUE_C_DIGEST_ELEMENTS * RESCUE_C_ELEMENT_SIZE);
+    ASSERT_EQ(rescue_hash(hasher.ptr, in.data(), 1, single.data()), RESCUE_OK);
+    EXPECT_TRUE(std::equal(single.begin(), single.end(), expected.begin()));
+
+    EXPECT_EQ(rescue_hash(nullptr, in.data(), 1, single.data()), RESCUE_ERR_NULL_POINTER);
+}
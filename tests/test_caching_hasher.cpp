@@ -0,0 +1,113 @@
+/**
+ * @file test_caching_hasher.cpp
+ * @brief Tests for the memoizing RescuePrimeHash wrapper.
+ */
+
+#include <rescue/caching_hasher.hpp>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace rescue;
+
+namespace {
+
+std::vector<Fp> message(uint64_t seed, size_t len = 3) {
+    std::vector<Fp> m;
+    for (size_t i = 0; i < len; ++i) {
+        m.push_back(Fp(uint64_t{seed * 100 + i}));
+    }
+    return m;
+}
+
+}  // anonymous namespace
+
+TEST(CachingHasherTest, HitsReturnTheHasherDigest) {
+    CachingHasher cache(8);
+    RescuePrimeHash hasher;
+    auto msg = message(1);
+
+    auto first = cache.digest(msg);
+    auto second = cache.digest(msg);
+    EXPECT_EQ(first, hasher.digest(msg));
+    EXPECT_EQ(second, first);
+
+    CacheStats stats = cache.stats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 1u);
+    EXPECT_EQ(stats.entries, 1u);
+    EXPECT_DOUBLE_EQ(stats.hit_rate(), 0.5);
+}
+
+TEST(CachingHasherTest, DistinguishesSimilarMessages) {
+    CachingHasher cache(16, 1);
+    RescuePrimeHash hasher;
+    // Prefixes and zero-extensions must not share entries
+    std::vector<std::vector<Fp>> messages = {{}, {Fp::ZERO}, {Fp::ZERO, Fp::ZERO}, message(2, 1), message(2, 2)};
+    for (int round = 0; round < 2; ++round) {
+        for (const auto& m : messages) {
+            EXPECT_EQ(cache.digest(m), hasher.digest(m));
+        }
+    }
+    EXPECT_EQ(cache.stats().hits, messages.size());
+    EXPECT_NE(CachingHasher::fingerprint(messages[1]), CachingHasher::fingerprint(messages[2]));
+}
+
+TEST(CachingHasherTest, CapacityBoundsEntries) {
+    CachingHasher cache(4, 1);
+    for (uint64_t i = 0; i < 6; ++i) {
+        (void)cache.digest(message(i));
+    }
+    CacheStats stats = cache.stats();
+    EXPECT_EQ(stats.entries, 4u);
+    EXPECT_EQ(stats.evictions, 2u);
+
+    // Least recently used entries went first
+    (void)cache.digest(message(5));
+    (void)cache.digest(message(0));
+    stats = cache.stats();
+    EXPECT_EQ(stats.hits, 1u);
+    EXPECT_EQ(stats.misses, 7u);
+
+    cache.clear();
+    stats = cache.stats();
+    EXPECT_EQ(stats.entries, 0u);
+    EXPECT_EQ(stats.hits + stats.misses, 0u);
+
+    EXPECT_THROW(CachingHasher(0), std::invalid_argument);
+    EXPECT_THROW(CachingHasher(4, 0), std::invalid_argument);
+}
+
+TEST(CachingHasherTest, ConcurrentLookups) {
+    CachingHasher cache(64);
+    constexpr size_t THREADS = 4;
+    constexpr uint64_t DISTINCT = 4;
+    std::vector<std::vector<Fp>> expected;
+    RescuePrimeHash hasher;
+    for (uint64_t i = 0; i < DISTINCT; ++i) {
+        expected.push_back(hasher.digest(message(i)));
+    }
+
+    std::vector<std::thread> threads;
+    std::vector<int> mismatches(THREADS, 0);
+    for (size_t t = 0; t < THREADS; ++t) {
+        threads.emplace_back([&, t] {
+            for (uint64_t i = 0; i < 4 * DISTINCT; ++i) {
+                if (cache.digest(message(i % DISTINCT)) != expected[i % DISTINCT]) {
+                    ++mismatches[t];
+                }
+            }
+        });
+    }
+    for (auto& th : threads) {
+        th.join();
+    }
+    for (int m : mismatches) {
+        EXPECT_EQ(m, 0);
+    }
+    CacheStats stats = cache.stats();
+    EXPECT_EQ(stats.hits + stats.misses, THREADS * 4 * DISTINCT);
+    EXPECT_EQ(stats.entries, DISTINCT);
+}
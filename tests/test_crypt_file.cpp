@@ -0,0 +1,233 @@
+/**
+ * @file test_crypt_file.cpp
+ * @brief Tests for the rescue-crypt file format and parallel CTR processing.
+ */
+
+#include "crypt_file.hpp"
+#include "mapped_file.hpp"
+
+#include <rescue/rescue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <vector>
+
+using namespace rescue;
+using namespace rescue::crypt;
+
+namespace {
+
+std::array<uint8_t, RESCUE_CIPHER_SECRET_SIZE> make_secret() {
+    std::array<uint8_t, RESCUE_CIPHER_SECRET_SIZE> s{};
+    for (size_t i = 0; i < s.size(); ++i) {
+        s[i] = static_cast<uint8_t>(i * 13 + 1);
+    }
+    return s;
+}
+
+std::array<uint8_t, RESCUE_CIPHER_NONCE_SIZE> make_nonce() {
+    std::array<uint8_t, RESCUE_CIPHER_NONCE_SIZE> n{};
+    for (size_t i = 0; i < n.size(); ++i) {
+        n[i] = static_cast<uint8_t>(0xa0 + i);
+    }
+    return n;
+}
+
+std::vector<Fp> make_message(size_t n) {
+    std::vector<Fp> msg;
+    for (size_t i = 0; i < n; ++i) {
+        msg.push_back(Fp(uint64_t{i * 0x9e3779b9 + 7}));
+    }
+    return msg;
+}
+
+std::vector<uint8_t> serialize(const std::vector<Fp>& elements) {
+    std::vector<uint8_t> out(elements.size() * ELEMENT_SIZE);
+    for (size_t i = 0; i < elements.size(); ++i) {
+        elements[i].to_bytes(std::span<uint8_t, ELEMENT_SIZE>(out.data() + i * ELEMENT_SIZE, ELEMENT_SIZE));
+    }
+    return out;
+}
+
+template <size_t M>
+std::vector<Fp> library_encrypt(const std::vector<Fp>& msg) {
+    return BasicRescueCipher<M>(make_secret()).encrypt_raw(msg, make_nonce());
+}
+
+}  // anonymous namespace
+
+// ============================================================================
+// Header
+// ============================================================================
+
+TEST(CryptFileTest, HeaderRoundTrip) {
+    FileHeader h;
+    h.parameter_id = 12;
+    h.element_count = 0x0102030405060708ULL;
+    h.nonce = make_nonce();
+
+    std::array<uint8_t, HEADER_SIZE> bytes{};
+    write_header(h, bytes);
+    EXPECT_EQ(bytes[0], 'R');
+    EXPECT_EQ(bytes[16], 0x08);  // Little-endian element count
+
+    FileHeader back = read_header(bytes);
+    EXPECT_EQ(back.parameter_id, 12u);
+    EXPECT_EQ(back.element_count, h.element_count);
+    EXPECT_EQ(back.nonce, h.nonce);
+}
+
+TEST(CryptFileTest, RejectsBadHeaders) {
+    std::array<uint8_t, HEADER_SIZE> bytes{};
+    write_header(FileHeader{}, bytes);
+
+    EXPECT_THROW((void)read_header(std::span<const uint8_t>(bytes).first(HEADER_SIZE - 1)), std::runtime_error);
+
+    auto bad_magic = bytes;
+    bad_magic[0] = 'X';
+    EXPECT_THROW((void)read_header(bad_magic), std::runtime_error);
+
+    auto bad_width = bytes;
+    bad_width[8] = 7;
+    EXPECT_THROW((void)read_header(bad_width), std::runtime_error);
+}
+
+// ============================================================================
+// CTR processing
+// ============================================================================
+
+TEST(CryptFileTest, MatchesEncryptRawAtEveryWidth) {
+    auto msg = make_message(2500);  // Several chunks for every width
+    auto plain = serialize(msg);
+    auto nonce = make_nonce();
+
+    auto check = [&](uint32_t width, const std::vector<Fp>& expected) {
+        StreamCipher cipher(width, make_secret());
+        std::vector<uint8_t> ct(plain.size());
+        cipher.apply(nonce, 0, plain, ct, false);
+        EXPECT_EQ(ct, serialize(expected)) << "width=" << width;
+
+        std::vector<uint8_t> back(ct.size());
+        cipher.apply(nonce, 0, ct, back, true);
+        EXPECT_EQ(back, plain) << "width=" << width;
+    };
+    check(5, library_encrypt<5>(msg));
+    check(8, library_encrypt<8>(msg));
+    check(12, library_encrypt<12>(msg));
+    check(16, library_encrypt<16>(msg));
+}
+
+TEST(CryptFileTest, ExecutorDoesNotChangeOutput) {
+    auto plain = serialize(make_message(2000));
+    StreamCipher cipher(5, make_secret());
+
+    std::vector<uint8_t> single(plain.size());
+    SequentialExecutor sequential;
+    cipher.apply(make_nonce(), 0, plain, single, false, sequential);
+    for (size_t threads : {size_t{2}, size_t{7}}) {
+        WorkStealingExecutor pool(WorkStealingExecutor::Options{.threads = threads});
+        std::vector<uint8_t> multi(plain.size());
+        cipher.apply(make_nonce(), 0, plain, multi, false, pool);
+        EXPECT_EQ(multi, single) << "threads=" << threads;
+    }
+    std::vector<uint8_t> shared(plain.size());
+    cipher.apply(make_nonce(), 0, plain, shared, false);
+    EXPECT_EQ(shared, single);
+}
+
+TEST(CryptFileTest, DecryptsArbitraryRanges) {
+    auto msg = make_message(100);
+    auto plain = serialize(msg);
+    StreamCipher cipher(8, make_secret());
+    std::vector<uint8_t> ct(plain.size());
+    cipher.apply(make_nonce(), 0, plain, ct, false);
+
+    // Ranges starting and ending mid-block, block-aligned, and single elements
+    for (auto [first, count] : std::vector<std::pair<size_t, size_t>>{{0, 100}, {3, 10}, {8, 16}, {99, 1}, {41, 0}}) {
+        std::span<const uint8_t> src(ct.data() + first * ELEMENT_SIZE, count * ELEMENT_SIZE);
+        std::vector<uint8_t> out(src.size());
+        cipher.apply(make_nonce(), first, src, out, true);
+        EXPECT_TRUE(std::equal(out.begin(), out.end(), plain.begin() + static_cast<std::ptrdiff_t>(first * ELEMENT_SIZE)))
+            << "first=" << first << " count=" << count;
+    }
+}
+
+TEST(CryptFileTest, InPlace) {
+    auto plain = serialize(make_message(37));
+    StreamCipher cipher(16, make_secret());
+    std::vector<uint8_t> expected(plain.size());
+    SequentialExecutor sequential;
+    cipher.apply(make_nonce(), 0, plain, expected, false, sequential);
+
+    auto buf = plain;
+    cipher.apply(make_nonce(), 0, buf, buf, false);
+    EXPECT_EQ(buf, expected);
+}
+
+TEST(CryptFileTest, RejectsInvalidInput) {
+    EXPECT_THROW(StreamCipher(6, make_secret()), std::invalid_argument);
+
+    StreamCipher cipher(5, make_secret());
+    auto plain = serialize(make_message(10));
+    std::vector<uint8_t> out(plain.size() - 1);
+    EXPECT_THROW(cipher.apply(make_nonce(), 0, plain, out, false), std::invalid_argument);
+
+    // Element 6 set to p, which is not canonical
+    auto p_bytes = Fp::P.to_bytes_le();
+    std::copy(p_bytes.begin(), p_bytes.end(), plain.begin() + 6 * ELEMENT_SIZE);
+    out.assign(plain.size(), 0xee);
+    try {
+        cipher.apply(make_nonce(), 0, plain, out, false);
+        FAIL() << "expected std::invalid_argument";
+    } catch (const std::invalid_argument& e) {
+        EXPECT_NE(std::string(e.what()).find("Element 6"), std::string::npos) << e.what();
+    }
+    // Nothing is written, not even the elements before the bad one
+    EXPECT_EQ(out, std::vector<uint8_t>(plain.size(), 0xee));
+}
+
+// ============================================================================
+// Output files
+// ============================================================================
+
+TEST(CryptFileTest, OutputAppearsOnlyOnCommit) {
+    const std::string path = ::testing::TempDir() + "crypt_file_output.bin";
+    const std::string other = ::testing::TempDir() + "crypt_file_other.bin";
+    std::remove(path.c_str());
+    std::remove(other.c_str());
+
+    {
+        tools::OutputMap out(path, 64);
+        out.bytes()[0] = 1;
+        // Abandoned, as when processing throws
+    }
+    EXPECT_FALSE(std::filesystem::exists(path));
+
+    {
+        tools::OutputMap out(path, 64);
+        out.bytes()[0] = 7;
+        out.commit();
+    }
+    ASSERT_EQ(std::filesystem::file_size(path), 64u);
+    {
+        tools::InputMap in(path);
+        EXPECT_EQ(in.bytes()[0], 7);
+    }
+
+    EXPECT_TRUE(tools::same_file(path, path));
+    EXPECT_FALSE(tools::same_file(path, other));
+    std::filesystem::create_hard_link(path, other);
+    EXPECT_TRUE(tools::same_file(path, other));
+
+    // No temporary files are left in the directory
+    size_t leftovers = 0;
+    for (const auto& entry : std::filesystem::directory_iterator(::testing::TempDir())) {
+        leftovers += entry.path().filename().string().starts_with("crypt_file_output.bin.") ? 1 : 0;
+    }
+    EXPECT_EQ(leftovers, 0u);
+    std::remove(path.c_str());
+    std::remove(other.c_str());
+}
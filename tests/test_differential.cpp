@@ -0,0 +1,518 @@
+/**
+ * @file test_differential.cpp
+ * @brief Randomized differential tests: live implementation vs reference model.
+ *
+ * Every case compares Fp, Matrix and the permutation against the independent
+ * model in reference/rescue_reference.hpp and stops at the first divergence,
+ * printing the inputs, both outputs and a command that replays that case.
+ * Inputs mix uniform 256-bit values with edge values (0, 1, p-1, p, 2^255 - 1,
+ * 2^256 - 1, ...) and their near neighbours.
+ *
+ * Environment:
+ *   RESCUE_DIFF_ITERATIONS  field cases per run (default 1000); matrix and
+ *                           permutation tests run 1/10 and 1/100 as many
+ *   RESCUE_DIFF_SEED        base seed, decimal or 0x-hex, or "random"
+ *
+ * Case i runs with seed base + i * 0x9e3779b97f4a7c15, so case 0 runs with the
+ * base seed itself and RESCUE_DIFF_ITERATIONS=1 replays a single case.
+ */
+
+#include "reference/rescue_reference.hpp"
+
+#include <rescue/rescue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <initializer_list>
+#include <optional>
+#include <random>
+#include <span>
+#include <sstream>
+#include <string>
+#include <string_view>
+
+using namespace rescue;
+namespace ref = rescue::reference;
+
+namespace {
+
+// ============================================================================
+// Configuration
+// ============================================================================
+
+constexpr uint64_t DEFAULT_SEED = 0x52455343554500ULL;
+
+struct Config {
+    uint64_t seed = DEFAULT_SEED;
+    size_t iterations = 1000;
+};
+
+const Config& config() {
+    static const Config cfg = [] {
+        Config c;
+        if (const char* s = std::getenv("RESCUE_DIFF_SEED")) {
+            c.seed = std::string_view(s) == "random" ? std::random_device{}() * 0x100000001ULL
+                                                      : std::stoull(s, nullptr, 0);
+        }
+        if (const char* s = std::getenv("RESCUE_DIFF_ITERATIONS")) {
+            c.iterations = std::stoull(s);
+        }
+        return c;
+    }();
+    return cfg;
+}
+
+/// Number of cases for a test that is `ratio` times as expensive as a field case.
+size_t case_count(size_t ratio) {
+    return std::max<size_t>(1, config().iterations / ratio);
+}
+
+uint64_t case_seed(size_t i) {
+    return config().seed + i * 0x9e3779b97f4a7c15ULL;
+}
+
+std::string reproducer(uint64_t seed, std::string_view test) {
+    std::ostringstream out;
+    out << "\nreproduce: RESCUE_DIFF_SEED=0x" << std::hex << seed
+        << " RESCUE_DIFF_ITERATIONS=1 ./tests/test_differential --gtest_filter=DifferentialTest." << test;
+    return out.str();
+}
+
+// ============================================================================
+// Conversions and inputs
+// ============================================================================
+
+uint256 to_u256(const ref::Limbs& v) {
+    return uint256(v[0], v[1], v[2], v[3]);
+}
+
+Fp to_fp(const ref::Element& e) {
+    return Fp(to_u256(e.v));
+}
+
+ref::Element to_ref(const Fp& x) {
+    const auto& l = x.value().limbs();
+    return {{l[0], l[1], l[2], l[3]}};
+}
+
+ref::Vec to_ref(std::span<const Fp> xs) {
+    ref::Vec out;
+    for (const auto& x : xs) {
+        out.push_back(to_ref(x));
+    }
+    return out;
+}
+
+ref::Mat to_ref(const Matrix& m) {
+    ref::Mat out(m.rows());
+    for (size_t i = 0; i < m.rows(); ++i) {
+        out[i] = to_ref(m.row(i));
+    }
+    return out;
+}
+
+std::string hex(const ref::Limbs& v) {
+    return to_u256(v).to_hex();
+}
+
+/// v + delta, wrapping modulo 2^256.
+ref::Limbs offset(ref::Limbs v, int64_t delta) {
+    uint64_t add = static_cast<uint64_t>(delta);
+    uint64_t fill = delta < 0 ? ~uint64_t{0} : 0;  // Sign extension of delta
+    uint64_t carry = 0;
+    for (size_t i = 0; i < 4; ++i) {
+        unsigned __int128 t = static_cast<unsigned __int128>(v[i]) + (i == 0 ? add : fill) + carry;
+        v[i] = static_cast<uint64_t>(t);
+        carry = static_cast<uint64_t>(t >> 64);
+    }
+    return v;
+}
+
+const std::vector<ref::Limbs>& edge_values() {
+    static const std::vector<ref::Limbs> values = [] {
+        const ref::Limbs zero{};
+        const ref::Limbs two_255{0, 0, 0, 0x8000000000000000ULL};
+        const ref::Limbs half_p{0xfffffffffffffff6ULL, ~uint64_t{0}, ~uint64_t{0}, 0x3fffffffffffffffULL};
+        return std::vector<ref::Limbs>{
+            zero,
+            offset(zero, 1),
+            offset(zero, 2),
+            offset(zero, 19),
+            offset(zero, 38),
+            {~uint64_t{0}, 0, 0, 0},
+            {0, 1, 0, 0},
+            {0, 0, 1, 0},
+            {0, 0, 0, 1},
+            {0, 0, 0, 0x4000000000000000ULL},  // 2^254
+            half_p,                            // (p - 1) / 2
+            offset(half_p, 1),                 // (p + 1) / 2
+            offset(ref::P, -2),
+            offset(ref::P, -1),
+            ref::P,  // Non-canonical from here on
+            offset(ref::P, 1),
+            offset(two_255, -1),
+            two_255,
+            offset(zero, -39),  // 2p - 1
+            offset(zero, -1),   // 2^256 - 1
+        };
+    }();
+    return values;
+}
+
+/**
+ * @brief Seeded source of raw 256-bit inputs, biased toward edge values.
+ */
+class InputGenerator {
+public:
+    explicit InputGenerator(uint64_t seed) : rng_(seed) {}
+
+    /// Any 256-bit value; about half are >= p.
+    ref::Limbs raw() {
+        const auto& edges = edge_values();
+        switch (rng_() % 4) {
+            case 0:
+                return edges[rng_() % edges.size()];
+            case 1:
+                return offset(edges[rng_() % edges.size()], static_cast<int64_t>(rng_() % 64) - 32);
+            default:
+                return {rng_(), rng_(), rng_(), rng_()};
+        }
+    }
+
+    ref::Element element() { return ref::Element::reduce(raw()); }
+
+    uint64_t next() { return rng_(); }
+
+private:
+    std::mt19937_64 rng_;
+};
+
+// ============================================================================
+// Divergence reporting
+// ============================================================================
+
+/**
+ * @brief Records the first live/reference mismatch of a case.
+ */
+class Checker {
+public:
+    void same(std::string_view op, std::initializer_list<ref::Limbs> inputs, const Fp& live,
+              const ref::Element& expected) {
+        if (failure_ || to_ref(live) == expected) {
+            return;
+        }
+        std::ostringstream out;
+        out << op << " diverged\n";
+        for (const auto& in : inputs) {
+            out << "  input:     " << hex(in) << "\n";
+        }
+        out << "  live:      " << live.to_hex() << "\n"
+            << "  reference: " << hex(expected.v);
+        failure_ = out.str();
+    }
+
+    void fail(std::string message) {
+        if (!failure_) {
+            failure_ = std::move(message);
+        }
+    }
+
+    [[nodiscard]] const std::optional<std::string>& failure() const { return failure_; }
+
+private:
+    std::optional<std::string> failure_;
+};
+
+std::string describe(const ref::Vec& v) {
+    std::string out = "[";
+    for (size_t i = 0; i < v.size(); ++i) {
+        out += (i == 0 ? "" : ", ") + hex(v[i].v);
+    }
+    return out + "]";
+}
+
+// ============================================================================
+// Cases
+// ============================================================================
+
+std::optional<std::string> field_case(uint64_t seed) {
+    InputGenerator gen(seed);
+    ref::Limbs a_raw = gen.raw();
+    ref::Limbs b_raw = gen.raw();
+    ref::Limbs e_raw = gen.raw();
+    uint64_t k = gen.next() % 1024;
+
+    Checker check;
+    Fp a(to_u256(a_raw));
+    std::array<uint8_t, 32> b_bytes{};
+    for (size_t i = 0; i < 32; ++i) {
+        b_bytes[i] = static_cast<uint8_t>(b_raw[i / 8] >> (8 * (i % 8)));
+    }
+    Fp b = Fp::from_bytes(b_bytes);
+
+    ref::Element ra = ref::Element::reduce(a_raw);
+    ref::Element rb = ref::Element::reduce(b_raw);
+
+    check.same("Fp(uint256)", {a_raw}, a, ra);
+    check.same("Fp::from_bytes", {b_raw}, b, rb);
+    check.same("add", {ra.v, rb.v}, a + b, ref::add(ra, rb));
+    check.same("sub", {ra.v, rb.v}, a - b, ref::sub(ra, rb));
+    check.same("mul", {ra.v, rb.v}, a * b, ref::mul(ra, rb));
+    check.same("square", {ra.v}, a.square(), ref::mul(ra, ra));
+    check.same("neg", {ra.v}, -a, ref::neg(ra));
+    check.same("fp::pow5", {ra.v}, Fp(fp::pow5(a.value())), ref::pow(ra, {5, 0, 0, 0}));
+    check.same("pow(uint64_t)", {ra.v, {k, 0, 0, 0}}, a.pow(k), ref::pow(ra, {k, 0, 0, 0}));
+    check.same("pow(uint256)", {ra.v, e_raw}, a.pow(to_u256(e_raw)), ref::pow(ra, e_raw));
+    check.same("Fp::from_bytes(to_bytes)", {ra.v}, Fp::from_bytes(a.to_bytes()), ra);
+
+    if (ra.is_zero()) {
+        try {
+            (void)a.inv();
+            check.fail("inv of zero did not throw");
+        } catch (const std::domain_error&) {
+        }
+    } else {
+        check.same("inv", {ra.v}, a.inv(), ref::inv(ra));
+    }
+    return check.failure();
+}
+
+std::optional<std::string> matrix_case(uint64_t seed) {
+    InputGenerator gen(seed);
+    size_t rows = 1 + gen.next() % 6;
+    size_t inner = 1 + gen.next() % 6;
+    size_t cols = 1 + gen.next() % 6;
+    auto random_matrix = [&](size_t r, size_t c) {
+        ref::Mat m(r, ref::Vec(c));
+        for (auto& row : m) {
+            for (auto& x : row) {
+                x = gen.element();
+            }
+        }
+        return m;
+    };
+    auto to_live = [](const ref::Mat& m) {
+        std::vector<std::vector<Fp>> rows;
+        for (const auto& row : m) {
+            std::vector<Fp> r;
+            for (const auto& x : row) {
+                r.push_back(to_fp(x));
+            }
+            rows.push_back(std::move(r));
+        }
+        return Matrix(rows);
+    };
+
+    ref::Mat a = random_matrix(rows, inner);
+    ref::Mat a2 = random_matrix(rows, inner);
+    ref::Mat b = random_matrix(inner, cols);
+    ref::Limbs e = gen.raw();
+
+    ref::Mat sum = a;
+    ref::Mat diff = a;
+    ref::Mat powered = a;
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < inner; ++j) {
+            sum[i][j] = ref::add(a[i][j], a2[i][j]);
+            diff[i][j] = ref::sub(a[i][j], a2[i][j]);
+            powered[i][j] = ref::pow(a[i][j], e);
+        }
+    }
+
+    Matrix la = to_live(a);
+    Matrix la2 = to_live(a2);
+    Matrix lb = to_live(b);
+    Checker check;
+    auto same = [&](std::string_view op, const Matrix& live, const ref::Mat& expected) {
+        if (to_ref(live) != expected) {
+            check.fail(std::string(op) + " diverged for " + std::to_string(rows) + "x" + std::to_string(inner) +
+                       " by " + std::to_string(inner) + "x" + std::to_string(cols));
+        }
+    };
+    same("mat_mul", la.mat_mul(lb), ref::mat_mul(a, b));
+    same("add", la.add(la2), sum);
+    same("add (constant time)", la.add(la2, true), sum);
+    same("sub", la.sub(la2), diff);
+    same("sub (constant time)", la.sub(la2, true), diff);
+    same("pow(uint256)", la.pow(to_u256(e)), powered);
+    return check.failure();
+}
+
+/// Reference parameters for a live descriptor. MDS matrices are rebuilt independently.
+ref::Params reference_params(const RescueDesc& desc) {
+    ref::Params p;
+    p.cipher = desc.is_cipher();
+    p.alpha = desc.alpha().limbs();
+    p.alpha_inverse = desc.alpha_inverse().limbs();
+    p.mds = ref::cauchy(desc.m());
+    p.mds_inverse = ref::invert(p.mds);
+    for (const auto& key : desc.round_keys()) {
+        p.round_keys.push_back(to_ref(key.data()));
+    }
+    return p;
+}
+
+/// Index of the first round whose state differs between the live and reference traces.
+std::string first_divergent_round(const RescueDesc& desc, const std::vector<Fp>& input,
+                                  const std::vector<ref::Vec>& expected) {
+    auto live = rescue_permutation(desc.mode(), desc.alpha(), desc.alpha_inverse(), desc.mds_matrix(),
+                                   desc.round_keys(), to_column_vector(input));
+    for (size_t r = 0; r < std::min(live.size(), expected.size()); ++r) {
+        ref::Vec state = to_ref(live[r].data());
+        if (state != expected[r]) {
+            return "  first divergent round: " + std::to_string(r) + " of " + std::to_string(expected.size()) +
+                   "\n  live:      " + describe(state) + "\n  reference: " + describe(expected[r]);
+        }
+    }
+    return "  traces agree; divergence is in the in-place path only";
+}
+
+struct PermutationShape {
+    bool cipher;
+    size_t m;
+};
+
+constexpr std::array<PermutationShape, 5> SHAPES = {{
+    {true, 5},
+    {true, 8},
+    {true, 12},
+    {true, 16},
+    {false, RESCUE_HASH_STATE_SIZE},
+}};
+
+std::optional<std::string> permutation_case(uint64_t seed) {
+    InputGenerator gen(seed);
+    PermutationShape shape = SHAPES[gen.next() % SHAPES.size()];
+
+    std::vector<Fp> key;
+    std::vector<Fp> input;
+    for (size_t i = 0; i < shape.m; ++i) {
+        key.push_back(to_fp(gen.element()));
+        input.push_back(to_fp(gen.element()));
+    }
+    RescueDesc desc = shape.cipher ? RescueDesc(key) : RescueDesc(shape.m, RESCUE_HASH_CAPACITY);
+    ref::Params params = reference_params(desc);
+    std::string where = std::string(shape.cipher ? "cipher" : "hash") + " m=" + std::to_string(shape.m) +
+                        "\n  input: " + describe(to_ref(input));
+
+    auto trace = ref::permute_trace(params, to_ref(input));
+    const ref::Vec& expected = trace.back();
+    if (ref::permute_inverse(params, expected) != to_ref(input)) {
+        return "reference permute_inverse does not invert permute (" + where + ")";
+    }
+
+    std::vector<Fp> state = input;
+    desc.permute_in_place(state);
+    if (to_ref(state) != expected) {
+        return "permute_in_place diverged for " + where + "\n" + first_divergent_round(desc, input, trace);
+    }
+    if (to_ref(desc.permute(to_column_vector(input)).data()) != expected) {
+        return "permute diverged for " + where + "\n" + first_divergent_round(desc, input, trace);
+    }
+
+    desc.permute_inverse_in_place(state);
+    if (state != input) {
+        return "permute_inverse_in_place diverged for " + where + "\n  live: " + describe(to_ref(state));
+    }
+    Matrix back = desc.permute_inverse(to_column_vector(desc.permute(to_column_vector(input)).data()));
+    if (back.data() != input) {
+        return "permute_inverse diverged for " + where + "\n  live: " + describe(to_ref(back.data()));
+    }
+    return std::nullopt;
+}
+
+}  // anonymous namespace
+
+// ============================================================================
+// Reference self-checks
+// ============================================================================
+
+TEST(ReferenceModelTest, ReductionsAgree) {
+    // 2^255 ≡ 19 and p ≡ 0
+    EXPECT_EQ(ref::Element::reduce({0, 0, 0, 0x8000000000000000ULL}), ref::Element::from_u64(19));
+    EXPECT_TRUE(ref::Element::reduce(ref::P).is_zero());
+
+    // The folding and long-division reductions are independent; cross-check them
+    InputGenerator gen(config().seed);
+    for (size_t i = 0; i < 200; ++i) {
+        ref::Wide x = ref::mul_wide(gen.raw(), gen.raw());
+        ASSERT_EQ(ref::mod_p(x), ref::mod_generic(x, ref::P));
+    }
+}
+
+TEST(ReferenceModelTest, FieldAxioms) {
+    InputGenerator gen(config().seed);
+    const ref::Element one = ref::Element::from_u64(1);
+    EXPECT_TRUE(ref::add(ref::Element{offset(ref::P, -1)}, one).is_zero());
+    for (size_t i = 0; i < 50; ++i) {
+        ref::Element a = gen.element();
+        ref::Element b = gen.element();
+        EXPECT_EQ(ref::sub(ref::add(a, b), b), a);
+        EXPECT_EQ(ref::mul(a, b), ref::mul(b, a));
+        if (!a.is_zero()) {
+            EXPECT_EQ(ref::mul(a, ref::inv(a)), one);
+        }
+    }
+}
+
+TEST(ReferenceModelTest, AlphaIsSmallestPrimeNotDividingPMinusOne) {
+    const ref::Limbs p_minus_1 = offset(ref::P, -1);
+    auto mod_small = [&](uint64_t d) { return ref::mod_generic(ref::widen<8>(p_minus_1), {d, 0, 0, 0})[0]; };
+    EXPECT_EQ(mod_small(2), 0u);
+    EXPECT_EQ(mod_small(3), 0u);
+    EXPECT_NE(mod_small(5), 0u);
+
+    auto [alpha, alpha_inverse] = get_alpha_and_inverse(Fp::P);
+    EXPECT_EQ(alpha, uint256{5});
+    ref::Limbs product = ref::mod_generic(ref::mul_wide(alpha.limbs(), alpha_inverse.limbs()), p_minus_1);
+    EXPECT_EQ(product, (ref::Limbs{1, 0, 0, 0}));
+}
+
+// ============================================================================
+// Differential tests
+// ============================================================================
+
+TEST(DifferentialTest, FieldOps) {
+    for (size_t i = 0; i < case_count(1); ++i) {
+        uint64_t seed = case_seed(i);
+        auto failure = field_case(seed);
+        ASSERT_FALSE(failure) << *failure << reproducer(seed, "FieldOps");
+    }
+}
+
+TEST(DifferentialTest, MatrixOps) {
+    for (size_t i = 0; i < case_count(10); ++i) {
+        uint64_t seed = case_seed(i);
+        auto failure = matrix_case(seed);
+        ASSERT_FALSE(failure) << *failure << reproducer(seed, "MatrixOps");
+    }
+}
+
+TEST(DifferentialTest, MdsMatrices) {
+    for (size_t m : {size_t{2}, size_t{5}, size_t{8}, size_t{12}, size_t{16}}) {
+        ref::Mat mds = ref::cauchy(m);
+        ref::Mat mds_inverse = ref::invert(mds);
+        EXPECT_EQ(to_ref(build_cauchy_matrix(m)), mds) << "m=" << m;
+        EXPECT_EQ(to_ref(build_inverse_cauchy_matrix(m)), mds_inverse) << "m=" << m;
+    }
+
+    // Descriptors may load precomputed tables instead of building them
+    RescueDesc hash(RESCUE_HASH_STATE_SIZE, RESCUE_HASH_CAPACITY);
+    EXPECT_EQ(to_ref(hash.mds_matrix()), ref::cauchy(RESCUE_HASH_STATE_SIZE));
+    for (size_t m : {size_t{5}, size_t{8}, size_t{16}}) {
+        RescueDesc cipher(std::vector<Fp>(m, Fp(uint64_t{1})));
+        EXPECT_EQ(to_ref(cipher.mds_matrix()), ref::cauchy(m)) << "m=" << m;
+        EXPECT_EQ(to_ref(cipher.mds_matrix_inverse()), ref::invert(ref::cauchy(m))) << "m=" << m;
+    }
+}
+
+TEST(DifferentialTest, Permutations) {
+    for (size_t i = 0; i < case_count(100); ++i) {
+        uint64_t seed = case_seed(i);
+        auto failure = permutation_case(seed);
+        ASSERT_FALSE(failure) << *failure << reproducer(seed, "Permutations");
+    }
+}
@@ -0,0 +1,126 @@
+/**
+ * @file test_executor.cpp
+ * @brief Tests for the executors and the parallel cipher and hash APIs.
+ */
+
+#include <rescue/executor.hpp>
+
+#include <rescue/rescue_cipher.hpp>
+#include <rescue/rescue_hash.hpp>
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <atomic>
+#include <stdexcept>
+#include <vector>
+
+using namespace rescue;
+
+namespace {
+
+/// Forwards to another executor and counts the calls
+class CountingExecutor : public Executor {
+public:
+    explicit CountingExecutor(Executor& inner) : inner_(inner) {}
+
+    [[nodiscard]] size_t concurrency() const noexcept override { return inner_.concurrency(); }
+
+    void parallel_for(size_t n, const Task& task) override {
+        calls.fetch_add(1);
+        inner_.parallel_for(n, task);
+    }
+
+    std::atomic<size_t> calls{0};
+
+private:
+    Executor& inner_;
+};
+
+std::vector<Fp> elements(size_t n) {
+    std::vector<Fp> out;
+    for (size_t i = 0; i < n; ++i) {
+        out.push_back(Fp(uint64_t{i * 31 + 7}));
+    }
+    return out;
+}
+
+constexpr std::array<uint8_t, RESCUE_CIPHER_NONCE_SIZE> NONCE = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+
+}  // anonymous namespace
+
+TEST(ExecutorTest, ParallelForRunsEveryIndexOnce) {
+    WorkStealingExecutor pool(WorkStealingExecutor::Options{.threads = 4});
+    EXPECT_EQ(pool.concurrency(), 4u);
+
+    for (size_t n : {size_t{0}, size_t{1}, size_t{7}, size_t{1000}, size_t{100000}}) {
+        std::vector<std::atomic<int>> hits(n);
+        pool.parallel_for(n, [&](size_t i) { hits[i].fetch_add(1, std::memory_order_relaxed); });
+        for (size_t i = 0; i < n; ++i) {
+            ASSERT_EQ(hits[i].load(), 1) << "n=" << n << " i=" << i;
+        }
+    }
+}
+
+TEST(ExecutorTest, NestedParallelForCompletes) {
+    // Fewer workers than outer tasks, each of which waits on an inner loop
+    WorkStealingExecutor pool(WorkStealingExecutor::Options{.threads = 2, .pin_threads = true});
+    std::atomic<size_t> total{0};
+    pool.parallel_for(16, [&](size_t) {
+        pool.parallel_for(16, [&](size_t) {
+            pool.parallel_for(4, [&](size_t) { total.fetch_add(1, std::memory_order_relaxed); });
+        });
+    });
+    EXPECT_EQ(total.load(), 16u * 16u * 4u);
+}
+
+TEST(ExecutorTest, ExceptionsPropagate) {
+    WorkStealingExecutor pool(WorkStealingExecutor::Options{.threads = 3});
+    EXPECT_THROW(pool.parallel_for(1000,
+                                   [](size_t i) {
+                                       if (i == 517) {
+                                           throw std::runtime_error("task failed");
+                                       }
+                                   }),
+                 std::runtime_error);
+
+    // The pool is still usable afterwards
+    std::atomic<size_t> count{0};
+    pool.parallel_for(100, [&](size_t) { count.fetch_add(1); });
+    EXPECT_EQ(count.load(), 100u);
+
+    SequentialExecutor seq;
+    EXPECT_THROW(seq.parallel_for(3, [](size_t) { throw std::logic_error("x"); }), std::logic_error);
+}
+
+TEST(ExecutorTest, ParallelCipherMatchesSequential) {
+    std::array<uint8_t, RESCUE_CIPHER_SECRET_SIZE> secret{};
+    secret[0] = 42;
+    RescueCipher cipher(secret);
+    WorkStealingExecutor pool(WorkStealingExecutor::Options{.threads = 3});
+
+    // Partial last block included
+    const auto plaintext = elements(4 * RESCUE_CIPHER_BLOCK_SIZE + 2);
+    const auto expected = cipher.encrypt_raw(plaintext, NONCE);
+    const auto ciphertext = cipher.encrypt_raw(plaintext, NONCE, pool);
+    EXPECT_EQ(ciphertext, expected);
+    EXPECT_EQ(cipher.decrypt_raw(ciphertext, NONCE, pool), plaintext);
+    EXPECT_TRUE(cipher.encrypt_raw({}, NONCE, pool).empty());
+}
+
+TEST(ExecutorTest, DigestManyMatchesDigest) {
+    RescuePrimeHash hasher;
+    std::vector<std::vector<Fp>> messages = {{}, elements(1), elements(7), elements(15)};
+
+    SequentialExecutor seq;
+    CountingExecutor counting(seq);
+    const auto digests = hasher.digest_many(messages, counting);
+    EXPECT_EQ(counting.calls.load(), 1u);
+    ASSERT_EQ(digests.size(), messages.size());
+    for (size_t i = 0; i < messages.size(); ++i) {
+        EXPECT_EQ(digests[i], hasher.digest(messages[i]));
+    }
+
+    EXPECT_EQ(hasher.digest_many(messages, default_executor()), digests);
+    EXPECT_GE(default_executor().concurrency(), 1u);
+}
@@ -132,6 +132,11 @@ TEST_F(FpTest, Power) {
     // Fermat's little theorem: a^(p-1) = 1 for a != 0
     Fp a(uint64_t{7});
     EXPECT_EQ(a.pow(Fp::P - uint256::one()), one);
+
+    // Exponents are not reduced, so bit 255 counts: a^(2^255) = (a^(2^254))^2
+    uint256 two_254(0, 0, 0, uint64_t{1} << 62);
+    uint256 two_255(0, 0, 0, uint64_t{1} << 63);
+    EXPECT_EQ(a.pow(two_255), a.pow(two_254).square());
 }
 
 TEST_F(FpTest, Square) {
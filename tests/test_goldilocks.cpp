@@ -0,0 +1,141 @@
+/**
+ * @file test_goldilocks.cpp
+ * @brief Tests for the Goldilocks field and the generic Rescue-Prime hash.
+ */
+
+#include <rescue/rescue_prime.hpp>
+
+#include <rescue/rescue_hash.hpp>
+
+#include <gtest/gtest.h>
+
+#include <random>
+#include <vector>
+
+using namespace rescue;
+
+namespace {
+
+constexpr uint64_t P = Goldilocks::MODULUS;
+
+uint64_t ref_mul(uint64_t a, uint64_t b) {
+    return static_cast<uint64_t>(static_cast<unsigned __int128>(a) * b % P);
+}
+
+uint64_t ref_add(uint64_t a, uint64_t b) {
+    return static_cast<uint64_t>((static_cast<unsigned __int128>(a) + b) % P);
+}
+
+uint64_t ref_sub(uint64_t a, uint64_t b) { return a >= b ? a - b : P - (b - a); }
+
+}  // anonymous namespace
+
+// ============================================================================
+// Goldilocks arithmetic
+// ============================================================================
+
+TEST(GoldilocksTest, ArithmeticMatchesReference) {
+    std::mt19937_64 rng(7);
+    std::vector<uint64_t> values = {0, 1, 2, P - 1, P - 2, 0xFFFFFFFF, 0x100000000ULL, P >> 1, (P >> 1) + 1};
+    for (int i = 0; i < 200; ++i) {
+        values.push_back(rng() % P);
+    }
+
+    for (uint64_t a : values) {
+        for (uint64_t b : values) {
+            Goldilocks x(a), y(b);
+            ASSERT_EQ((x + y).value(), ref_add(a, b)) << a << " + " << b;
+            ASSERT_EQ((x - y).value(), ref_sub(a, b)) << a << " - " << b;
+            ASSERT_EQ((x * y).value(), ref_mul(a, b)) << a << " * " << b;
+        }
+    }
+}
+
+TEST(GoldilocksTest, ConstructionReduces) {
+    EXPECT_EQ(Goldilocks(P).value(), 0u);
+    EXPECT_EQ(Goldilocks(~uint64_t{0}).value(), 0xFFFFFFFEULL);
+    EXPECT_EQ(Goldilocks(Goldilocks::P), Goldilocks::ZERO);
+    // 2^64 = 2^32 - 1 and 2^128 = (2^32 - 1)^2 = -2^32 (mod p)
+    EXPECT_EQ(Goldilocks(uint256(0, 1, 0, 0)).value(), 0xFFFFFFFFULL);
+    EXPECT_EQ(Goldilocks(uint256(0, 0, 1, 0)).value(), P - 0x100000000ULL);
+}
+
+TEST(GoldilocksTest, InverseAndPow) {
+    std::mt19937_64 rng(11);
+    for (int i = 0; i < 100; ++i) {
+        Goldilocks x(rng() % P);
+        if (x.is_zero()) {
+            continue;
+        }
+        EXPECT_EQ(x * x.inv(), Goldilocks::ONE);
+        EXPECT_EQ(x.pow(uint64_t{7}), x.pow(uint256(7)));
+    }
+    EXPECT_EQ(Goldilocks::ZERO.inv(), Goldilocks::ZERO);
+    EXPECT_EQ(Goldilocks(uint64_t{2}).pow(uint64_t{64}).value(), 0xFFFFFFFFULL);
+}
+
+TEST(GoldilocksTest, BytesRoundTrip) {
+    Goldilocks x(0x0123456789ABCDEFULL);
+    auto bytes = x.to_bytes();
+    EXPECT_EQ(bytes[0], 0xEF);
+    EXPECT_EQ(Goldilocks::from_bytes(bytes), x);
+}
+
+// ============================================================================
+// BasicRescuePrime
+// ============================================================================
+
+TEST(GoldilocksRescuePrimeTest, DerivedParameters) {
+    GoldilocksRescuePrimeHash hasher;
+    const auto& perm = hasher.permutation();
+    EXPECT_EQ(hasher.state_size(), 12u);
+    // p - 1 = 2^32 * 3 * 5 * 17 * 257 * 65537
+    EXPECT_EQ(perm.alpha(), 7u);
+    EXPECT_EQ(Goldilocks(uint64_t{123}).pow(uint64_t{7}).pow(perm.alpha_inverse()), Goldilocks(uint64_t{123}));
+    EXPECT_GE(perm.n_rounds(), 5u);
+    EXPECT_EQ(perm.round_constants().size(), (2 * perm.n_rounds() + 1) * perm.m());
+
+    auto mds = perm.mds_matrix();
+    for (size_t i = 0; i < perm.m(); ++i) {
+        for (size_t j = 0; j < perm.m(); ++j) {
+            EXPECT_EQ(mds[i * perm.m() + j] * Goldilocks(uint64_t{i + j + 2}), Goldilocks::ONE);
+        }
+    }
+}
+
+TEST(GoldilocksRescuePrimeTest, FpInstanceMatchesRescuePrimeHash) {
+    // The generic derivation reproduces the 2^255 - 19 instance exactly
+    RescuePrimeHash reference;
+    BasicRescuePrimeHash<Fp> generic;
+    for (size_t len : {0u, 1u, 6u, 7u, 8u, 20u}) {
+        std::vector<Fp> message;
+        for (size_t i = 0; i < len; ++i) {
+            message.push_back(Fp(uint64_t{i * 977 + 3}));
+        }
+        EXPECT_EQ(generic.digest(message), reference.digest(message)) << "length " << len;
+    }
+}
+
+TEST(GoldilocksRescuePrimeTest, DigestProperties) {
+    GoldilocksRescuePrimeHash hasher;
+    std::vector<Goldilocks> a = {Goldilocks(uint64_t{1}), Goldilocks(uint64_t{2}), Goldilocks(uint64_t{3})};
+    std::vector<Goldilocks> b = a;
+    b.push_back(Goldilocks::ZERO);
+
+    auto da = hasher.digest(a);
+    EXPECT_EQ(da.size(), 4u);
+    EXPECT_EQ(da, GoldilocksRescuePrimeHash().digest(a));
+    // Padding separates a message from its zero-extension
+    EXPECT_NE(da, hasher.digest(b));
+    EXPECT_NE(hasher.digest({}), hasher.digest(std::vector<Goldilocks>{Goldilocks::ZERO}));
+}
+
+TEST(GoldilocksRescuePrimeTest, RejectsBadParameters) {
+    EXPECT_THROW(GoldilocksRescuePrimeHash(8, 0, 4, 128), std::invalid_argument);
+    EXPECT_THROW(GoldilocksRescuePrimeHash(8, 4, 0, 128), std::invalid_argument);
+    EXPECT_THROW(GoldilocksRescuePrimeHash(8, 4, 13, 128), std::invalid_argument);
+
+    BasicRescuePrime<Goldilocks> perm(12, 4, 128);
+    std::vector<Goldilocks> state(11);
+    EXPECT_THROW(perm.permute_in_place(state), std::invalid_argument);
+}
@@ -0,0 +1,155 @@
+/**
+ * @file test_kernels.cpp
+ * @brief Tests for the kernel variant registry.
+ */
+
+#include <rescue/kernels.hpp>
+
+#include <rescue/rescue_desc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <cstdlib>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace rescue;
+
+namespace {
+
+std::vector<KernelVariant> available_variants() {
+    std::vector<KernelVariant> out;
+    for (size_t v = 0; v < KERNEL_VARIANT_COUNT; ++v) {
+        if (kernel_variant_available(static_cast<KernelVariant>(v))) {
+            out.push_back(static_cast<KernelVariant>(v));
+        }
+    }
+    return out;
+}
+
+std::vector<Fp> test_states(size_t m, size_t lanes) {
+    std::vector<Fp> states;
+    for (size_t i = 0; i < m * lanes; ++i) {
+        states.push_back(Fp(uint64_t{i * 7919 + 3}));
+    }
+    return states;
+}
+
+struct Outputs {
+    std::vector<Fp> forward;
+    std::vector<Fp> many;
+    std::vector<Fp> inverse;
+    std::vector<Fp> trace;
+};
+
+Outputs run_all(const RescueDesc& desc) {
+    Outputs out;
+    out.forward = test_states(desc.m(), 1);
+    desc.permute_in_place(out.forward);
+    out.many = test_states(desc.m(), 3);
+    desc.permute_many(out.many);
+    out.inverse = test_states(desc.m(), 1);
+    desc.permute_inverse_in_place(out.inverse);
+    std::vector<Fp> state = test_states(desc.m(), 1);
+    out.trace.resize(desc.trace_rows() * desc.m());
+    desc.permute_traced(state, out.trace);
+    return out;
+}
+
+}  // anonymous namespace
+
+TEST(KernelsTest, PortableIsAlwaysAvailable) {
+    EXPECT_TRUE(kernel_variant_available(KernelVariant::PORTABLE));
+    EXPECT_FALSE(kernel_variant_available(KernelVariant::COUNT));
+}
+
+TEST(KernelsTest, EveryVariantComputesTheSamePermutation) {
+    RescueDesc cipher({Fp(1), Fp(2), Fp(3), Fp(4), Fp(5)});
+    RescueDesc hash(12, 5);
+
+    set_kernel_variant(KernelVariant::PORTABLE);
+    const Outputs cipher_ref = run_all(cipher);
+    const Outputs hash_ref = run_all(hash);
+
+    for (KernelVariant v : available_variants()) {
+        set_kernel_variant(v);
+        const Outputs c = run_all(cipher);
+        const Outputs h = run_all(hash);
+        EXPECT_EQ(c.forward, cipher_ref.forward) << name(v);
+        EXPECT_EQ(c.many, cipher_ref.many) << name(v);
+        EXPECT_EQ(c.inverse, cipher_ref.inverse) << name(v);
+        EXPECT_EQ(c.trace, cipher_ref.trace) << name(v);
+        EXPECT_EQ(h.forward, hash_ref.forward) << name(v);
+        EXPECT_EQ(h.many, hash_ref.many) << name(v);
+    }
+    reset_kernel_variants();
+
+    // Forward then inverse round-trips, whichever variants are mixed
+    set_kernel_variant(Kernel::PERMUTATION, available_variants().back());
+    set_kernel_variant(Kernel::SBOX, KernelVariant::PORTABLE);
+    std::vector<Fp> state = test_states(cipher.m(), 1);
+    cipher.permute_in_place(state);
+    cipher.permute_inverse_in_place(state);
+    EXPECT_EQ(state, test_states(cipher.m(), 1));
+    reset_kernel_variants();
+}
+
+TEST(KernelsTest, ActiveKernelsNamesEveryBinding) {
+    reset_kernel_variants();
+    std::string expected;
+    for (size_t k = 0; k < KERNEL_COUNT; ++k) {
+        const auto kernel = static_cast<Kernel>(k);
+        expected += std::string(k > 0 ? " " : "") + name(kernel) + "=" + name(active_variant(kernel));
+    }
+    EXPECT_EQ(active_kernels(), expected);
+
+    // Without an override the best available variant is bound
+    if (std::getenv("RESCUE_FORCE_KERNEL") == nullptr) {
+        EXPECT_EQ(active_variant(Kernel::PERMUTATION), available_variants().back());
+    }
+
+    set_kernel_variant(Kernel::MDS, KernelVariant::PORTABLE);
+    EXPECT_EQ(active_variant(Kernel::MDS), KernelVariant::PORTABLE);
+    reset_kernel_variants();
+
+    for (size_t v = 0; v < KERNEL_VARIANT_COUNT; ++v) {
+        if (!kernel_variant_available(static_cast<KernelVariant>(v))) {
+            EXPECT_THROW(set_kernel_variant(static_cast<KernelVariant>(v)), std::invalid_argument);
+        }
+    }
+}
+
+// The environment is read once per process, so these run in a fresh one
+TEST(KernelsDeathTest, ForceKernelPinsVariants) {
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    EXPECT_EXIT(
+        {
+            setenv("RESCUE_FORCE_KERNEL", "bmi2,sbox=portable", 1);
+            const bool bmi2 = kernel_variant_available(KernelVariant::BMI2);
+            try {
+                const bool ok = active_variant(Kernel::SBOX) == KernelVariant::PORTABLE &&
+                                (!bmi2 || active_variant(Kernel::MDS) == KernelVariant::BMI2);
+                std::_Exit(ok ? 0 : 1);
+            } catch (const std::runtime_error&) {
+                // Only a host without BMI2/ADX rejects the pin
+                std::_Exit(bmi2 ? 1 : 0);
+            }
+        },
+        ::testing::ExitedWithCode(0), "");
+}
+
+TEST(KernelsDeathTest, InvalidForceKernelIsAnError) {
+    GTEST_FLAG_SET(death_test_style, "threadsafe");
+    EXPECT_EXIT(
+        {
+            setenv("RESCUE_FORCE_KERNEL", "sbox=fastest", 1);
+            try {
+                (void)active_kernels();
+            } catch (const std::runtime_error&) {
+                std::_Exit(0);
+            }
+            std::_Exit(1);
+        },
+        ::testing::ExitedWithCode(0), "");
+}
@@ -0,0 +1,151 @@
+/**
+ * @file test_merkle.cpp
+ * @brief Tests for batched Merkle path verification.
+ */
+
+#include <rescue/merkle.hpp>
+
+#include <rescue/metrics.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace rescue;
+
+namespace {
+
+MerkleDigest leaf(uint64_t i) {
+    MerkleDigest d;
+    for (size_t k = 0; k < d.size(); ++k) {
+        d[k] = Fp(uint64_t{i * 1000 + k + 1});
+    }
+    return d;
+}
+
+/// A complete tree over 2^depth leaves, stored level by level from the leaves
+struct Tree {
+    std::vector<std::vector<MerkleDigest>> levels;
+
+    Tree(const MerkleVerifier& verifier, size_t depth) {
+        levels.emplace_back();
+        for (uint64_t i = 0; i < (uint64_t{1} << depth); ++i) {
+            levels[0].push_back(leaf(i));
+        }
+        for (size_t l = 0; l < depth; ++l) {
+            std::vector<MerkleDigest> up;
+            for (size_t i = 0; i < levels[l].size(); i += 2) {
+                up.push_back(verifier.hash_pair(levels[l][i], levels[l][i + 1]));
+            }
+            levels.push_back(std::move(up));
+        }
+    }
+
+    [[nodiscard]] const MerkleDigest& root() const { return levels.back()[0]; }
+
+    [[nodiscard]] MerklePath path(uint64_t index) const {
+        MerklePath p{leaf(index), index, {}};
+        for (size_t l = 0; l + 1 < levels.size(); ++l) {
+            p.siblings.push_back(levels[l][(index >> l) ^ 1]);
+        }
+        return p;
+    }
+};
+
+}  // anonymous namespace
+
+TEST(MerkleTest, HashPairMatchesDigestOfConcatenation) {
+    MerkleVerifier verifier;
+    RescuePrimeHash hasher;
+    const MerkleDigest left = leaf(3);
+    const MerkleDigest right = leaf(4);
+    std::vector<Fp> message(left.begin(), left.end());
+    message.insert(message.end(), right.begin(), right.end());
+
+    auto expected = hasher.digest(message);
+    auto actual = verifier.hash_pair(left, right);
+    EXPECT_EQ(std::vector<Fp>(actual.begin(), actual.end()), expected);
+}
+
+TEST(MerkleTest, PermuteManyMatchesPermuteInPlace) {
+    RescueDesc desc(RESCUE_HASH_STATE_SIZE, RESCUE_HASH_CAPACITY);
+    std::vector<Fp> states;
+    for (uint64_t i = 0; i < 3 * desc.m(); ++i) {
+        states.push_back(Fp(i * 7 + 1));
+    }
+    std::vector<Fp> expected = states;
+    for (size_t lane = 0; lane < 3; ++lane) {
+        desc.permute_in_place(std::span<Fp>(expected).subspan(lane * desc.m(), desc.m()));
+    }
+    desc.permute_many(states);
+    EXPECT_EQ(states, expected);
+
+    std::vector<Fp> ragged(desc.m() + 1);
+    EXPECT_THROW(desc.permute_many(ragged), std::invalid_argument);
+}
+
+TEST(MerkleTest, BatchMatchesSingleVerification) {
+    MerkleVerifier verifier;
+    Tree tree(verifier, 3);
+
+    std::vector<MerklePath> paths;
+    for (uint64_t i = 0; i < 8; ++i) {
+        paths.push_back(tree.path(i));
+    }
+    // Forged: wrong leaf, wrong sibling, wrong index, index past the tree
+    paths.push_back(tree.path(2));
+    paths.back().leaf = leaf(9);
+    paths.push_back(tree.path(5));
+    paths.back().siblings[1][0] += Fp::ONE;
+    paths.push_back(tree.path(6));
+    paths.back().index = 7;
+    paths.push_back(tree.path(1));
+    paths.back().index = 9;
+    // Duplicate of a valid path
+    paths.push_back(tree.path(4));
+
+    auto flags = verifier.verify_paths(paths, tree.root());
+    ASSERT_EQ(flags.size(), paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        EXPECT_EQ(flags[i], verifier.verify_path(paths[i], tree.root())) << "path " << i;
+        EXPECT_EQ(flags[i], i < 8 || i == 12) << "path " << i;
+    }
+}
+
+TEST(MerkleTest, MixedDepthsAndEmptyBatch) {
+    MerkleVerifier verifier;
+    Tree shallow(verifier, 1);
+    Tree deep(verifier, 2);
+
+    // Depth-1 paths against the depth-1 root; a depth-2 path cannot match it
+    std::vector<MerklePath> paths = {shallow.path(0), deep.path(3), shallow.path(1)};
+    EXPECT_EQ(verifier.verify_paths(paths, shallow.root()), (std::vector<bool>{true, false, true}));
+    EXPECT_EQ(verifier.verify_paths(paths, deep.root()), (std::vector<bool>{false, true, false}));
+
+    EXPECT_TRUE(verifier.verify_paths({}, shallow.root()).empty());
+
+    // A path with no siblings proves the root itself
+    MerklePath trivial{shallow.root(), 0, {}};
+    EXPECT_TRUE(verifier.verify_paths(std::span<const MerklePath>(&trivial, 1), shallow.root())[0]);
+}
+
+TEST(MerkleTest, OverlappingPathsShareParents) {
+    MerkleVerifier verifier;
+    Tree tree(verifier, 3);
+    std::vector<MerklePath> paths;
+    for (uint64_t i = 0; i < 8; ++i) {
+        paths.push_back(tree.path(i));
+    }
+
+    metrics::reset();
+    metrics::set_enabled(true);
+    auto flags = verifier.verify_paths(paths, tree.root());
+    auto snap = metrics::snapshot();
+    metrics::set_enabled(false);
+    metrics::reset();
+
+    EXPECT_EQ(flags, std::vector<bool>(8, true));
+    // Every internal node once: 4 + 2 + 1 parents at two permutations each,
+    // instead of 8 paths x 3 levels
+    EXPECT_EQ(snap.counter(metrics::Counter::PERMUTATIONS), 2u * 7u);
+}
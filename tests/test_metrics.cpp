@@ -0,0 +1,124 @@
+/**
+ * @file test_metrics.cpp
+ * @brief Unit tests for the runtime metrics registry.
+ */
+
+#include <rescue/metrics.hpp>
+#include <rescue/rescue_cipher.hpp>
+#include <rescue/rescue_hash.hpp>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+#include <vector>
+
+using namespace rescue;
+
+class MetricsTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        metrics::set_enabled(true);
+        metrics::reset();
+    }
+
+    void TearDown() override {
+        metrics::set_enabled(false);
+        metrics::reset();
+    }
+
+    static std::array<uint8_t, 32> test_secret() {
+        std::array<uint8_t, 32> secret{};
+        for (size_t i = 0; i < secret.size(); ++i) {
+            secret[i] = static_cast<uint8_t>(i);
+        }
+        return secret;
+    }
+};
+
+TEST_F(MetricsTest, DisabledRecordsNothing) {
+    metrics::set_enabled(false);
+
+    RescuePrimeHash hasher;
+    (void)hasher.digest(std::vector<Fp>{Fp(uint64_t{1})});
+    metrics::add(metrics::Counter::PERMUTATIONS, 10);
+
+    auto snap = metrics::snapshot();
+    for (uint64_t value : snap.counters) {
+        EXPECT_EQ(value, 0u);
+    }
+    for (const auto& phase : snap.phases) {
+        EXPECT_EQ(phase.count, 0u);
+    }
+}
+
+TEST_F(MetricsTest, CipherLifecycleIsCounted) {
+    RescueCipher cipher(test_secret());
+    std::array<uint8_t, 16> nonce{};
+    std::vector<Fp> plaintext(12, Fp(uint64_t{7}));
+
+    auto ciphertext = cipher.encrypt_raw(plaintext, nonce);
+    auto decrypted = cipher.decrypt_raw(ciphertext, nonce);
+    ASSERT_EQ(decrypted, plaintext);
+
+    auto snap = metrics::snapshot();
+    EXPECT_EQ(snap.counter(metrics::Counter::CIPHER_CONSTRUCTIONS), 1u);
+    EXPECT_EQ(snap.counter(metrics::Counter::ELEMENTS_ENCRYPTED), 12u);
+    EXPECT_EQ(snap.counter(metrics::Counter::ELEMENTS_DECRYPTED), 12u);
+    EXPECT_EQ(snap.counter(metrics::Counter::HASH_BLOCKS_ABSORBED), 1u);
+    // KDF hash + key schedule + 3 blocks each for encryption and decryption
+    EXPECT_EQ(snap.counter(metrics::Counter::PERMUTATIONS), 8u);
+
+    EXPECT_EQ(snap.phase(metrics::Phase::KEY_DERIVATION).count, 1u);
+    // The KDF hash and the cipher itself each set up a RescueDesc
+    EXPECT_EQ(snap.phase(metrics::Phase::ROUND_PARAMETERS).count, 2u);
+    EXPECT_EQ(snap.phase(metrics::Phase::MDS_SETUP).count, 2u);
+    EXPECT_EQ(snap.phase(metrics::Phase::CONSTANT_SAMPLING).count, 2u);
+    EXPECT_EQ(snap.phase(metrics::Phase::KEY_SCHEDULE).count, 1u);
+    EXPECT_EQ(snap.phase(metrics::Phase::ENCRYPTION).count, 1u);
+    EXPECT_EQ(snap.phase(metrics::Phase::DECRYPTION).count, 1u);
+    EXPECT_GT(snap.phase(metrics::Phase::ENCRYPTION).total_ns, 0u);
+}
+
+TEST_F(MetricsTest, ShardsAggregateAcrossThreads) {
+    constexpr size_t THREADS = 4;
+    constexpr uint64_t PER_THREAD = 1000;
+
+    std::vector<std::thread> workers;
+    for (size_t t = 0; t < THREADS; ++t) {
+        workers.emplace_back([] {
+            for (uint64_t i = 0; i < PER_THREAD; ++i) {
+                metrics::add(metrics::Counter::HASH_BLOCKS_ABSORBED);
+            }
+            metrics::record(metrics::Phase::ENCRYPTION, std::chrono::microseconds(3));
+        });
+    }
+    for (auto& w : workers) {
+        w.join();
+    }
+
+    // Shards of exited threads keep their totals
+    auto snap = metrics::snapshot();
+    EXPECT_EQ(snap.counter(metrics::Counter::HASH_BLOCKS_ABSORBED), THREADS * PER_THREAD);
+    EXPECT_EQ(snap.phase(metrics::Phase::ENCRYPTION).count, THREADS);
+    // 3us falls in the (2us, 4us] bucket
+    EXPECT_EQ(snap.phase(metrics::Phase::ENCRYPTION).buckets[2], THREADS);
+}
+
+TEST_F(MetricsTest, PrometheusExposition) {
+    metrics::add(metrics::Counter::PERMUTATIONS, 42);
+    metrics::record(metrics::Phase::KEY_SCHEDULE, std::chrono::milliseconds(5));
+
+    std::string text = metrics::to_prometheus(metrics::snapshot());
+
+    EXPECT_NE(text.find("# TYPE rescue_permutations_total counter\n"), std::string::npos);
+    EXPECT_NE(text.find("rescue_permutations_total 42\n"), std::string::npos);
+    EXPECT_NE(text.find("# TYPE rescue_phase_duration_seconds histogram\n"), std::string::npos);
+    EXPECT_NE(text.find("rescue_phase_duration_seconds_bucket{phase=\"key_schedule\",le=\"+Inf\"} 1\n"),
+              std::string::npos);
+    EXPECT_NE(text.find("rescue_phase_duration_seconds_bucket{phase=\"key_schedule\",le=\"0.004096\"} 0\n"),
+              std::string::npos);
+    EXPECT_NE(text.find("rescue_phase_duration_seconds_bucket{phase=\"key_schedule\",le=\"0.008192\"} 1\n"),
+              std::string::npos);
+    EXPECT_NE(text.find("rescue_phase_duration_seconds_count{phase=\"key_schedule\"} 1\n"),
+              std::string::npos);
+}
@@ -0,0 +1,256 @@
+/**
+ * @file test_mmr.cpp
+ * @brief Tests for the Merkle Mountain Range accumulator.
+ */
+
+#include <rescue/mmr.hpp>
+
+#include <rescue/metrics.hpp>
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <stdexcept>
+#include <vector>
+
+#if defined(__linux__)
+#include <csignal>
+#include <sys/resource.h>
+#endif
+
+using namespace rescue;
+
+namespace {
+
+MmrDigest leaf(uint64_t i) {
+    MmrDigest d;
+    for (size_t k = 0; k < d.size(); ++k) {
+        d[k] = Fp(uint64_t{i * 1000 + k + 1});
+    }
+    return d;
+}
+
+/// Root of a perfect tree over leaves [first, first + 2^height)
+MmrDigest perfect_root(const MerkleMountainRange& mmr, uint64_t first, size_t height) {
+    if (height == 0) {
+        return leaf(first);
+    }
+    const uint64_t half = uint64_t{1} << (height - 1);
+    return mmr.hash_children(perfect_root(mmr, first, height - 1), perfect_root(mmr, first + half, height - 1));
+}
+
+class MmrJournalTest : public ::testing::Test {
+protected:
+    std::filesystem::path path_ = std::filesystem::temp_directory_path() /
+                                  ("rescue_mmr_" + std::to_string(::testing::UnitTest::GetInstance()->random_seed()) +
+                                   "_" + ::testing::UnitTest::GetInstance()->current_test_info()->name());
+
+    void SetUp() override { std::filesystem::remove(path_); }
+    void TearDown() override { std::filesystem::remove(path_); }
+};
+
+}  // anonymous namespace
+
+// ============================================================================
+// Structure
+// ============================================================================
+
+TEST(MmrTest, NodesFollowPostOrder) {
+    MerkleMountainRange mmr;
+    for (uint64_t i = 0; i < 16; ++i) {
+        EXPECT_EQ(mmr.append(leaf(i)), i);
+        EXPECT_EQ(mmr.node_count(), MerkleMountainRange::node_count_for(i + 1));
+    }
+    // 16 leaves form one perfect tree whose root is the last node
+    EXPECT_EQ(mmr.node(mmr.node_count() - 1), perfect_root(mmr, 0, 4));
+    EXPECT_EQ(mmr.node(2), mmr.hash_children(leaf(0), leaf(1)));
+}
+
+TEST(MmrTest, RootCommitsToEveryAppend) {
+    MerkleMountainRange mmr;
+    std::vector<MmrDigest> roots = {mmr.root()};
+    EXPECT_EQ(roots[0], MmrDigest{});
+    for (uint64_t i = 0; i < 20; ++i) {
+        mmr.append(leaf(i));
+        roots.push_back(mmr.root());
+    }
+    for (size_t a = 0; a < roots.size(); ++a) {
+        for (size_t b = a + 1; b < roots.size(); ++b) {
+            EXPECT_NE(roots[a], roots[b]) << a << " vs " << b;
+        }
+    }
+}
+
+TEST(MmrTest, AppendCostsOnePermutationAmortized) {
+    MerkleMountainRange mmr;
+    metrics::reset();
+    metrics::set_enabled(true);
+    constexpr uint64_t N = 1024;
+    for (uint64_t i = 0; i < N; ++i) {
+        mmr.append(leaf(i));
+    }
+    auto snap = metrics::snapshot();
+    metrics::set_enabled(false);
+    metrics::reset();
+    // One compression per internal node: N - 1 for a single perfect tree
+    EXPECT_EQ(snap.counter(metrics::Counter::PERMUTATIONS), N - 1);
+}
+
+// ============================================================================
+// Inclusion proofs
+// ============================================================================
+
+TEST(MmrTest, EveryLeafProves) {
+    MerkleMountainRange mmr;
+    for (uint64_t n = 1; n <= 21; ++n) {
+        mmr.append(leaf(n - 1));
+        // Single peaks, all-ones counts and mixed shapes
+        if (n != 1 && n != 2 && n != 3 && n != 6 && n != 8 && n != 15 && n != 21) {
+            continue;
+        }
+        const MmrDigest root = mmr.root();
+        for (uint64_t i = 0; i < n; ++i) {
+            MmrProof proof = mmr.prove(i);
+            EXPECT_EQ(proof.peaks.size(), static_cast<size_t>(std::popcount(n)));
+            ASSERT_TRUE(mmr.verify(root, leaf(i), proof)) << "leaf " << i << " of " << n;
+        }
+    }
+    EXPECT_THROW((void)mmr.prove(mmr.leaf_count()), std::out_of_range);
+}
+
+TEST(MmrTest, TamperedProofsFail) {
+    MerkleMountainRange mmr;
+    for (uint64_t i = 0; i < 13; ++i) {
+        mmr.append(leaf(i));
+    }
+    const MmrDigest root = mmr.root();
+    const MmrProof proof = mmr.prove(5);
+    ASSERT_TRUE(mmr.verify(root, leaf(5), proof));
+
+    EXPECT_FALSE(mmr.verify(root, leaf(6), proof));
+
+    MmrProof p = proof;
+    p.siblings[0][0] += Fp::ONE;
+    EXPECT_FALSE(mmr.verify(root, leaf(5), p));
+
+    p = proof;
+    p.leaf_index = 4;
+    EXPECT_FALSE(mmr.verify(root, leaf(5), p));
+
+    p = proof;
+    p.leaf_count = 14;
+    EXPECT_FALSE(mmr.verify(root, leaf(5), p));
+
+    p = proof;
+    p.peaks.back()[1] += Fp::ONE;
+    EXPECT_FALSE(mmr.verify(root, leaf(5), p));
+
+    p = proof;
+    p.siblings.pop_back();
+    EXPECT_FALSE(mmr.verify(root, leaf(5), p));
+
+    mmr.append(leaf(13));
+    EXPECT_FALSE(mmr.verify(mmr.root(), leaf(5), proof));
+}
+
+// ============================================================================
+// Journal
+// ============================================================================
+
+TEST_F(MmrJournalTest, ReopenRestoresState) {
+    MmrDigest root;
+    {
+        MerkleMountainRange mmr(path_);
+        for (uint64_t i = 0; i < 11; ++i) {
+            mmr.append(leaf(i));
+        }
+        mmr.flush();
+        root = mmr.root();
+    }
+    EXPECT_EQ(std::filesystem::file_size(path_), MerkleMountainRange::node_count_for(11) * MMR_DIGEST_BYTES);
+
+    MerkleMountainRange reopened(path_);
+    EXPECT_EQ(reopened.leaf_count(), 11u);
+    EXPECT_EQ(reopened.root(), root);
+
+    // Appends continue where the file left off
+    MerkleMountainRange memory;
+    for (uint64_t i = 0; i < 20; ++i) {
+        memory.append(leaf(i));
+        if (i >= 11) {
+            reopened.append(leaf(i));
+        }
+    }
+    EXPECT_EQ(reopened.root(), memory.root());
+}
+
+TEST_F(MmrJournalTest, TornTailIsTruncated) {
+    MmrDigest root_after_7;
+    {
+        MerkleMountainRange mmr(path_);
+        for (uint64_t i = 0; i < 8; ++i) {
+            if (i == 7) {
+                root_after_7 = mmr.root();
+            }
+            mmr.append(leaf(i));
+        }
+    }
+    // Crash while appending leaf 7: the leaf record is written, the first of
+    // its three merges only half
+    std::filesystem::resize_file(path_, 12 * MMR_DIGEST_BYTES + MMR_DIGEST_BYTES / 2);
+
+    MerkleMountainRange mmr(path_);
+    EXPECT_EQ(mmr.leaf_count(), 7u);
+    EXPECT_EQ(mmr.root(), root_after_7);
+    EXPECT_EQ(std::filesystem::file_size(path_), MerkleMountainRange::node_count_for(7) * MMR_DIGEST_BYTES);
+
+    mmr.append(leaf(7));
+    EXPECT_TRUE(mmr.verify(mmr.root(), leaf(7), mmr.prove(7)));
+}
+
+#if defined(__linux__)
+TEST_F(MmrJournalTest, FailedWriteLeavesStateUnchanged) {
+    MerkleMountainRange mmr(path_);
+
+    // Cap the file size so the stream's buffer flush fails part way, with EFBIG
+    // instead of SIGXFSZ
+    rlimit old_limit{};
+    ASSERT_EQ(::getrlimit(RLIMIT_FSIZE, &old_limit), 0);
+    rlimit limit = old_limit;
+    limit.rlim_cur = 16 * MMR_DIGEST_BYTES + MMR_DIGEST_BYTES / 2;
+    ASSERT_EQ(::setrlimit(RLIMIT_FSIZE, &limit), 0);
+    auto old_handler = std::signal(SIGXFSZ, SIG_IGN);
+
+    bool failed = false;
+    for (uint64_t i = 0; i < 10000 && !failed; ++i) {
+        try {
+            mmr.append(leaf(i));
+        } catch (const std::runtime_error&) {
+            failed = true;
+        }
+    }
+    ::setrlimit(RLIMIT_FSIZE, &old_limit);
+    std::signal(SIGXFSZ, old_handler);
+    ASSERT_TRUE(failed);
+
+    // Exactly the appends that succeeded, and the failed one is not half applied
+    const uint64_t count = mmr.leaf_count();
+    MerkleMountainRange memory;
+    for (uint64_t i = 0; i < count; ++i) {
+        memory.append(leaf(i));
+    }
+    EXPECT_EQ(mmr.node_count(), MerkleMountainRange::node_count_for(count));
+    EXPECT_EQ(mmr.root(), memory.root());
+    EXPECT_THROW(mmr.append(leaf(count)), std::runtime_error);
+    EXPECT_EQ(mmr.leaf_count(), count);
+
+    // The journal holds a prefix of those appends
+    MerkleMountainRange reopened(path_);
+    EXPECT_LE(reopened.leaf_count(), count);
+    MerkleMountainRange prefix;
+    for (uint64_t i = 0; i < reopened.leaf_count(); ++i) {
+        prefix.append(leaf(i));
+    }
+    EXPECT_EQ(reopened.root(), prefix.root());
+}
+#endif
@@ -0,0 +1,102 @@
+/**
+ * @file test_op_counters.cpp
+ * @brief Unit tests for the RESCUE_OP_COUNTERS field-operation counters.
+ *
+ * Most tests only run when the library is configured with
+ * -DRESCUE_OP_COUNTERS=ON; the default build checks the disabled behaviour.
+ */
+
+#include <rescue/op_counters.hpp>
+#include <rescue/rescue_desc.hpp>
+
+#include <gtest/gtest.h>
+
+#include <thread>
+
+using namespace rescue;
+
+class OpCountersTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        if (!op_counters_enabled()) {
+            GTEST_SKIP() << "library built without RESCUE_OP_COUNTERS";
+        }
+    }
+};
+
+TEST(OpCountersDisabledTest, ScopeReportsZero) {
+    if (op_counters_enabled()) {
+        GTEST_SKIP() << "library built with RESCUE_OP_COUNTERS";
+    }
+
+    OpCountScope scope;
+    Fp a(uint64_t{7});
+    Fp b = a * a + a;
+    (void)b.inv();
+
+    EXPECT_EQ(scope.counts(), OpCounts{});
+}
+
+TEST_F(OpCountersTest, PrimitivesAreCounted) {
+    Fp a(uint64_t{7});
+    Fp b(uint64_t{11});
+
+    OpCountScope scope;
+    Fp c = a + b;
+    c = c - a;
+    c = c * b;
+    c = c.square();
+    OpCounts ops = scope.counts();
+
+    EXPECT_EQ(ops.add, 1u);
+    EXPECT_EQ(ops.sub, 1u);
+    EXPECT_EQ(ops.mul, 1u);
+    EXPECT_EQ(ops.sqr, 1u);
+    EXPECT_EQ(ops.multiplications(), 2u);
+}
+
+TEST_F(OpCountersTest, Pow5IsTwoSquaringsAndOneMultiplication) {
+    uint256 x{3};
+
+    OpCountScope scope;
+    (void)fp::pow5(x);
+    OpCounts ops = scope.counts();
+
+    EXPECT_EQ(ops.pow5, 1u);
+    EXPECT_EQ(ops.sqr, 2u);
+    EXPECT_EQ(ops.mul, 1u);
+}
+
+TEST_F(OpCountersTest, PermutationCostMatchesRoundStructure) {
+    std::vector<Fp> key = {Fp(uint64_t{1}), Fp(uint64_t{2}), Fp(uint64_t{3}),
+                           Fp(uint64_t{4}), Fp(uint64_t{5})};
+    RescueDesc desc(key);
+    const uint64_t m = desc.m();
+    // One S-box layer, MDS and key addition per round key after the first
+    const uint64_t n = desc.round_keys().size() - 1;
+
+    std::vector<Fp> state(m, Fp(uint64_t{9}));
+    OpCountScope scope;
+    desc.permute_in_place(state);
+    OpCounts ops = scope.counts();
+
+    // S-box layers alternate between x^alpha and x^(1/alpha)
+    EXPECT_EQ(ops.pow5, m * n / 2);
+    EXPECT_EQ(ops.pow, m * n / 2);
+    // Initial key addition, then per round an m x m mat-vec plus key addition
+    EXPECT_EQ(ops.add, m + n * (m * m + m));
+    EXPECT_GE(ops.mul, n * m * m);
+}
+
+TEST_F(OpCountersTest, CountsAreThreadLocal) {
+    OpCountScope scope;
+    std::thread worker([] {
+        Fp a(uint64_t{2});
+        for (int i = 0; i < 100; ++i) {
+            a = a * a;
+        }
+    });
+    worker.join();
+
+    EXPECT_EQ(scope.counts(), OpCounts{});
+}
@@ -7,6 +7,7 @@
 #include <rescue/utils.hpp>
 
 #include <gtest/gtest.h>
+#include <type_traits>
 
 using namespace rescue;
 
@@ -294,3 +295,109 @@ TEST_F(RescueCipherTest, CTRModeProperty) {
 
     EXPECT_EQ(ct1, ct2);
 }
+
+// ============================================================================
+// Configurable-width cipher (BasicRescueCipher<M>)
+// ============================================================================
+
+TEST(RescueCipherWidthTest, DefaultIsFiveWide) {
+    static_assert(std::is_same_v<RescueCipher, BasicRescueCipher<RESCUE_CIPHER_BLOCK_SIZE>>);
+    EXPECT_EQ(RescueCipher::BLOCK_SIZE, 5);
+}
+
+template <typename Cipher>
+class BasicRescueCipherTest : public ::testing::Test {};
+
+using CipherWidths = ::testing::Types<BasicRescueCipher<5>, BasicRescueCipher<8>,
+                                      BasicRescueCipher<12>, BasicRescueCipher<16>>;
+TYPED_TEST_SUITE(BasicRescueCipherTest, CipherWidths);
+
+TYPED_TEST(BasicRescueCipherTest, RoundtripAcrossBlocks) {
+    constexpr size_t block_size = TypeParam::BLOCK_SIZE;
+    auto secret = random_bytes<RESCUE_CIPHER_SECRET_SIZE>();
+    auto nonce = generate_nonce();
+    TypeParam cipher(secret);
+
+    std::vector<Fp> plaintext;
+    for (size_t i = 0; i < 2 * block_size + 3; ++i) {
+        plaintext.push_back(Fp(static_cast<uint64_t>(i * 7 + 1)));
+    }
+
+    auto ciphertext = cipher.encrypt_raw(plaintext, nonce);
+    ASSERT_EQ(ciphertext.size(), plaintext.size());
+    EXPECT_NE(ciphertext, plaintext);
+
+    auto decrypted = cipher.decrypt_raw(ciphertext, nonce);
+    EXPECT_EQ(decrypted, plaintext);
+}
+
+TYPED_TEST(BasicRescueCipherTest, SameSecretIsDeterministic) {
+    auto secret = random_bytes<RESCUE_CIPHER_SECRET_SIZE>();
+    auto nonce = generate_nonce();
+    TypeParam cipher1(secret);
+    TypeParam cipher2(secret);
+
+    std::vector<Fp> plaintext(TypeParam::BLOCK_SIZE, Fp(uint64_t{42}));
+    EXPECT_EQ(cipher1.encrypt_raw(plaintext, nonce), cipher2.encrypt_raw(plaintext, nonce));
+}
+
+TEST(RescueCipherWidthTest, WidthsProduceDistinctKeystreams) {
+    auto secret = random_bytes<RESCUE_CIPHER_SECRET_SIZE>();
+    auto nonce = generate_nonce();
+    std::vector<Fp> plaintext = {Fp(uint64_t{42})};
+
+    auto ct5 = BasicRescueCipher<5>(secret).encrypt_raw(plaintext, nonce);
+    auto ct8 = BasicRescueCipher<8>(secret).encrypt_raw(plaintext, nonce);
+    EXPECT_NE(ct5[0], ct8[0]);
+}
+
+// ============================================================================
+// Block-cipher API
+// ============================================================================
+
+TEST_F(RescueCipherTest, BlockRoundtrip) {
+    RescueCipher::Block block;
+    for (size_t i = 0; i < block.size(); ++i) {
+        block[i] = Fp::random();
+    }
+
+    auto encrypted = cipher->encrypt_block(block);
+    EXPECT_NE(encrypted, block);
+    EXPECT_EQ(cipher->decrypt_block(encrypted), block);
+}
+
+TEST_F(RescueCipherTest, BlockMatchesCtrKeystream) {
+    // The first CTR keystream block is the permutation of [nonce, 0, 0, 0, 0]
+    RescueCipher::Block counter{};
+    counter[0] = Fp(deserialize_le(nonce));
+
+    std::vector<Fp> zeros(RESCUE_CIPHER_BLOCK_SIZE, Fp::ZERO);
+    auto keystream = cipher->encrypt_raw(zeros, nonce);
+    auto encrypted = cipher->encrypt_block(counter);
+
+    for (size_t i = 0; i < RESCUE_CIPHER_BLOCK_SIZE; ++i) {
+        EXPECT_EQ(keystream[i], encrypted[i]);
+    }
+}
+
+TEST_F(RescueCipherTest, BatchBlocksMatchSingleBlocks) {
+    std::vector<RescueCipher::Block> blocks(4);
+    for (auto& block : blocks) {
+        for (auto& x : block) {
+            x = Fp::random();
+        }
+    }
+
+    auto encrypted = cipher->encrypt_blocks(blocks);
+    ASSERT_EQ(encrypted.size(), blocks.size());
+    for (size_t i = 0; i < blocks.size(); ++i) {
+        EXPECT_EQ(encrypted[i], cipher->encrypt_block(blocks[i]));
+    }
+
+    // In-place decryption through aliased spans
+    cipher->decrypt_blocks(encrypted, encrypted);
+    EXPECT_EQ(encrypted, blocks);
+
+    std::vector<RescueCipher::Block> short_out(blocks.size() - 1);
+    EXPECT_THROW(cipher->encrypt_blocks(blocks, short_out), std::invalid_argument);
+}
@@ -213,3 +213,28 @@ TEST_F(RescueHashTest, MultipleOfRateSizeMessage) {
     auto digest = hasher->digest(msg);
     EXPECT_EQ(digest.size(), RESCUE_HASH_DIGEST_LENGTH);
 }
+
+TEST_F(RescueHashTest, DigestBatchMatchesDigest) {
+    // Lengths around the rate boundaries, unsorted, so lanes retire at different steps
+    std::vector<std::vector<Fp>> messages;
+    for (size_t n : {size_t{14}, size_t{0}, size_t{100}, size_t{6}, size_t{7}, size_t{1}, size_t{13}}) {
+        std::vector<Fp> msg;
+        for (size_t i = 0; i < n; ++i) {
+            msg.push_back(Fp(uint64_t{n * 1000 + i}));
+        }
+        messages.push_back(msg);
+    }
+
+    const auto digests = hasher->digest_batch(messages);
+    ASSERT_EQ(digests.size(), messages.size());
+    for (size_t i = 0; i < messages.size(); ++i) {
+        EXPECT_EQ(digests[i], hasher->digest(messages[i])) << "message " << i;
+    }
+
+    RescuePrimeHash custom(5, 3, 3);
+    const auto custom_digests = custom.digest_batch(messages);
+    for (size_t i = 0; i < messages.size(); ++i) {
+        EXPECT_EQ(custom_digests[i], custom.digest(messages[i])) << "message " << i;
+    }
+    EXPECT_TRUE(hasher->digest_batch({}).empty());
+}
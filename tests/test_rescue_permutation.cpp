@@ -204,3 +204,60 @@ TEST_F(RescueDescTest, PermutationWithRandomInput) {
         }
     }
 }
+
+TEST_F(RescueDescTest, InPlaceMatchesStateTrace) {
+    RescueDesc cipher_desc(cipher_key);
+    RescueDesc hash_desc(12, 5);
+
+    for (const RescueDesc* desc : {&cipher_desc, &hash_desc}) {
+        std::vector<Fp> state_data;
+        for (size_t i = 0; i < desc->m(); ++i) {
+            state_data.push_back(Fp::random());
+        }
+
+        auto states = rescue_permutation(desc->mode(), desc->alpha(), desc->alpha_inverse(),
+                                         desc->mds_matrix(), desc->round_keys(), Matrix(state_data));
+
+        std::vector<Fp> in_place = state_data;
+        desc->permute_in_place(in_place);
+        EXPECT_EQ(in_place, states.back().to_vector());
+    }
+}
+
+TEST_F(RescueDescTest, InverseRoundKeysAreTransformed) {
+    RescueDesc desc(cipher_key);
+
+    ASSERT_EQ(desc.inverse_round_keys().size(), desc.round_keys().size());
+    for (size_t r = 0; r < desc.round_keys().size(); ++r) {
+        EXPECT_EQ(desc.inverse_round_keys()[r],
+                  desc.mds_matrix_inverse().mat_mul(desc.round_keys()[r]));
+    }
+}
+
+TEST_F(RescueDescTest, InPlaceInverseMatchesStateTrace) {
+    RescueDesc desc(cipher_key);
+
+    std::vector<Fp> state_data;
+    for (size_t i = 0; i < desc.m(); ++i) {
+        state_data.push_back(Fp::random());
+    }
+
+    auto states = rescue_permutation_inverse(desc.mode(), desc.alpha(), desc.alpha_inverse(),
+                                             desc.mds_matrix_inverse(), desc.round_keys(),
+                                             Matrix(state_data));
+
+    std::vector<Fp> in_place = state_data;
+    desc.permute_inverse_in_place(in_place);
+    EXPECT_EQ(in_place, states.back().to_vector());
+
+    desc.permute_in_place(in_place);
+    EXPECT_EQ(in_place, state_data);
+}
+
+TEST_F(RescueDescTest, InPlaceRejectsWrongSize) {
+    RescueDesc desc(cipher_key);
+    std::vector<Fp> state(desc.m() + 1);
+
+    EXPECT_THROW(desc.permute_in_place(state), std::invalid_argument);
+    EXPECT_THROW(desc.permute_inverse_in_place(state), std::invalid_argument);
+}
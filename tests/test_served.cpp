@@ -0,0 +1,356 @@
+/**
+ * @file test_served.cpp
+ * @brief Tests for the rescue-served protocol, queue, daemon and client.
+ */
+
+#include <rescue/served/client.hpp>
+#include <rescue/served/server.hpp>
+#include <rescue/served/submission_queue.hpp>
+
+#include <rescue/rescue.hpp>
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+
+using namespace rescue;
+using namespace rescue::served;
+
+namespace {
+
+std::string test_socket_path() {
+    static std::atomic<int> counter{0};
+    return "/tmp/rescue_served_test_" + std::to_string(::getpid()) + "_" + std::to_string(counter++) + ".sock";
+}
+
+ServerOptions test_options() {
+    ServerOptions opts;
+    opts.socket_path = test_socket_path();
+    opts.workers = 2;
+    return opts;
+}
+
+Secret make_secret(uint8_t seed) {
+    Secret s{};
+    for (size_t i = 0; i < s.size(); ++i) {
+        s[i] = static_cast<uint8_t>(seed + i * 7);
+    }
+    return s;
+}
+
+std::vector<Fp> make_message(size_t n, uint64_t seed) {
+    std::vector<Fp> msg;
+    for (size_t i = 0; i < n; ++i) {
+        msg.push_back(Fp(uint64_t{seed * 1000 + i}));
+    }
+    return msg;
+}
+
+/// Connected socket for sending hand-built frames.
+int raw_connect(const std::string& path) {
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    std::copy(path.begin(), path.end(), addr.sun_path);
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    EXPECT_EQ(::connect(fd, reinterpret_cast<const sockaddr*>(&addr), sizeof(addr)), 0);
+    return fd;
+}
+
+bool raw_read(int fd, std::span<uint8_t> out) {
+    while (!out.empty()) {
+        ssize_t n = ::read(fd, out.data(), out.size());
+        if (n <= 0) {
+            return false;
+        }
+        out = out.subspan(static_cast<size_t>(n));
+    }
+    return true;
+}
+
+FrameHeader raw_response(int fd) {
+    std::array<uint8_t, HEADER_SIZE> header{};
+    EXPECT_TRUE(raw_read(fd, header));
+    FrameHeader h = decode_header(header);
+    std::vector<uint8_t> body(h.length);
+    EXPECT_TRUE(raw_read(fd, body));
+    return h;
+}
+
+}  // anonymous namespace
+
+// ============================================================================
+// Protocol
+// ============================================================================
+
+TEST(ServedProtocolTest, HeaderRoundTrip) {
+    std::array<uint8_t, HEADER_SIZE> bytes{};
+    encode_header({0x01020304, 0xdeadbeef, 3}, bytes);
+    EXPECT_EQ(bytes[0], 0x04);  // Little-endian
+    FrameHeader h = decode_header(bytes);
+    EXPECT_EQ(h.length, 0x01020304u);
+    EXPECT_EQ(h.id, 0xdeadbeefu);
+    EXPECT_EQ(h.code, 3);
+}
+
+TEST(ServedProtocolTest, ElementsRoundTrip) {
+    auto msg = make_message(3, 1);
+    std::vector<uint8_t> bytes;
+    append_elements(bytes, msg);
+    ASSERT_EQ(bytes.size(), 3 * Fp::BYTES);
+    EXPECT_EQ(decode_elements(bytes), msg);
+
+    bytes.pop_back();
+    EXPECT_THROW((void)decode_elements(bytes), std::invalid_argument);
+}
+
+TEST(ServedProtocolTest, CipherRequestLayout) {
+    auto frame = encode_cipher_request(7, Op::DECRYPT, make_secret(1), Nonce{}, make_message(2, 1));
+    FrameHeader h = decode_header(std::span<const uint8_t, HEADER_SIZE>(frame.data(), HEADER_SIZE));
+    EXPECT_EQ(h.id, 7u);
+    EXPECT_EQ(h.code, static_cast<uint8_t>(Op::DECRYPT));
+    EXPECT_EQ(h.length, CIPHER_PREFIX_SIZE + 2 * Fp::BYTES);
+    EXPECT_EQ(frame.size(), HEADER_SIZE + h.length);
+}
+
+// ============================================================================
+// Submission queue
+// ============================================================================
+
+TEST(SubmissionQueueTest, FifoAndBounded) {
+    SubmissionQueue<int> q(3);
+    EXPECT_EQ(q.capacity(), 4u);
+
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(q.try_push(i));
+    }
+    int extra = 99;
+    EXPECT_FALSE(q.try_push(extra));
+    EXPECT_EQ(extra, 99);
+
+    int out = -1;
+    for (int i = 0; i < 4; ++i) {
+        ASSERT_TRUE(q.try_pop(out));
+        EXPECT_EQ(out, i);
+    }
+    EXPECT_FALSE(q.try_pop(out));
+}
+
+TEST(SubmissionQueueTest, ConcurrentProducersAndConsumers) {
+    constexpr int PRODUCERS = 4;
+    constexpr int PER_PRODUCER = 20000;
+    SubmissionQueue<int> q(64);
+    std::atomic<long long> sum{0};
+    std::atomic<int> consumed{0};
+
+    std::vector<std::thread> threads;
+    for (int p = 0; p < PRODUCERS; ++p) {
+        threads.emplace_back([&q, p] {
+            for (int i = 1; i <= PER_PRODUCER; ++i) {
+                int v = p * PER_PRODUCER + i;
+                while (!q.try_push(v)) {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (int c = 0; c < 2; ++c) {
+        threads.emplace_back([&] {
+            int v = 0;
+            while (consumed.load() < PRODUCERS * PER_PRODUCER) {
+                if (q.try_pop(v)) {
+                    sum += v;
+                    ++consumed;
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    long long n = static_cast<long long>(PRODUCERS) * PER_PRODUCER;
+    EXPECT_EQ(sum.load(), n * (n + 1) / 2);
+}
+
+// ============================================================================
+// Daemon and client
+// ============================================================================
+
+TEST(ServedTest, EncryptAndDecryptMatchLibrary) {
+    Server server(test_options());
+    Client client(server.options().socket_path);
+
+    Secret secret = make_secret(3);
+    Nonce nonce{};
+    nonce[0] = 9;
+    RescueCipher cipher(secret);
+
+    for (size_t n : {size_t{0}, size_t{1}, size_t{5}, size_t{6}, size_t{23}}) {
+        auto msg = make_message(n, n);
+        auto ct = client.encrypt(secret, nonce, msg);
+        EXPECT_EQ(ct, cipher.encrypt_raw(msg, nonce)) << "n=" << n;
+        EXPECT_EQ(client.decrypt(secret, nonce, ct), msg) << "n=" << n;
+    }
+}
+
+TEST(ServedTest, HashMatchesLibrary) {
+    Server server(test_options());
+    Client client(server.options().socket_path);
+    RescuePrimeHash hasher;
+
+    for (size_t n : {size_t{1}, size_t{7}, size_t{20}}) {
+        auto msg = make_message(n, 2);
+        EXPECT_EQ(client.hash(msg), hasher.digest(msg)) << "n=" << n;
+    }
+}
+
+TEST(ServedTest, ConcurrentHashesMatchLibrary) {
+    Server server(test_options());
+    constexpr size_t CLIENTS = 4;
+    constexpr size_t REQUESTS = 20;
+    RescuePrimeHash hasher;
+    std::atomic<size_t> mismatches{0};
+
+    // Mixed lengths, so batched messages absorb different block counts
+    std::vector<std::thread> threads;
+    for (size_t c = 0; c < CLIENTS; ++c) {
+        threads.emplace_back([&, c] {
+            Client client(server.options().socket_path);
+            for (size_t r = 0; r < REQUESTS; ++r) {
+                auto msg = make_message(1 + (r * 5 + c) % 30, c);
+                if (client.hash(msg) != hasher.digest(msg)) {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0u);
+    EXPECT_EQ(server.stats().jobs, CLIENTS * REQUESTS);
+}
+
+TEST(ServedTest, CachesExpandedCiphers) {
+    Server server(test_options());
+    Client client(server.options().socket_path);
+    auto msg = make_message(5, 1);
+
+    (void)client.encrypt(make_secret(1), Nonce{}, msg);
+    (void)client.encrypt(make_secret(1), Nonce{}, msg);
+    (void)client.decrypt(make_secret(2), Nonce{}, msg);
+
+    ServerStats s = server.stats();
+    EXPECT_EQ(s.cache_misses, 2u);
+    EXPECT_EQ(s.cache_hits, 1u);
+    EXPECT_EQ(s.jobs, 3u);
+}
+
+TEST(ServedTest, ConcurrentClientsAcrossKeys) {
+    Server server(test_options());
+    constexpr size_t CLIENTS = 6;
+    constexpr size_t REQUESTS = 20;
+    std::atomic<size_t> mismatches{0};
+
+    std::vector<std::thread> threads;
+    for (size_t c = 0; c < CLIENTS; ++c) {
+        threads.emplace_back([&, c] {
+            Client client(server.options().socket_path);
+            Secret secret = make_secret(static_cast<uint8_t>(c % 3));
+            RescueCipher cipher(secret);
+            Nonce nonce{};
+            for (size_t r = 0; r < REQUESTS; ++r) {
+                nonce[0] = static_cast<uint8_t>(r);
+                auto msg = make_message(1 + r % 12, c);
+                if (client.encrypt(secret, nonce, msg) != cipher.encrypt_raw(msg, nonce)) {
+                    ++mismatches;
+                }
+            }
+        });
+    }
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(mismatches.load(), 0u);
+    ServerStats s = server.stats();
+    EXPECT_EQ(s.jobs, CLIENTS * REQUESTS);
+    EXPECT_LE(s.cache_misses, 3u * 2);  // Racing misses may build a key twice
+}
+
+TEST(ServedTest, RejectsMalformedRequests) {
+    Server server(test_options());
+    int fd = raw_connect(server.options().socket_path);
+
+    std::array<uint8_t, HEADER_SIZE> header{};
+    encode_header({0, 5, 42}, header);  // Unknown op
+    ASSERT_EQ(::write(fd, header.data(), header.size()), static_cast<ssize_t>(header.size()));
+    FrameHeader h = raw_response(fd);
+    EXPECT_EQ(h.id, 5u);
+    EXPECT_EQ(h.code, static_cast<uint8_t>(Status::BAD_REQUEST));
+
+    encode_header({10, 6, static_cast<uint8_t>(Op::ENCRYPT)}, header);  // Shorter than secret + nonce
+    std::array<uint8_t, 10> body{};
+    ASSERT_EQ(::write(fd, header.data(), header.size()), static_cast<ssize_t>(header.size()));
+    ASSERT_EQ(::write(fd, body.data(), body.size()), static_cast<ssize_t>(body.size()));
+    EXPECT_EQ(raw_response(fd).code, static_cast<uint8_t>(Status::BAD_REQUEST));
+
+    ::close(fd);
+    EXPECT_EQ(server.stats().bad_requests, 2u);
+}
+
+TEST(ServedTest, ShedsLoadWhenQueueIsFull) {
+    ServerOptions opts = test_options();
+    opts.workers = 1;
+    opts.queue_capacity = 2;
+    opts.max_batch = 1;
+    Server server(opts);
+    int fd = raw_connect(opts.socket_path);
+
+    // Pipeline slow requests faster than the single worker can drain them
+    constexpr uint32_t N = 24;
+    auto msg = make_message(700, 1);
+    for (uint32_t id = 0; id < N; ++id) {
+        auto frame = encode_hash_request(id, msg);
+        ASSERT_EQ(::send(fd, frame.data(), frame.size(), 0), static_cast<ssize_t>(frame.size()));
+    }
+
+    size_t ok = 0;
+    size_t shed = 0;
+    for (uint32_t i = 0; i < N; ++i) {
+        FrameHeader h = raw_response(fd);
+        (h.code == static_cast<uint8_t>(Status::OK) ? ok : shed)++;
+    }
+    ::close(fd);
+
+    EXPECT_GE(ok, 1u);
+    EXPECT_GE(shed, 1u);
+    EXPECT_EQ(server.stats().overloaded, shed);
+}
+
+TEST(ServedTest, ClientReportsOverloadAsServedError) {
+    ServedError e(Status::OVERLOADED, "busy");
+    EXPECT_TRUE(e.overloaded());
+    EXPECT_FALSE(ServedError(Status::BAD_REQUEST, "bad").overloaded());
+}
+
+TEST(ServedTest, StopDisconnectsClients) {
+    auto server = std::make_unique<Server>(test_options());
+    std::string path = server->options().socket_path;
+    Client client(path);
+    (void)client.hash(make_message(1, 1));
+
+    server->stop();
+    EXPECT_THROW((void)client.hash(make_message(1, 1)), std::system_error);
+    EXPECT_THROW(Client{path}, std::system_error);
+}
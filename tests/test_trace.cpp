@@ -0,0 +1,136 @@
+/**
+ * @file test_trace.cpp
+ * @brief Tests for traced permutations and columnar trace export.
+ */
+
+#include <rescue/trace.hpp>
+
+#include <rescue/rescue_hash.hpp>
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+using namespace rescue;
+
+namespace {
+
+std::vector<Fp> make_states(size_t n, size_t m, uint64_t seed) {
+    std::vector<Fp> states;
+    for (size_t i = 0; i < n * m; ++i) {
+        states.push_back(Fp(uint64_t{seed * 1000003 + i * 31 + 1}));
+    }
+    return states;
+}
+
+Fp cell(const TraceLayout& layout, std::span<const uint8_t> buf, size_t column, size_t row) {
+    return Fp::from_bytes(buf.subspan(layout.offset(column, row), TraceLayout::CELL_SIZE));
+}
+
+}  // anonymous namespace
+
+// ============================================================================
+// RescueDesc::permute_traced
+// ============================================================================
+
+TEST(TraceTest, RowsMatchStateTrace) {
+    RescueDesc cipher_desc(make_states(1, 5, 9));
+    RescueDesc hash_desc(RESCUE_HASH_STATE_SIZE, RESCUE_HASH_CAPACITY);
+
+    for (const RescueDesc* desc : {&cipher_desc, &hash_desc}) {
+        const size_t m = desc->m();
+        auto input = make_states(1, m, 3);
+        auto states = rescue_permutation(desc->mode(), desc->alpha(), desc->alpha_inverse(), desc->mds_matrix(),
+                                         desc->round_keys(), Matrix(input));
+
+        std::vector<Fp> state = input;
+        std::vector<Fp> trace(desc->trace_rows() * m);
+        desc->permute_traced(state, trace);
+        ASSERT_EQ(desc->trace_rows(), 2 * states.size());
+
+        auto row = [&](size_t r) { return std::vector<Fp>(trace.begin() + r * m, trace.begin() + (r + 1) * m); };
+        EXPECT_EQ(row(0), input);
+        for (size_t k = 0; k < states.size(); ++k) {
+            EXPECT_EQ(row(2 * k + 1), states[k].to_vector()) << "state " << k;
+        }
+        EXPECT_EQ(state, states.back().to_vector());
+
+        // S-box rows sit between consecutive states: next = MDS * sbox + key
+        for (size_t k = 0; k + 1 < states.size(); ++k) {
+            auto next = desc->mds_matrix().mat_mul(Matrix(row(2 * k + 2))).add(desc->round_keys()[k + 1]);
+            EXPECT_EQ(next.to_vector(), row(2 * k + 3)) << "round " << k;
+        }
+    }
+}
+
+TEST(TraceTest, PermuteTracedRejectsWrongSizes) {
+    RescueDesc desc(RESCUE_HASH_STATE_SIZE, RESCUE_HASH_CAPACITY);
+    std::vector<Fp> state(desc.m());
+    std::vector<Fp> trace(desc.trace_rows() * desc.m() - 1);
+    EXPECT_THROW(desc.permute_traced(state, trace), std::invalid_argument);
+}
+
+// ============================================================================
+// generate_trace
+// ============================================================================
+
+TEST(TraceTest, ColumnarLayout) {
+    RescueDesc desc(RESCUE_HASH_STATE_SIZE, RESCUE_HASH_CAPACITY);
+    const size_t m = desc.m();
+    constexpr size_t N = 37;
+    auto inputs = make_states(N, m, 1);
+
+    TraceLayout layout = TraceLayout::for_desc(desc, N);
+    EXPECT_EQ(layout.columns, m);
+    EXPECT_EQ(layout.rows(), N * desc.trace_rows());
+    std::vector<uint8_t> buf(layout.bytes());
+    WorkStealingExecutor pool(WorkStealingExecutor::Options{.threads = 3});
+    generate_trace(desc, inputs, layout, 0, buf, pool);
+
+    std::vector<Fp> trace(desc.trace_rows() * m);
+    for (size_t p = 0; p < N; ++p) {
+        std::vector<Fp> state(inputs.begin() + static_cast<std::ptrdiff_t>(p * m),
+                              inputs.begin() + static_cast<std::ptrdiff_t>((p + 1) * m));
+        desc.permute_traced(state, trace);
+        for (size_t r = 0; r < desc.trace_rows(); ++r) {
+            for (size_t c = 0; c < m; ++c) {
+                ASSERT_EQ(cell(layout, buf, c, p * desc.trace_rows() + r), trace[r * m + c])
+                    << "permutation " << p << " row " << r << " column " << c;
+            }
+        }
+    }
+}
+
+TEST(TraceTest, ChunksAndExecutorsProduceTheSameBuffer) {
+    RescueDesc desc(RESCUE_HASH_STATE_SIZE, RESCUE_HASH_CAPACITY);
+    const size_t m = desc.m();
+    constexpr size_t N = 50;
+    auto inputs = make_states(N, m, 2);
+    TraceLayout layout = TraceLayout::for_desc(desc, N);
+
+    std::vector<uint8_t> whole(layout.bytes());
+    SequentialExecutor sequential;
+    generate_trace(desc, inputs, layout, 0, whole, sequential);
+
+    std::vector<uint8_t> chunked(layout.bytes());
+    for (size_t first = 0; first < N; first += 17) {
+        size_t count = std::min<size_t>(17, N - first);
+        std::span<const Fp> part(inputs.data() + first * m, count * m);
+        generate_trace(desc, part, layout, first, chunked);
+    }
+    EXPECT_EQ(chunked, whole);
+}
+
+TEST(TraceTest, GenerateTraceRejectsMismatches) {
+    RescueDesc desc(RESCUE_HASH_STATE_SIZE, RESCUE_HASH_CAPACITY);
+    RescueDesc other(make_states(1, 5, 1));
+    auto inputs = make_states(4, desc.m(), 1);
+    TraceLayout layout = TraceLayout::for_desc(desc, 4);
+    std::vector<uint8_t> buf(layout.bytes());
+
+    EXPECT_THROW(generate_trace(other, inputs, layout, 0, buf), std::invalid_argument);
+    EXPECT_THROW(generate_trace(desc, inputs, layout, 1, buf), std::invalid_argument);
+    EXPECT_THROW(generate_trace(desc, std::span<const Fp>(inputs).first(5), layout, 0, buf), std::invalid_argument);
+    std::vector<uint8_t> small(layout.bytes() - 1);
+    EXPECT_THROW(generate_trace(desc, inputs, layout, 0, small), std::invalid_argument);
+}
@@ -0,0 +1,159 @@
+#include "crypt_file.hpp"
+
+#include <rescue/utils.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <variant>
+
+namespace rescue::crypt {
+
+namespace {
+
+constexpr std::array<uint8_t, 8> MAGIC = {'R', 'C', 'R', 'Y', 'P', 'T', '0', '1'};
+
+/// Counter blocks per executor task. One block is a full permutation, so the
+/// task overhead is already amortized; small chunks keep the threads balanced.
+constexpr uint64_t CHUNK_BLOCKS = 64;
+
+/// Elements checked per executor task by the validation pass (a compare each)
+constexpr uint64_t CHECK_CHUNK_ELEMENTS = uint64_t{1} << 16;
+
+template <typename T>
+void put_le(uint8_t* out, T v) {
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        out[i] = static_cast<uint8_t>(v >> (8 * i));
+    }
+}
+
+template <typename T>
+T get_le(const uint8_t* in) {
+    T v = 0;
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        v |= static_cast<T>(in[i]) << (8 * i);
+    }
+    return v;
+}
+
+/**
+ * @brief Index of the first non-canonical element (>= p) in [lo, hi) of a buffer, or hi.
+ */
+uint64_t first_non_canonical(std::span<const uint8_t> in, uint64_t lo, uint64_t hi) {
+    for (uint64_t e = lo; e < hi; ++e) {
+        if (uint256(in.subspan(e * ELEMENT_SIZE, ELEMENT_SIZE)) >= Fp::P) {
+            return e;
+        }
+    }
+    return hi;
+}
+
+/**
+ * @brief Process the elements of blocks [block_begin, block_end) that fall in the buffer.
+ *
+ * The buffer has been validated, so every element is canonical.
+ */
+template <size_t M>
+void apply_blocks(const BasicRescueCipher<M>& cipher, const Fp& nonce, uint64_t first_element,
+                  std::span<const uint8_t> in, std::span<uint8_t> out, bool decrypt, uint64_t block_begin,
+                  uint64_t block_end) {
+    const uint64_t n_elements = in.size() / ELEMENT_SIZE;
+    for (uint64_t b = block_begin; b < block_end; ++b) {
+        typename BasicRescueCipher<M>::Block counter{};
+        counter[0] = nonce;
+        counter[1] = Fp(uint64_t{b});
+        const auto key_stream = cipher.encrypt_block(counter);
+
+        // Stream elements of this block that lie inside the buffer
+        uint64_t lo = std::max(b * M, first_element);
+        uint64_t hi = std::min((b + 1) * M, first_element + n_elements);
+        for (uint64_t e = lo; e < hi; ++e) {
+            const size_t offset = (e - first_element) * ELEMENT_SIZE;
+            Fp x(uint256(in.subspan(offset, ELEMENT_SIZE)));
+            const Fp& k = key_stream[e - b * M];
+            Fp y = decrypt ? x - k : x + k;
+            y.to_bytes(std::span<uint8_t, ELEMENT_SIZE>(out.data() + offset, ELEMENT_SIZE));
+        }
+    }
+}
+
+}  // anonymous namespace
+
+void write_header(const FileHeader& header, std::span<uint8_t, HEADER_SIZE> out) {
+    std::fill(out.begin(), out.end(), uint8_t{0});
+    std::copy(MAGIC.begin(), MAGIC.end(), out.begin());
+    put_le<uint32_t>(out.data() + 8, header.parameter_id);
+    put_le<uint32_t>(out.data() + 12, static_cast<uint32_t>(HEADER_SIZE));
+    put_le<uint64_t>(out.data() + 16, header.element_count);
+    std::copy(header.nonce.begin(), header.nonce.end(), out.begin() + 24);
+}
+
+FileHeader read_header(std::span<const uint8_t> in) {
+    if (in.size() < HEADER_SIZE || !std::equal(MAGIC.begin(), MAGIC.end(), in.begin())) {
+        throw std::runtime_error("Not a rescue-crypt file");
+    }
+    if (get_le<uint32_t>(in.data() + 12) != HEADER_SIZE) {
+        throw std::runtime_error("Unsupported rescue-crypt header size");
+    }
+    FileHeader header;
+    header.parameter_id = get_le<uint32_t>(in.data() + 8);
+    if (!is_supported_cipher_width(header.parameter_id)) {
+        throw std::runtime_error("Unsupported parameter id " + std::to_string(header.parameter_id));
+    }
+    header.element_count = get_le<uint64_t>(in.data() + 16);
+    std::copy_n(in.begin() + 24, header.nonce.size(), header.nonce.begin());
+    return header;
+}
+
+StreamCipher::StreamCipher(uint32_t width, std::span<const uint8_t, RESCUE_CIPHER_SECRET_SIZE> secret)
+    : cipher_(detail::make_any_cipher(width, secret)) {}
+
+uint32_t StreamCipher::width() const {
+    return detail::cipher_width(cipher_);
+}
+
+void StreamCipher::apply(std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE> nonce, uint64_t first_element,
+                         std::span<const uint8_t> in, std::span<uint8_t> out, bool decrypt,
+                         Executor& executor) const {
+    if (in.size() != out.size() || in.size() % ELEMENT_SIZE != 0) {
+        throw std::invalid_argument("Input and output must hold the same whole number of elements");
+    }
+    if (in.empty()) {
+        return;
+    }
+
+    const uint64_t m = width();
+    const uint64_t n_elements = in.size() / ELEMENT_SIZE;
+
+    // Check the whole input before writing anything: out may alias in, and a
+    // bad element must not leave part of the output already transformed
+    std::atomic<uint64_t> first_bad{n_elements};
+    executor.parallel_for((n_elements + CHECK_CHUNK_ELEMENTS - 1) / CHECK_CHUNK_ELEMENTS, [&](size_t c) {
+        const uint64_t lo = c * CHECK_CHUNK_ELEMENTS;
+        const uint64_t hi = std::min(lo + CHECK_CHUNK_ELEMENTS, n_elements);
+        const uint64_t bad = first_non_canonical(in, lo, hi);
+        uint64_t current = first_bad.load();
+        while (bad < current && !first_bad.compare_exchange_weak(current, bad)) {
+        }
+    });
+    if (first_bad.load() < n_elements) {
+        throw std::invalid_argument("Element " + std::to_string(first_element + first_bad.load()) +
+                                    " is not a canonical field element");
+    }
+
+    const uint64_t block_begin = first_element / m;
+    const uint64_t block_end = (first_element + n_elements + m - 1) / m;
+    const uint64_t n_chunks = (block_end - block_begin + CHUNK_BLOCKS - 1) / CHUNK_BLOCKS;
+    const Fp nonce_fp(deserialize_le(nonce));
+
+    executor.parallel_for(n_chunks, [&](size_t c) {
+        const uint64_t lo = block_begin + c * CHUNK_BLOCKS;
+        const uint64_t hi = std::min(lo + CHUNK_BLOCKS, block_end);
+        std::visit([&](const auto& cipher) {
+            apply_blocks(cipher, nonce_fp, first_element, in, out, decrypt, lo, hi);
+        }, cipher_);
+    });
+}
+
+}  // namespace rescue::crypt
@@ -0,0 +1,92 @@
+#pragma once
+
+/**
+ * @file crypt_file.hpp
+ * @brief Encrypted field-element file format and parallel CTR processing.
+ *
+ * Plaintext files are flat arrays of canonical field elements, 32 bytes
+ * little-endian each. Ciphertext files are the same array prefixed by a
+ * 64-byte header:
+ *
+ *   offset  size  field
+ *        0     8  magic "RCRYPT01"
+ *        8     4  parameter id (cipher state width: 5, 8, 12 or 16)
+ *       12     4  header size (64)
+ *       16     8  element count
+ *       24    16  nonce
+ *       40    24  reserved, zero
+ *
+ * Element i is encrypted exactly as BasicRescueCipher<M>::encrypt_raw()
+ * would: plaintext + E(counter block i / M)[i % M], with counter blocks
+ * [nonce, block_index, 0, ...]. Each block is independent, so any element
+ * range can be processed alone and ranges can be split across threads.
+ */
+
+#include <rescue/detail/any_cipher.hpp>
+#include <rescue/executor.hpp>
+#include <rescue/rescue_cipher.hpp>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+namespace rescue::crypt {
+
+/// Size of the ciphertext file header.
+inline constexpr size_t HEADER_SIZE = 64;
+
+/// Bytes per serialized field element.
+inline constexpr size_t ELEMENT_SIZE = Fp::BYTES;
+
+/**
+ * @brief Decoded ciphertext file header.
+ */
+struct FileHeader {
+    uint32_t parameter_id = RESCUE_CIPHER_BLOCK_SIZE;
+    uint64_t element_count = 0;
+    std::array<uint8_t, RESCUE_CIPHER_NONCE_SIZE> nonce{};
+};
+
+void write_header(const FileHeader& header, std::span<uint8_t, HEADER_SIZE> out);
+
+/**
+ * @brief Parse and validate a header.
+ * @throws std::runtime_error on a bad magic, header size or parameter id.
+ */
+[[nodiscard]] FileHeader read_header(std::span<const uint8_t> in);
+
+/**
+ * @brief A CTR keystream for one key, at any supported state width.
+ */
+class StreamCipher {
+public:
+    /**
+     * @brief Derive the cipher for the given state width.
+     * @throws std::invalid_argument if width is not supported.
+     */
+    StreamCipher(uint32_t width, std::span<const uint8_t, RESCUE_CIPHER_SECRET_SIZE> secret);
+
+    [[nodiscard]] uint32_t width() const;
+
+    /**
+     * @brief Encrypt or decrypt a run of serialized elements.
+     *
+     * `in` and `out` hold the same number of 32-byte elements, the first of
+     * which is element `first_element` of the stream. Blocks are processed in
+     * chunks that run on `executor`. `in` and `out` may be the same buffer.
+     *
+     * @throws std::invalid_argument if sizes mismatch or an input element is
+     *         not canonical (>= p); the first offending element index is
+     *         reported. Input is validated before any output is written, so
+     *         `out` is untouched when this throws.
+     */
+    void apply(std::span<const uint8_t, RESCUE_CIPHER_NONCE_SIZE> nonce, uint64_t first_element,
+               std::span<const uint8_t> in, std::span<uint8_t> out, bool decrypt,
+               Executor& executor = default_executor()) const;
+
+private:
+    detail::AnyCipher cipher_;
+};
+
+}  // namespace rescue::crypt
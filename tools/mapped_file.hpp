@@ -0,0 +1,159 @@
+#pragma once
+
+/**
+ * @file mapped_file.hpp
+ * @brief Whole-file memory mappings shared by the command-line tools.
+ */
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <system_error>
+
+#include <fcntl.h>
+#include <stdlib.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace rescue::tools {
+
+[[noreturn]] inline void throw_errno(const std::string& what) {
+    throw std::system_error(errno, std::generic_category(), what);
+}
+
+/**
+ * @brief Read-only mapping of a whole file.
+ */
+class InputMap {
+public:
+    explicit InputMap(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw_errno("cannot open " + path);
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw_errno("cannot stat " + path);
+        }
+        size_ = static_cast<size_t>(st.st_size);
+        if (size_ > 0) {
+            void* base = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            ::close(fd);
+            if (base == MAP_FAILED) {
+                throw_errno("cannot mmap " + path);
+            }
+            ::madvise(base, size_, MADV_SEQUENTIAL);
+            base_ = static_cast<const uint8_t*>(base);
+        } else {
+            ::close(fd);
+        }
+    }
+
+    ~InputMap() {
+        if (base_ != nullptr) {
+            ::munmap(const_cast<uint8_t*>(base_), size_);
+        }
+    }
+
+    InputMap(const InputMap&) = delete;
+    InputMap& operator=(const InputMap&) = delete;
+
+    [[nodiscard]] std::span<const uint8_t> bytes() const { return {base_, size_}; }
+
+private:
+    const uint8_t* base_ = nullptr;
+    size_t size_ = 0;
+};
+
+/**
+ * @brief True if both paths exist and name the same file, through links or not.
+ */
+[[nodiscard]] inline bool same_file(const std::string& a, const std::string& b) {
+    struct stat sa{};
+    struct stat sb{};
+    return ::stat(a.c_str(), &sa) == 0 && ::stat(b.c_str(), &sb) == 0 && sa.st_dev == sb.st_dev &&
+           sa.st_ino == sb.st_ino;
+}
+
+/**
+ * @brief Shared writable mapping of a new file that appears at its path only once committed.
+ *
+ * The data goes to a temporary file in the destination directory whose
+ * blocks are allocated up front, so a full disk fails here instead of
+ * raising SIGBUS on a later store into the mapping. commit() flushes the
+ * mapping and renames the file into place; otherwise the destructor removes
+ * it, so a failed run leaves no output behind.
+ */
+class OutputMap {
+public:
+    OutputMap(const std::string& path, size_t size) : path_(path), temp_path_(path + ".XXXXXX"), size_(size) {
+        int fd = ::mkstemp(temp_path_.data());
+        if (fd < 0) {
+            throw_errno("cannot create a temporary file next to " + path);
+        }
+        try {
+            // mkstemp creates the file 0600; use the mode open(O_CREAT, 0644) would give
+            const mode_t mask = ::umask(0);
+            ::umask(mask);
+            if (::fchmod(fd, 0644 & ~mask) != 0) {
+                throw_errno("cannot set the mode of " + temp_path_);
+            }
+            if (size_ > 0) {
+                if (int err = ::posix_fallocate(fd, 0, static_cast<off_t>(size_)); err != 0) {
+                    throw std::system_error(err, std::generic_category(),
+                                            "cannot allocate " + std::to_string(size_) + " bytes for " + path);
+                }
+                void* base = ::mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+                if (base == MAP_FAILED) {
+                    throw_errno("cannot mmap " + temp_path_);
+                }
+                base_ = static_cast<uint8_t*>(base);
+            }
+        } catch (...) {
+            ::close(fd);
+            ::unlink(temp_path_.c_str());
+            throw;
+        }
+        ::close(fd);
+    }
+
+    ~OutputMap() {
+        if (base_ != nullptr) {
+            ::munmap(base_, size_);
+        }
+        if (!committed_) {
+            ::unlink(temp_path_.c_str());
+        }
+    }
+
+    OutputMap(const OutputMap&) = delete;
+    OutputMap& operator=(const OutputMap&) = delete;
+
+    [[nodiscard]] std::span<uint8_t> bytes() { return {base_, size_}; }
+
+    /**
+     * @brief Write the mapping back to disk, then move the file to its final path.
+     */
+    void commit() {
+        if (base_ != nullptr && ::msync(base_, size_, MS_SYNC) != 0) {
+            throw_errno("cannot write " + temp_path_);
+        }
+        if (::rename(temp_path_.c_str(), path_.c_str()) != 0) {
+            throw_errno("cannot rename " + temp_path_ + " to " + path_);
+        }
+        committed_ = true;
+    }
+
+private:
+    std::string path_;
+    std::string temp_path_;
+    uint8_t* base_ = nullptr;
+    size_t size_ = 0;
+    bool committed_ = false;
+};
+
+}  // namespace rescue::tools
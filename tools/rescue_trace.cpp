@@ -0,0 +1,211 @@
+/**
+ * @file rescue_trace.cpp
+ * @brief rescue-trace: export columnar Rescue-Prime permutation traces.
+ *
+ * Usage:
+ *   rescue-trace [options] --random=<n> <trace>
+ *   rescue-trace [options] <states> <trace>
+ *
+ * Runs the hash permutation over n input states and writes every trace row
+ * (see rescue/trace.hpp) to a memory-mapped file, in chunks, across threads.
+ * Input states either come from a flat file of n * m canonical field
+ * elements (32 bytes little-endian each) or are drawn at random.
+ *
+ * The output is a 64-byte header followed by the columnar trace:
+ *
+ *   offset  size  field
+ *        0     8  magic "RTRACE01"
+ *        8     4  columns (state width m)
+ *       12     4  rows per permutation
+ *       16     8  permutations
+ *       24     4  header size (64)
+ *       28     4  capacity
+ *       32    32  reserved, zero
+ *
+ * Options:
+ *   --state=<m>       Hash state width (default 12)
+ *   --capacity=<c>    Hash capacity (default 5)
+ *   --random=<n>      Trace n random states instead of reading a file
+ *   --seed=<s>        Seed for --random (default 1)
+ *   --threads=<n>     Worker threads (default: all cores)
+ *
+ * Exit status: 0 on success, 1 on failure, 2 on usage error.
+ */
+
+#include "mapped_file.hpp"
+
+#include <rescue/rescue.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+using namespace rescue;
+using rescue::tools::InputMap;
+using rescue::tools::OutputMap;
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr size_t HEADER_SIZE = 64;
+
+/// Permutations deserialized and traced per pass over the worker pool.
+constexpr size_t BATCH_PERMUTATIONS = 1 << 14;
+
+struct Options {
+    size_t state = RESCUE_HASH_STATE_SIZE;
+    size_t capacity = RESCUE_HASH_CAPACITY;
+    std::optional<size_t> random;
+    uint64_t seed = 1;
+    size_t threads = 0;
+    std::vector<std::string> paths;
+};
+
+template <typename T>
+void put_le(uint8_t* out, T v) {
+    for (size_t i = 0; i < sizeof(T); ++i) {
+        out[i] = static_cast<uint8_t>(v >> (8 * i));
+    }
+}
+
+void write_header(const TraceLayout& layout, size_t capacity, std::span<uint8_t> out) {
+    std::fill_n(out.begin(), HEADER_SIZE, uint8_t{0});
+    constexpr std::string_view magic = "RTRACE01";
+    std::copy(magic.begin(), magic.end(), out.begin());
+    put_le<uint32_t>(out.data() + 8, static_cast<uint32_t>(layout.columns));
+    put_le<uint32_t>(out.data() + 12, static_cast<uint32_t>(layout.rows_per_permutation));
+    put_le<uint64_t>(out.data() + 16, layout.n_permutations);
+    put_le<uint32_t>(out.data() + 24, static_cast<uint32_t>(HEADER_SIZE));
+    put_le<uint32_t>(out.data() + 28, static_cast<uint32_t>(capacity));
+}
+
+void print_usage() {
+    std::cerr << "usage: rescue-trace [--state=<m>] [--capacity=<c>] [--threads=<n>] "
+                 "(--random=<n> [--seed=<s>] <trace> | <states> <trace>)\n";
+}
+
+Options parse_args(int argc, char** argv) {
+    Options opts;
+    for (int i = 1; i < argc; ++i) {
+        std::string_view arg(argv[i]);
+        auto value = [&](std::string_view flag) -> std::optional<std::string> {
+            if (arg.starts_with(flag)) {
+                return std::string(arg.substr(flag.size()));
+            }
+            return std::nullopt;
+        };
+        if (auto v = value("--state=")) {
+            opts.state = std::stoul(*v);
+        } else if (auto v = value("--capacity=")) {
+            opts.capacity = std::stoul(*v);
+        } else if (auto v = value("--random=")) {
+            opts.random = std::stoul(*v);
+        } else if (auto v = value("--seed=")) {
+            opts.seed = std::stoull(*v);
+        } else if (auto v = value("--threads=")) {
+            opts.threads = std::stoul(*v);
+        } else if (arg.starts_with("--")) {
+            throw std::invalid_argument("unknown option " + std::string(arg));
+        } else {
+            opts.paths.emplace_back(arg);
+        }
+    }
+    if (opts.paths.size() != (opts.random ? 1u : 2u)) {
+        throw std::invalid_argument(opts.random ? "--random takes only an output path"
+                                                : "expected an input and an output path");
+    }
+    if (opts.capacity == 0 || opts.capacity >= opts.state) {
+        throw std::invalid_argument("capacity must be positive and less than the state width");
+    }
+    return opts;
+}
+
+}  // anonymous namespace
+
+int main(int argc, char** argv) {
+    Options opts;
+    try {
+        opts = parse_args(argc, argv);
+    } catch (const std::exception& e) {
+        std::cerr << "rescue-trace: " << e.what() << "\n";
+        print_usage();
+        return 2;
+    }
+
+    try {
+        RescueDesc desc(opts.state, opts.capacity);
+        const size_t m = desc.m();
+
+        std::optional<InputMap> in;
+        size_t n = 0;
+        if (opts.random) {
+            n = *opts.random;
+        } else {
+            if (rescue::tools::same_file(opts.paths[0], opts.paths.back())) {
+                throw std::runtime_error(opts.paths.back() + " is the input file; write to a different path");
+            }
+            in.emplace(opts.paths[0]);
+            if (in->bytes().size() % (m * Fp::BYTES) != 0) {
+                throw std::runtime_error(opts.paths[0] + ": size is not a whole number of " + std::to_string(m) +
+                                         "-element states");
+            }
+            n = in->bytes().size() / (m * Fp::BYTES);
+        }
+
+        TraceLayout layout = TraceLayout::for_desc(desc, n);
+        OutputMap out(opts.paths.back(), HEADER_SIZE + layout.bytes());
+        write_header(layout, opts.capacity, out.bytes());
+        auto body = out.bytes().subspan(HEADER_SIZE);
+
+        // --threads=<n> runs on a pool of that size, otherwise on the library's default executor
+        std::optional<WorkStealingExecutor> pool;
+        if (opts.threads > 0) {
+            pool.emplace(WorkStealingExecutor::Options{.threads = opts.threads});
+        }
+        Executor& executor = pool ? static_cast<Executor&>(*pool) : default_executor();
+
+        std::mt19937_64 rng(opts.seed);
+        std::vector<Fp> states;
+        auto start = Clock::now();
+        for (size_t first = 0; first < n; first += BATCH_PERMUTATIONS) {
+            const size_t count = std::min(BATCH_PERMUTATIONS, n - first);
+            states.resize(count * m);
+            for (size_t i = 0; i < states.size(); ++i) {
+                if (in) {
+                    uint256 raw(in->bytes().subspan((first * m + i) * Fp::BYTES, Fp::BYTES));
+                    if (raw >= Fp::P) {
+                        throw std::runtime_error("element " + std::to_string(first * m + i) +
+                                                 " is not a canonical field element");
+                    }
+                    states[i] = Fp(raw);
+                } else {
+                    // Drawn in limb order so --seed output is the same with every compiler
+                    const uint64_t l0 = rng();
+                    const uint64_t l1 = rng();
+                    const uint64_t l2 = rng();
+                    const uint64_t l3 = rng() >> 2;
+                    states[i] = Fp(uint256(l0, l1, l2, l3));
+                }
+            }
+            generate_trace(desc, states, layout, first, body, executor);
+        }
+        out.commit();
+
+        double seconds = std::chrono::duration<double>(Clock::now() - start).count();
+        std::fprintf(stderr, "traced %zu permutations (%zu x %zu cells, %.1f MiB) in %.3f s: %.0f permutations/s\n",
+                     n, layout.columns, layout.rows(), static_cast<double>(layout.bytes()) / (1024.0 * 1024.0),
+                     seconds, seconds > 0 ? static_cast<double>(n) / seconds : 0.0);
+    } catch (const std::exception& e) {
+        std::cerr << "rescue-trace: " << e.what() << "\n";
+        return 1;
+    }
+    return 0;
+}